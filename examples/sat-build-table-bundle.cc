@@ -0,0 +1,132 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/satellite-env-variables.h"
+#include "ns3/satellite-look-up-table.h"
+#include "ns3/satellite-mutual-information-table.h"
+#include "ns3/satellite-table-bundle.h"
+#include "ns3/satellite-wave-form-conf.h"
+
+#include <algorithm>
+#include <dirent.h>
+#include <iostream>
+
+using namespace ns3;
+
+/**
+ * \file sat-build-table-bundle.cc
+ * \ingroup satellite
+ * \brief Build the binary bundle of the data folder tables.
+ *
+ * Parses every link results and mutual information file of the linkresults
+ * folder and every waveform configuration of the data folder, and writes them
+ * in a single binary bundle loaded by SatTableBundle. The bundle is written in
+ * the data folder by default, where simulations look for it:
+ *
+ *     $ ./waf --run="sat-build-table-bundle"
+ *
+ * The bundle has to be rebuilt after editing a text file, until then the
+ * simulations ignore the stale table and parse the text file.
+ *
+ */
+
+NS_LOG_COMPONENT_DEFINE("sat-build-table-bundle");
+
+/**
+ * \brief List the files of a directory with the given suffix, sorted by name
+ */
+static std::vector<std::string>
+ListFiles(std::string directory, std::string suffix)
+{
+    std::vector<std::string> files;
+
+    DIR* dir = opendir(directory.c_str());
+    if (dir == 0)
+    {
+        NS_FATAL_ERROR("Cannot open directory " << directory);
+    }
+
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != 0)
+    {
+        std::string name = entry->d_name;
+        if (name.size() > suffix.size() &&
+            name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0)
+        {
+            files.push_back(name);
+        }
+    }
+    closedir(dir);
+
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+int
+main(int argc, char* argv[])
+{
+    std::string output = "";
+
+    CommandLine cmd;
+    cmd.AddValue("output", "Path of the bundle, defaults to tables.bin in the data folder", output);
+    cmd.Parse(argc, argv);
+
+    std::string dataPath = Singleton<SatEnvVariables>::Get()->LocateDataDirectory() + "/";
+    std::string linkResultsPath = dataPath + "linkresults/";
+
+    if (output.empty())
+    {
+        output = dataPath + "tables.bin";
+    }
+
+    std::vector<SatTableBundle::sourceTable_s> tables;
+
+    for (const std::string& name : ListFiles(linkResultsPath, ".txt"))
+    {
+        SatTableBundle::sourceTable_s table;
+        table.m_sourcePath = linkResultsPath + name;
+
+        if (name == "mutualInformationTable.txt")
+        {
+            SatMutualInformationTable::ReadTextColumns(table.m_sourcePath, table.m_columns);
+        }
+        else
+        {
+            SatLookUpTable::ReadTextColumns(table.m_sourcePath, table.m_columns);
+        }
+
+        tables.push_back(table);
+    }
+
+    for (const std::string& name : ListFiles(dataPath, "Waveforms.txt"))
+    {
+        SatTableBundle::sourceTable_s table;
+        table.m_sourcePath = dataPath + name;
+        SatWaveformConf::ReadTextColumns(table.m_sourcePath, table.m_columns);
+        tables.push_back(table);
+    }
+
+    SatTableBundle::Write(output, tables);
+
+    std::cout << "Wrote " << tables.size() << " tables to " << output << std::endl;
+
+    return 0;
+}
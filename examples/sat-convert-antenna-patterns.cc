@@ -0,0 +1,93 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/satellite-antenna-gain-pattern.h"
+#include "ns3/satellite-env-variables.h"
+
+#include <algorithm>
+#include <dirent.h>
+#include <iostream>
+
+using namespace ns3;
+
+/**
+ * \file sat-convert-antenna-patterns.cc
+ * \ingroup satellite
+ * \brief Convert the antenna gain patterns of a folder to the binary format.
+ *
+ * Parses every antenna pattern text file of a sub-folder of antennapatterns
+ * and writes its binary version next to it, with the .bin extension. The
+ * binary files are memory mapped by SatAntennaGainPattern instead of parsing
+ * the text files:
+ *
+ *     $ ./waf --run="sat-convert-antenna-patterns --patternsFolder=SatAntennaGain72Beams"
+ *
+ * A pattern has to be converted again after editing its text file, until
+ * then the simulations ignore the stale binary file and parse the text file.
+ *
+ */
+
+NS_LOG_COMPONENT_DEFINE("sat-convert-antenna-patterns");
+
+int
+main(int argc, char* argv[])
+{
+    std::string patternsFolder = "SatAntennaGain72Beams";
+
+    CommandLine cmd;
+    cmd.AddValue("patternsFolder",
+                 "Sub-folder of antennapatterns holding the patterns to convert",
+                 patternsFolder);
+    cmd.Parse(argc, argv);
+
+    std::string path = Singleton<SatEnvVariables>::Get()->LocateDataDirectory() +
+                       "/antennapatterns/" + patternsFolder + "/";
+
+    std::vector<std::string> files;
+
+    DIR* dir = opendir(path.c_str());
+    if (dir == 0)
+    {
+        NS_FATAL_ERROR("Cannot open directory " << path);
+    }
+
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != 0)
+    {
+        std::string name = entry->d_name;
+        if (name.size() > 4 && name.compare(name.size() - 4, 4, ".txt") == 0)
+        {
+            files.push_back(name);
+        }
+    }
+    closedir(dir);
+
+    std::sort(files.begin(), files.end());
+
+    for (const std::string& name : files)
+    {
+        SatAntennaGainPattern::ConvertToBinary(path + name);
+    }
+
+    std::cout << "Converted " << files.size() << " antenna patterns in " << path << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,60 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/satellite-fading-external-input-trace-container.h"
+
+#include <iostream>
+
+using namespace ns3;
+
+/**
+ * \file sat-convert-fading-traces.cc
+ * \ingroup satellite
+ * \brief Convert the external fading traces to linear format.
+ *
+ * Converts the fading values of every trace file listed in the index files
+ * of SatFadingExternalInputTraceContainer to linear format, written next to
+ * the trace file with the .lin extension added. The linear fading files are
+ * memory mapped by SatFadingExternalInputTrace instead of converting the
+ * fading values in each simulation:
+ *
+ *     $ ./waf --run="sat-convert-fading-traces"
+ *
+ * The index files are selected with the attributes of the container, as for
+ * the simulations. A trace has to be converted again after editing its file,
+ * until then the simulations ignore the stale linear fading file.
+ *
+ */
+
+NS_LOG_COMPONENT_DEFINE("sat-convert-fading-traces");
+
+int
+main(int argc, char* argv[])
+{
+    CommandLine cmd;
+    cmd.Parse(argc, argv);
+
+    uint32_t count = Singleton<SatFadingExternalInputTraceContainer>::Get()->ConvertFadingTraces();
+
+    std::cout << "Converted " << count << " fading traces" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,199 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+#include "ns3/applications-module.h"
+#include "ns3/core-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/network-module.h"
+#include "ns3/satellite-module.h"
+#include "ns3/traffic-module.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+using namespace ns3;
+
+/**
+ * \file sat-crdsa-decoder-benchmark.cc
+ * \ingroup satellite
+ *
+ * \brief Benchmark of the CRDSA SIC decoders.
+ *
+ * Runs a single beam CRDSA scenario where every UT sends a CBR flow through
+ * random access, and measures the wall clock time of the simulation. The
+ * normalized offered load of the random access frames grows with the number
+ * of UTs. The SlotScan decoder rescans the frame after each decoded packet,
+ * whereas the Peeling decoder walks the packet/slot graph of the frame; both
+ * decode the same packets, so the simulation outputs are identical. The frames
+ * of the carriers can also be decoded on worker threads with parallelDecoding.
+ *
+ * To compare the decoders over increasing loads:
+ *
+ *     $ for uts in 25 50 100 200 400; do
+ *     >   for decoder in SlotScan Peeling; do
+ *     >     ./waf --run="sat-crdsa-decoder-benchmark --utsPerBeam=$uts --decoder=$decoder"
+ *     >   done
+ *     > done
+ *
+ */
+
+NS_LOG_COMPONENT_DEFINE("sat-crdsa-decoder-benchmark");
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t beamId(1);
+    uint32_t utsPerBeam(100);
+    uint32_t packetSize(20);
+    Time interval(Seconds(0.01));
+    Time simLength(Seconds(10.0));
+    Time appStartTime = Seconds(0.01);
+    std::string decoder = "Peeling";
+    bool marsala = false;
+    bool parallelDecoding = false;
+    uint32_t decodingThreads = 0;
+
+    auto sh = CreateObject<SimulationHelper>("example-crdsa-decoder-benchmark");
+
+    // Read command line parameters given by user
+    CommandLine cmd;
+    cmd.AddValue("utsPerBeam", "Number of UTs in the beam", utsPerBeam);
+    cmd.AddValue("packetSize", "Size of the CBR packets in bytes", packetSize);
+    cmd.AddValue("interval", "Interval between the CBR packets", interval);
+    cmd.AddValue("simLength", "Simulation duration", simLength);
+    cmd.AddValue("decoder", "SIC decoder: SlotScan or Peeling", decoder);
+    cmd.AddValue("marsala", "Use MARSALA on top of CRDSA", marsala);
+    cmd.AddValue("parallelDecoding", "Decode the frames on worker threads", parallelDecoding);
+    cmd.AddValue("decodingThreads",
+                 "Threads decoding the frames, 0 for the hardware threads",
+                 decodingThreads);
+    cmd.Parse(argc, argv);
+
+    // Configure error model
+    SatPhyRxCarrierConf::ErrorModel em(SatPhyRxCarrierConf::EM_AVI);
+    Config::SetDefault("ns3::SatUtHelper::FwdLinkErrorModel", EnumValue(em));
+    Config::SetDefault("ns3::SatGwHelper::RtnLinkErrorModel", EnumValue(em));
+
+    // Enable Random Access with CRDSA, or MARSALA
+    Config::SetDefault("ns3::SatBeamHelper::RandomAccessModel",
+                       EnumValue(marsala ? SatEnums::RA_MODEL_MARSALA : SatEnums::RA_MODEL_CRDSA));
+
+    // Select the SIC decoder
+    Config::SetDefault("ns3::SatPhyRxCarrierPerFrame::SicDecoder", StringValue(decoder));
+
+    // Decode the frames of the carriers on worker threads
+    Config::SetDefault("ns3::SatFrameDecodingPool::Enabled", BooleanValue(parallelDecoding));
+    Config::SetDefault("ns3::SatFrameDecodingPool::Threads", UintegerValue(decodingThreads));
+
+    // Set Random Access interference model
+    Config::SetDefault("ns3::SatBeamHelper::RaInterferenceModel",
+                       EnumValue(SatPhyRxCarrierConf::IF_PER_PACKET));
+
+    // Set Random Access collision model
+    Config::SetDefault("ns3::SatBeamHelper::RaCollisionModel",
+                       EnumValue(SatPhyRxCarrierConf::RA_COLLISION_CHECK_AGAINST_SINR));
+
+    // Disable periodic control slots
+    Config::SetDefault("ns3::SatBeamScheduler::ControlSlotsEnabled", BooleanValue(false));
+
+    // Set dynamic load control parameters
+    Config::SetDefault("ns3::SatPhyRxCarrierConf::EnableRandomAccessDynamicLoadControl",
+                       BooleanValue(false));
+    Config::SetDefault(
+        "ns3::SatPhyRxCarrierConf::RandomAccessAverageNormalizedOfferedLoadMeasurementWindowSize",
+        UintegerValue(10));
+
+    // Set random access parameters
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::RaService0_MaximumUniquePayloadPerBlock",
+                       UintegerValue(3));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::RaService0_MaximumConsecutiveBlockAccessed",
+                       UintegerValue(6));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::RaService0_MinimumIdleBlock",
+                       UintegerValue(2));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::RaService0_BackOffTimeInMilliSeconds",
+                       UintegerValue(250));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::RaService0_BackOffProbability",
+                       UintegerValue(10000));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::RaService0_HighLoadBackOffProbability",
+                       UintegerValue(30000));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::RaService0_NumberOfInstances",
+                       UintegerValue(3));
+    Config::SetDefault(
+        "ns3::SatLowerLayerServiceConf::RaService0_AverageNormalizedOfferedLoadThreshold",
+        DoubleValue(0.5));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DefaultControlRandomizationInterval",
+                       TimeValue(MilliSeconds(100)));
+    Config::SetDefault("ns3::SatRandomAccessConf::CrdsaSignalingOverheadInBytes", UintegerValue(5));
+    Config::SetDefault("ns3::SatRandomAccessConf::SlottedAlohaSignalingOverheadInBytes",
+                       UintegerValue(3));
+
+    // Disable CRA and DA
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService0_ConstantAssignmentProvided",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService1_ConstantAssignmentProvided",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService2_ConstantAssignmentProvided",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService3_ConstantAssignmentProvided",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService0_RbdcAllowed",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService1_RbdcAllowed",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService2_RbdcAllowed",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService3_RbdcAllowed",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService0_VolumeAllowed",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService1_VolumeAllowed",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService2_VolumeAllowed",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService3_VolumeAllowed",
+                       BooleanValue(false));
+
+    sh->SetSimulationTime(simLength);
+    sh->SetUserCountPerUt(1);
+    sh->SetUtCountPerBeam(utsPerBeam);
+    sh->SetBeamSet({beamId});
+    sh->CreateSatScenario();
+
+    Config::SetDefault("ns3::CbrApplication::Interval", TimeValue(interval));
+    Config::SetDefault("ns3::CbrApplication::PacketSize", UintegerValue(packetSize));
+    sh->InstallTrafficModel(SimulationHelper::CBR,
+                            SimulationHelper::UDP,
+                            SimulationHelper::RTN_LINK,
+                            appStartTime,
+                            simLength + Seconds(1),
+                            Seconds(0.05));
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    sh->RunSimulation();
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+    std::cout << "UTs: " << utsPerBeam << ", decoder: " << decoder << ", MARSALA: " << marsala
+              << ", parallel decoding: " << parallelDecoding << ", wall clock: " << std::fixed
+              << std::setprecision(2) << std::chrono::duration<double>(end - start).count() << " s"
+              << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,217 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+#include "ns3/applications-module.h"
+#include "ns3/core-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/network-module.h"
+#include "ns3/satellite-module.h"
+#include "ns3/traffic-module.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+using namespace ns3;
+
+/**
+ * \file sat-essa-window-benchmark.cc
+ * \ingroup satellite
+ *
+ * \brief Benchmark of the E-SSA sliding window receiver.
+ *
+ * Runs a single beam E-SSA scenario with SIC, where many UTs send short
+ * packets on the same carrier, and measures the wall clock time of the
+ * simulation. Each packet is part of WindowDuration / WindowStep windows, so
+ * a window step much smaller than the window duration stresses the packet
+ * store of SatPhyRxCarrierPerWindow: cleaning, window bounds and window load.
+ *
+ * To compare window steps with 1000 UTs:
+ *
+ *     $ ./waf --run="sat-essa-window-benchmark --utsPerBeam=1000 --windowStep=200ms"
+ *     $ ./waf --run="sat-essa-window-benchmark --utsPerBeam=1000 --windowStep=5ms"
+ *
+ */
+
+NS_LOG_COMPONENT_DEFINE("sat-essa-window-benchmark");
+
+int
+main(int argc, char* argv[])
+{
+    // Variables
+    std::string beams = "8";
+    uint32_t nbUtsPerBeam = 500;
+
+    Time appStartTime = Seconds(0.001);
+    Time simLength = Seconds(10.0);
+
+    uint32_t packetSize = 64;
+    std::string dataRate = "5kbps";
+    std::string onTime = "0.2";
+    std::string offTime = "0.8";
+
+    Time windowDuration = MilliSeconds(600);
+    Time windowStep = MilliSeconds(5);
+
+    double frameAllocatedBandwidthHz = 15000;
+    double frameCarrierAllocatedBandwidthHz = 15000;
+    double frameCarrierRollOff = 0.22;
+    double frameCarrierSpacing = 0;
+    uint32_t frameSpreadingFactor = 256;
+
+    Ptr<SimulationHelper> simulationHelper =
+        CreateObject<SimulationHelper>("example-essa-window-benchmark");
+
+    // read command line parameters given by user
+    CommandLine cmd;
+    cmd.AddValue("utsPerBeam", "Number of UTs in the beam", nbUtsPerBeam);
+    cmd.AddValue("simLength", "Simulation duration", simLength);
+    cmd.AddValue("packetSize", "Constant packet size in bytes", packetSize);
+    cmd.AddValue("dataRate", "Data rate (e.g. 500kb/s)", dataRate);
+    cmd.AddValue("windowDuration", "Duration of the sliding window", windowDuration);
+    cmd.AddValue("windowStep", "Step of the sliding window", windowStep);
+    cmd.Parse(argc, argv);
+
+    // Defaults
+    Config::SetDefault("ns3::SatEnvVariables::EnableSimulationOutputOverwrite", BooleanValue(true));
+
+    // Superframe configuration
+    Config::SetDefault("ns3::SatConf::SuperFrameConfForSeq0",
+                       EnumValue(SatSuperframeConf::SUPER_FRAME_CONFIG_4));
+    Config::SetDefault("ns3::SatSuperframeConf4::FrameConfigType",
+                       EnumValue(SatSuperframeConf::CONFIG_TYPE_4));
+    Config::SetDefault("ns3::SatSuperframeConf4::Frame0_AllocatedBandwidthHz",
+                       DoubleValue(frameAllocatedBandwidthHz));
+    Config::SetDefault("ns3::SatSuperframeConf4::Frame0_CarrierAllocatedBandwidthHz",
+                       DoubleValue(frameCarrierAllocatedBandwidthHz));
+    Config::SetDefault("ns3::SatSuperframeConf4::Frame0_CarrierRollOff",
+                       DoubleValue(frameCarrierRollOff));
+    Config::SetDefault("ns3::SatSuperframeConf4::Frame0_CarrierSpacing",
+                       DoubleValue(frameCarrierSpacing));
+    Config::SetDefault("ns3::SatSuperframeConf4::Frame0_SpreadingFactor",
+                       UintegerValue(frameSpreadingFactor));
+
+    // CRDSA only
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaServiceCount", UintegerValue(4));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService0_ConstantAssignmentProvided",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService0_RbdcAllowed",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService0_VolumeAllowed",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService1_ConstantAssignmentProvided",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService1_RbdcAllowed",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService1_VolumeAllowed",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService2_ConstantAssignmentProvided",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService2_RbdcAllowed",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService2_VolumeAllowed",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService3_ConstantAssignmentProvided",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService3_RbdcAllowed",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService3_VolumeAllowed",
+                       BooleanValue(false));
+
+    // Configure RA
+    Config::SetDefault("ns3::SatBeamHelper::RandomAccessModel", EnumValue(SatEnums::RA_MODEL_ESSA));
+    Config::SetDefault("ns3::SatBeamHelper::RaInterferenceModel",
+                       EnumValue(SatPhyRxCarrierConf::IF_PER_PACKET));
+    Config::SetDefault("ns3::SatBeamHelper::RaInterferenceEliminationModel",
+                       EnumValue(SatPhyRxCarrierConf::SIC_RESIDUAL));
+    Config::SetDefault("ns3::SatBeamHelper::RaCollisionModel",
+                       EnumValue(SatPhyRxCarrierConf::RA_COLLISION_CHECK_AGAINST_SINR));
+    Config::SetDefault("ns3::SatBeamHelper::ReturnLinkLinkResults", EnumValue(SatEnums::LR_FSIM));
+    Config::SetDefault("ns3::SatWaveformConf::DefaultWfId", UintegerValue(2));
+    Config::SetDefault("ns3::SatHelper::RtnLinkWaveformConfFileName",
+                       StringValue("fSimWaveforms.txt"));
+
+    Config::SetDefault("ns3::SatPhyRxCarrierPerWindow::WindowDuration", TimeValue(windowDuration));
+    Config::SetDefault("ns3::SatPhyRxCarrierPerWindow::WindowStep", TimeValue(windowStep));
+    Config::SetDefault("ns3::SatPhyRxCarrierPerWindow::WindowDelay", StringValue("0s"));
+    Config::SetDefault("ns3::SatPhyRxCarrierPerWindow::FirstWindow", StringValue("0s"));
+    Config::SetDefault("ns3::SatPhyRxCarrierPerWindow::WindowSICIterations", UintegerValue(5));
+    Config::SetDefault("ns3::SatPhyRxCarrierPerWindow::SpreadingFactor", UintegerValue(1));
+    Config::SetDefault("ns3::SatPhyRxCarrierPerWindow::DetectionThreshold", DoubleValue(0));
+    Config::SetDefault("ns3::SatPhyRxCarrierPerWindow::EnableSIC", BooleanValue(true));
+
+    // Set random access parameters
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::RaService0_MaximumUniquePayloadPerBlock",
+                       UintegerValue(3));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::RaService0_MaximumConsecutiveBlockAccessed",
+                       UintegerValue(6));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::RaService0_MinimumIdleBlock",
+                       UintegerValue(2));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::RaService0_BackOffTimeInMilliSeconds",
+                       UintegerValue(50));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::RaService0_BackOffProbability",
+                       UintegerValue(1));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::RaService0_HighLoadBackOffProbability",
+                       UintegerValue(1));
+    Config::SetDefault(
+        "ns3::SatLowerLayerServiceConf::RaService0_AverageNormalizedOfferedLoadThreshold",
+        DoubleValue(0.99));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::RaService0_NumberOfInstances",
+                       UintegerValue(3));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::RaService0_SlottedAlohaAllowed",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::RaService0_CrdsaAllowed",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::RaService0_EssaAllowed", BooleanValue(true));
+
+    // Traffics
+    simulationHelper->SetSimulationTime(simLength);
+
+    simulationHelper->SetGwUserCount(1);
+    simulationHelper->SetUtCountPerBeam(nbUtsPerBeam);
+    simulationHelper->SetUserCountPerUt(1);
+    simulationHelper->SetBeams(beams);
+
+    simulationHelper->CreateSatScenario();
+
+    Config::SetDefault("ns3::OnOffApplication::PacketSize", UintegerValue(packetSize));
+    Config::SetDefault("ns3::OnOffApplication::DataRate", StringValue(dataRate));
+    Config::SetDefault("ns3::OnOffApplication::OnTime",
+                       StringValue("ns3::ConstantRandomVariable[Constant=" + onTime + "]"));
+    Config::SetDefault("ns3::OnOffApplication::OffTime",
+                       StringValue("ns3::ConstantRandomVariable[Constant=" + offTime + "]"));
+
+    simulationHelper->InstallTrafficModel(SimulationHelper::ONOFF,
+                                          SimulationHelper::UDP,
+                                          SimulationHelper::RTN_LINK,
+                                          appStartTime,
+                                          simLength);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    simulationHelper->RunSimulation();
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+    std::cout << "UTs: " << nbUtsPerBeam << ", window duration: " << windowDuration.GetSeconds()
+              << " s, window step: " << windowStep.GetSeconds() << " s, wall clock: " << std::fixed
+              << std::setprecision(2) << std::chrono::duration<double>(end - start).count()
+              << " s" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,126 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/mac48-address.h"
+#include "ns3/satellite-per-packet-energy-interference.h"
+#include "ns3/satellite-per-packet-interference.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+using namespace ns3;
+
+/**
+ * \file sat-interference-benchmark.cc
+ * \ingroup satellite
+ * \brief Microbenchmark of the per packet interference models.
+ *
+ * Feeds a steady stream of overlapping bursts into a single interference
+ * object, every burst being received, and measures the wall clock time spent
+ * for an increasing number of concurrent bursts. The per packet model
+ * (SatPerPacketInterference) walks all power changes for each calculation
+ * whereas the per packet energy model (SatPerPacketEnergyInterference) stays
+ * logarithmic, which shows as a growing gap with the concurrency.
+ *
+ * To run the benchmark with 10000 bursts per step, up to 512 concurrent bursts:
+ *
+ *     $ ./waf --run="sat-interference-benchmark --bursts=10000 --maxConcurrent=512"
+ *
+ */
+
+NS_LOG_COMPONENT_DEFINE("sat-interference-benchmark");
+
+static void
+ReceiveBurst(Ptr<SatInterference> interference, Ptr<SatInterference::InterferenceChangeEvent> event)
+{
+    interference->Calculate(event);
+    interference->NotifyRxEnd(event);
+}
+
+static void
+StartBurst(Ptr<SatInterference> interference, Time duration, double power, Address address)
+{
+    Ptr<SatInterference::InterferenceChangeEvent> event =
+        interference->Add(duration, power, address);
+    interference->NotifyRxStart(event);
+
+    Simulator::Schedule(duration, &ReceiveBurst, interference, event);
+}
+
+static double
+RunBenchmark(Ptr<SatInterference> interference, uint32_t concurrent, uint32_t bursts)
+{
+    // a new burst every microsecond, lasting long enough to overlap with the next ones
+    const Time duration = MicroSeconds(concurrent);
+
+    Ptr<UniformRandomVariable> power = CreateObject<UniformRandomVariable>();
+    power->SetStream(1);
+    Address address = Mac48Address::Allocate();
+
+    for (uint32_t i = 0; i < bursts; i++)
+    {
+        Simulator::Schedule(MicroSeconds(i),
+                            &StartBurst,
+                            interference,
+                            duration,
+                            power->GetValue(1e-12, 1e-9),
+                            address);
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    Simulator::Run();
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+    Simulator::Destroy();
+    interference->Dispose();
+
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t bursts = 10000;
+    uint32_t maxConcurrent = 256;
+
+    CommandLine cmd;
+    cmd.AddValue("bursts", "Number of bursts received per measurement", bursts);
+    cmd.AddValue("maxConcurrent", "Maximum number of concurrent bursts", maxConcurrent);
+    cmd.Parse(argc, argv);
+
+    std::cout << std::setw(12) << "concurrent" << std::setw(20) << "PerPacket (ms)"
+              << std::setw(24) << "PerPacketEnergy (ms)" << std::endl;
+
+    for (uint32_t concurrent = 1; concurrent <= maxConcurrent; concurrent *= 2)
+    {
+        double perPacket =
+            RunBenchmark(CreateObject<SatPerPacketInterference>(), concurrent, bursts);
+        double perPacketEnergy =
+            RunBenchmark(CreateObject<SatPerPacketEnergyInterference>(), concurrent, bursts);
+
+        std::cout << std::setw(12) << concurrent << std::setw(20) << std::fixed
+                  << std::setprecision(2) << perPacket << std::setw(24) << perPacketEnergy
+                  << std::endl;
+    }
+
+    return 0;
+}
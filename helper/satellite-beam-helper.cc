@@ -115,7 +115,9 @@ SatBeamHelper::GetTypeId(void)
                                           SatPhyRxCarrierConf::IF_PER_PACKET,
                                           "PerPacket",
                                           SatPhyRxCarrierConf::IF_PER_FRAGMENT,
-                                          "PerFragment"))
+                                          "PerFragment",
+                                          SatPhyRxCarrierConf::IF_PER_PACKET_ENERGY,
+                                          "PerPacketEnergy"))
             .AddAttribute("RaInterferenceEliminationModel",
                           "Interference elimination model for random access",
                           EnumValue(SatPhyRxCarrierConf::SIC_PERFECT),
@@ -1558,6 +1560,10 @@ SatBeamHelper::GetChannelPair(uint32_t satId,
             forwardCh->SetFrequencyId(fwdFrequencyId);
             forwardCh->SetPropagationDelayModel(pDelay);
             forwardCh->SetFreeSpaceLoss(pFsl);
+            if (isUserLink)
+            {
+                forwardCh->SetAntennaGainPatterns(m_antennaGainPatterns);
+            }
         }
 
         if (!hasRtnChannel)
@@ -1570,6 +1576,10 @@ SatBeamHelper::GetChannelPair(uint32_t satId,
             returnCh->SetFrequencyId(rtnFrequencyId);
             returnCh->SetPropagationDelayModel(pDelay);
             returnCh->SetFreeSpaceLoss(pFsl);
+            if (isUserLink)
+            {
+                returnCh->SetAntennaGainPatterns(m_antennaGainPatterns);
+            }
         }
 
         chPairs
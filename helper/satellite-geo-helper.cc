@@ -74,7 +74,9 @@ SatGeoHelper::GetTypeId(void)
                                           SatPhyRxCarrierConf::IF_PER_PACKET,
                                           "PerPacket",
                                           SatPhyRxCarrierConf::IF_PER_FRAGMENT,
-                                          "PerFragment"))
+                                          "PerFragment",
+                                          SatPhyRxCarrierConf::IF_PER_PACKET_ENERGY,
+                                          "PerPacketEnergy"))
             .AddAttribute("DaRtnLinkInterferenceModel",
                           "Return link interference model for dedicated access",
                           EnumValue(SatPhyRxCarrierConf::IF_PER_PACKET),
@@ -86,7 +88,9 @@ SatGeoHelper::GetTypeId(void)
                                           SatPhyRxCarrierConf::IF_PER_PACKET,
                                           "PerPacket",
                                           SatPhyRxCarrierConf::IF_PER_FRAGMENT,
-                                          "PerFragment"))
+                                          "PerFragment",
+                                          SatPhyRxCarrierConf::IF_PER_PACKET_ENERGY,
+                                          "PerPacketEnergy"))
             .AddAttribute("FwdLinkErrorModel",
                           "Forward feeder link error model",
                           EnumValue(SatPhyRxCarrierConf::EM_NONE),
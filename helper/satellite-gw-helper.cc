@@ -93,7 +93,9 @@ SatGwHelper::GetTypeId(void)
                                           SatPhyRxCarrierConf::IF_PER_PACKET,
                                           "PerPacket",
                                           SatPhyRxCarrierConf::IF_PER_FRAGMENT,
-                                          "PerFragment"))
+                                          "PerFragment",
+                                          SatPhyRxCarrierConf::IF_PER_PACKET_ENERGY,
+                                          "PerPacketEnergy"))
             .AddAttribute("RtnLinkErrorModel",
                           "Return link error model for",
                           EnumValue(SatPhyRxCarrierConf::EM_AVI),
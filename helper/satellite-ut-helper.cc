@@ -90,7 +90,9 @@ SatUtHelper::GetTypeId(void)
                                           SatPhyRxCarrierConf::IF_PER_PACKET,
                                           "PerPacket",
                                           SatPhyRxCarrierConf::IF_PER_FRAGMENT,
-                                          "PerFragment"))
+                                          "PerFragment",
+                                          SatPhyRxCarrierConf::IF_PER_PACKET_ENERGY,
+                                          "PerPacketEnergy"))
             .AddAttribute("FwdLinkErrorModel",
                           "Forward link error model",
                           EnumValue(SatPhyRxCarrierConf::EM_AVI),
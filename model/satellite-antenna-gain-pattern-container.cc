@@ -21,15 +21,20 @@
 #include "satellite-antenna-gain-pattern-container.h"
 
 #include "satellite-sgp4-mobility-model.h"
+#include "satellite-utils.h"
 
+#include "ns3/boolean.h"
+#include "ns3/double.h"
 #include "ns3/log.h"
 #include "ns3/satellite-env-variables.h"
 #include "ns3/singleton.h"
 #include "ns3/string.h"
 
+#include <cmath>
 #include <dirent.h>
 #include <errno.h>
 #include <fstream>
+#include <limits>
 #include <sstream>
 #include <string.h>
 
@@ -54,7 +59,20 @@ SatAntennaGainPatternContainer::GetTypeId(void)
                 "Sub-folder in 'antennapatterns' containing the gains definition for each beam",
                 StringValue("SatAntennaGain72Beams"),
                 MakeStringAccessor(&SatAntennaGainPatternContainer::m_patternsFolder),
-                MakeStringChecker());
+                MakeStringChecker())
+            .AddAttribute("UseBestBeamRaster",
+                          "Look up the best beam in a raster of the antenna pattern grid boxes, "
+                          "instead of interpolating the gains of all the beams.",
+                          BooleanValue(true),
+                          MakeBooleanAccessor(&SatAntennaGainPatternContainer::m_useBestBeamRaster),
+                          MakeBooleanChecker())
+            .AddAttribute(
+                "BestBeamRasterMargin",
+                "Gain margin in dB of the best beam over the other beams at the four corners "
+                "of a grid box, above which the best beam is taken from the raster.",
+                DoubleValue(0.001),
+                MakeDoubleAccessor(&SatAntennaGainPatternContainer::m_bestBeamRasterMargin),
+                MakeDoubleChecker<double>(0.0));
     return tid;
 }
 
@@ -66,6 +84,13 @@ SatAntennaGainPatternContainer::GetInstanceTypeId() const
 }
 
 SatAntennaGainPatternContainer::SatAntennaGainPatternContainer(uint32_t nbSats)
+    : m_useBestBeamRaster(true),
+      m_bestBeamRasterMargin(0.001),
+      m_isBestBeamRasterBuilt(false),
+      m_rasterPattern(),
+      m_bestBeamRaster(),
+      m_isMaxCoverageGainsBuilt(false),
+      m_maxCoverageGains()
 {
     NS_LOG_FUNCTION(this);
 
@@ -97,6 +122,9 @@ SatAntennaGainPatternContainer::SatAntennaGainPatternContainer(uint32_t nbSats)
             if (pathLength > 4)
             {
                 pathLength -= 4; // Size of .txt extention
+
+                // the binary file of a pattern is only a mapped copy of its text file,
+                // which is the one listed
                 if (filename.substr(pathLength) == ".txt")
                 {
                     std::string num, stem = filename.substr(0, pathLength);
@@ -235,6 +263,38 @@ SatAntennaGainPatternContainer::GetBestBeamId(uint32_t satelliteId,
 {
     NS_LOG_FUNCTION(this << satelliteId << coord.GetLatitude() << coord.GetLongitude());
 
+    if (m_useBestBeamRaster)
+    {
+        if (!m_isBestBeamRasterBuilt)
+        {
+            BuildBestBeamRaster();
+        }
+
+        uint32_t box;
+        if (m_rasterPattern &&
+            m_rasterPattern->GetGridBox(coord, m_mobilityModelMap[satelliteId], box))
+        {
+            const bestBeamCell_s& cell = m_bestBeamRaster[box];
+            if (cell.m_marginDb > m_bestBeamRasterMargin)
+            {
+                NS_LOG_LOGIC(this << " best beam " << cell.m_bestBeamId << " from the raster, "
+                                  << cell.m_marginDb << " dB above beam "
+                                  << cell.m_secondBeamId);
+                return cell.m_bestBeamId;
+            }
+        }
+    }
+
+    return EvaluateBestBeamId(satelliteId, coord, ignoreNan);
+}
+
+uint32_t
+SatAntennaGainPatternContainer::EvaluateBestBeamId(uint32_t satelliteId,
+                                                   GeoCoordinate coord,
+                                                   bool ignoreNan)
+{
+    NS_LOG_FUNCTION(this << satelliteId << coord.GetLatitude() << coord.GetLongitude());
+
     double bestGain(-100.0);
     uint32_t bestId(0);
 
@@ -278,6 +338,287 @@ SatAntennaGainPatternContainer::GetBestBeamId(uint32_t satelliteId,
     return bestId;
 }
 
+void
+SatAntennaGainPatternContainer::BuildBestBeamRaster()
+{
+    NS_LOG_FUNCTION(this);
+
+    m_isBestBeamRasterBuilt = true;
+    m_rasterPattern = nullptr;
+    m_bestBeamRaster.clear();
+
+    if (m_antennaPatternMap.empty())
+    {
+        return;
+    }
+
+    Ptr<SatAntennaGainPattern> reference = m_antennaPatternMap.begin()->second;
+    for (const auto& entry : m_antennaPatternMap)
+    {
+        if (!reference->HasSameGrid(entry.second))
+        {
+            NS_LOG_WARN(this << " antenna pattern of beam " << entry.first
+                             << " not sampled on the same grid as the other beams, the best "
+                                "beam raster is disabled");
+            return;
+        }
+    }
+
+    uint32_t latCount = reference->GetGridLatitudeCount();
+    uint32_t lonCount = reference->GetGridLongitudeCount();
+    std::size_t pointCount = (std::size_t)latCount * lonCount;
+
+    // best and second best gains of each grid point, beams being visited by
+    // increasing ids so that the lowest id wins ties as in EvaluateBestBeamId
+    std::vector<uint32_t> bestIds(pointCount, 0);
+    std::vector<uint32_t> secondIds(pointCount, 0);
+    std::vector<double> bestGains(pointCount, 0.0);
+    std::vector<double> secondGains(pointCount, 0.0);
+    std::vector<bool> allValid(pointCount, true);
+
+    for (const auto& entry : m_antennaPatternMap)
+    {
+        for (uint32_t latIndex = 0; latIndex < latCount; latIndex++)
+        {
+            for (uint32_t lonIndex = 0; lonIndex < lonCount; lonIndex++)
+            {
+                std::size_t point = latIndex * lonCount + lonIndex;
+                double gain = entry.second->GetGridGain_lin(latIndex, lonIndex);
+                if (std::isnan(gain))
+                {
+                    allValid[point] = false;
+                }
+                else if (bestIds[point] == 0 || gain > bestGains[point])
+                {
+                    secondIds[point] = bestIds[point];
+                    secondGains[point] = bestGains[point];
+                    bestIds[point] = entry.first;
+                    bestGains[point] = gain;
+                }
+                else if (secondIds[point] == 0 || gain > secondGains[point])
+                {
+                    secondIds[point] = entry.first;
+                    secondGains[point] = gain;
+                }
+            }
+        }
+    }
+
+    // The difference between the gains of two beams is bilinear in a grid
+    // box, it is positive in the whole box when it is at the four corners.
+    // The margin of the best beam of the lower left corner is thus the
+    // smallest ratio of its gain over the gain of any other beam at the
+    // corners, negative when another beam is better at a corner. Boxes with
+    // NaN gains are never looked up in the raster, the gains of all the
+    // beams are interpolated for the warnings or errors.
+    bestBeamCell_s unknown = {0, 0, -std::numeric_limits<float>::infinity()};
+    m_bestBeamRaster.assign(pointCount, unknown);
+
+    uint32_t rasterBoxes(0);
+    for (uint32_t latIndex = 0; latIndex + 1 < latCount; latIndex++)
+    {
+        for (uint32_t lonIndex = 0; lonIndex + 1 < lonCount; lonIndex++)
+        {
+            std::size_t box = latIndex * lonCount + lonIndex;
+            std::size_t corners[4] = {box, box + 1, box + lonCount, box + lonCount + 1};
+
+            bool valid = true;
+            for (std::size_t corner : corners)
+            {
+                valid = valid && allValid[corner] && bestIds[corner] != 0;
+            }
+            if (!valid)
+            {
+                continue;
+            }
+
+            bestBeamCell_s& cell = m_bestBeamRaster[box];
+            cell.m_bestBeamId = bestIds[box];
+            cell.m_marginDb = std::numeric_limits<float>::infinity();
+            Ptr<SatAntennaGainPattern> bestPattern = m_antennaPatternMap[cell.m_bestBeamId];
+            for (std::size_t corner : corners)
+            {
+                bool isBest = bestIds[corner] == cell.m_bestBeamId;
+                uint32_t otherId = isBest ? secondIds[corner] : bestIds[corner];
+                double otherGain = isBest ? secondGains[corner] : bestGains[corner];
+                double gain = bestPattern->GetGridGain_lin(corner / lonCount, corner % lonCount);
+
+                // a single beam has no other beam, its margin is infinite
+                if (otherId != 0)
+                {
+                    float marginDb = SatUtils::LinearToDb(gain / otherGain);
+                    if (marginDb < cell.m_marginDb)
+                    {
+                        cell.m_secondBeamId = otherId;
+                        cell.m_marginDb = marginDb;
+                    }
+                }
+            }
+
+            if (cell.m_marginDb > m_bestBeamRasterMargin)
+            {
+                rasterBoxes++;
+            }
+        }
+    }
+
+    m_rasterPattern = reference;
+
+    NS_LOG_INFO(this << " best beam raster of " << m_antennaPatternMap.size() << " beams: "
+                     << rasterBoxes << " of " << (latCount - 1) * (lonCount - 1)
+                     << " grid boxes with a single best beam");
+}
+
+double
+SatAntennaGainPatternContainer::GetMaxCoverageGain_lin(uint32_t coverageBeamId, uint32_t beamId)
+{
+    NS_LOG_FUNCTION(this << coverageBeamId << beamId);
+
+    if (!m_isMaxCoverageGainsBuilt)
+    {
+        BuildMaxCoverageGains();
+    }
+
+    std::map<std::pair<uint32_t, uint32_t>, double>::const_iterator it =
+        m_maxCoverageGains.find(std::make_pair(coverageBeamId, beamId));
+
+    if (it == m_maxCoverageGains.end())
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    return it->second;
+}
+
+const std::map<std::pair<uint32_t, uint32_t>, double>&
+SatAntennaGainPatternContainer::GetMaxCoverageGains()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (!m_isMaxCoverageGainsBuilt)
+    {
+        BuildMaxCoverageGains();
+    }
+
+    return m_maxCoverageGains;
+}
+
+void
+SatAntennaGainPatternContainer::BuildMaxCoverageGains()
+{
+    NS_LOG_FUNCTION(this);
+
+    m_isMaxCoverageGainsBuilt = true;
+    m_maxCoverageGains.clear();
+
+    if (m_antennaPatternMap.empty())
+    {
+        return;
+    }
+
+    Ptr<SatAntennaGainPattern> reference = m_antennaPatternMap.begin()->second;
+    for (const auto& entry : m_antennaPatternMap)
+    {
+        if (!reference->HasSameGrid(entry.second))
+        {
+            NS_LOG_WARN(this << " antenna pattern of beam " << entry.first
+                             << " not sampled on the same grid as the other beams, the gains "
+                                "over the beam coverages are not known");
+            return;
+        }
+    }
+
+    uint32_t latCount = reference->GetGridLatitudeCount();
+    uint32_t lonCount = reference->GetGridLongitudeCount();
+    std::size_t pointCount = (std::size_t)latCount * lonCount;
+    std::size_t beamCount = m_antennaPatternMap.size();
+
+    std::vector<uint32_t> beamIds;
+    std::vector<Ptr<SatAntennaGainPattern>> patterns;
+    for (const auto& entry : m_antennaPatternMap)
+    {
+        beamIds.push_back(entry.first);
+        patterns.push_back(entry.second);
+    }
+
+    // index of the best beam of each grid point, beamCount if no gain is valid
+    std::vector<std::size_t> bestBeams(pointCount, beamCount);
+    std::vector<double> bestGains(pointCount, 0.0);
+
+    for (std::size_t beam = 0; beam < beamCount; beam++)
+    {
+        for (std::size_t point = 0; point < pointCount; point++)
+        {
+            double gain = patterns[beam]->GetGridGain_lin(point / lonCount, point % lonCount);
+            if (!std::isnan(gain) && (bestBeams[point] == beamCount || gain > bestGains[point]))
+            {
+                bestBeams[point] = beam;
+                bestGains[point] = gain;
+            }
+        }
+    }
+
+    // The gains being bilinearly interpolated, the highest gain of a beam in a
+    // grid box is at a corner. It is accounted in the coverage of every beam
+    // which is the best beam at a corner of the box.
+    std::vector<double> maxGains(beamCount * beamCount, std::numeric_limits<double>::quiet_NaN());
+
+    for (std::size_t beam = 0; beam < beamCount; beam++)
+    {
+        for (uint32_t latIndex = 0; latIndex + 1 < latCount; latIndex++)
+        {
+            for (uint32_t lonIndex = 0; lonIndex + 1 < lonCount; lonIndex++)
+            {
+                std::size_t box = latIndex * lonCount + lonIndex;
+                std::size_t corners[4] = {box, box + 1, box + lonCount, box + lonCount + 1};
+
+                double boxGain = std::numeric_limits<double>::quiet_NaN();
+                for (std::size_t corner : corners)
+                {
+                    double gain =
+                        patterns[beam]->GetGridGain_lin(corner / lonCount, corner % lonCount);
+                    if (!std::isnan(gain) && (std::isnan(boxGain) || gain > boxGain))
+                    {
+                        boxGain = gain;
+                    }
+                }
+
+                if (std::isnan(boxGain))
+                {
+                    continue;
+                }
+
+                for (std::size_t corner : corners)
+                {
+                    if (bestBeams[corner] != beamCount)
+                    {
+                        double& maxGain = maxGains[bestBeams[corner] * beamCount + beam];
+                        if (std::isnan(maxGain) || boxGain > maxGain)
+                        {
+                            maxGain = boxGain;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    for (std::size_t coverage = 0; coverage < beamCount; coverage++)
+    {
+        for (std::size_t beam = 0; beam < beamCount; beam++)
+        {
+            double maxGain = maxGains[coverage * beamCount + beam];
+            if (!std::isnan(maxGain))
+            {
+                m_maxCoverageGains[std::make_pair(beamIds[coverage], beamIds[beam])] = maxGain;
+            }
+        }
+    }
+
+    NS_LOG_INFO(this << " highest gains of " << beamCount << " beams over "
+                     << m_maxCoverageGains.size() / beamCount << " beam coverages");
+}
+
 uint32_t
 SatAntennaGainPatternContainer::GetNAntennaGainPatterns() const
 {
@@ -300,6 +641,11 @@ SatAntennaGainPatternContainer::ConfigureBeamsMobility(uint32_t satelliteId,
 void
 SatAntennaGainPatternContainer::SetEnabledBeams(BeamUserInfoMap_t& info)
 {
+    // the raster and the coverage gains are built again for the enabled beams on the
+    // next request
+    m_isBestBeamRasterBuilt = false;
+    m_isMaxCoverageGainsBuilt = false;
+
     std::map<uint32_t, Ptr<SatAntennaGainPattern>>::iterator it = m_antennaPatternMap.begin();
     while (it != m_antennaPatternMap.end())
     {
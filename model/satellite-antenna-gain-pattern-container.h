@@ -41,6 +41,17 @@ class SatMobilityModel;
  * Each antenna gain pattern is stored in a separate class
  * SatAntennaGainPattern. The best beam may be chosen based on
  * the antenna patterns by using GetBestBeamId for a given position.
+ *
+ * The best beam is looked up in a raster of the grid boxes of the antenna
+ * patterns, built on the first request. The gains being bilinearly
+ * interpolated, a beam is the best one over a whole grid box when its gain
+ * is above the gains of the other beams at the four corners. The raster
+ * holds the best and second best beams of each grid box with this gain
+ * margin, and the gains of all the beams are only interpolated in the grid
+ * boxes where the margin is small, along the beam boundaries. The raster is
+ * built in the antenna pattern frame, the position of the satellite being
+ * accounted for when the position is converted to a grid box, so that it
+ * serves all the satellites.
  */
 class SatAntennaGainPatternContainer : public Object
 {
@@ -100,13 +111,98 @@ class SatAntennaGainPatternContainer : public Object
      */
     uint32_t GetBestBeamId(uint32_t satelliteId, GeoCoordinate coord, bool ignoreNan);
 
+    /**
+     * \brief Get the highest gain of the antenna pattern of a beam over the
+     * coverage of a beam, i.e. over the grid boxes in which the latter is the
+     * best beam at a corner. The gains are evaluated in the antenna pattern frame,
+     * they thus hold for any position of the satellite.
+     * \param coverageBeamId Beam id of the coverage
+     * \param beamId Beam id of the antenna pattern
+     * \return highest gain in linear format, NaN if it is not known
+     */
+    double GetMaxCoverageGain_lin(uint32_t coverageBeamId, uint32_t beamId);
+
+    /**
+     * \brief Get the highest gains of the antenna patterns over the beam coverages,
+     * see GetMaxCoverageGain_lin
+     * \return highest gains in linear format keyed by the coverage and antenna
+     * pattern beam ids, only the known ones
+     */
+    const std::map<std::pair<uint32_t, uint32_t>, double>& GetMaxCoverageGains();
+
     void ConfigureBeamsMobility(uint32_t satelliteId, Ptr<SatMobilityModel> mobility);
 
     void SetEnabledBeams(BeamUserInfoMap_t& info);
 
   private:
+    /**
+     * \brief Best beams of a grid box of the antenna patterns
+     */
+    typedef struct
+    {
+        uint32_t m_bestBeamId;
+        uint32_t m_secondBeamId;
+        float m_marginDb;
+    } bestBeamCell_s;
+
+    /**
+     * \brief Get the best beam id by interpolating the gains of all the beams
+     * \param satelliteId ID of satellite to search
+     * \param coord Geo coordinate
+     * \param ignoreNan Do not crash if a NaN value is returned
+     * \return best beam id in the specified geo coordinate
+     */
+    uint32_t EvaluateBestBeamId(uint32_t satelliteId, GeoCoordinate coord, bool ignoreNan);
+
+    /**
+     * \brief Build the best beams raster of the enabled beams
+     */
+    void BuildBestBeamRaster();
+
+    /**
+     * \brief Build the highest gains of the enabled beams over their coverages
+     */
+    void BuildMaxCoverageGains();
+
     std::string m_patternsFolder;
 
+    /**
+     * Look up the best beam in the raster of the grid boxes
+     */
+    bool m_useBestBeamRaster;
+
+    /**
+     * Gain margin in dB above which the best beam of a grid box is taken from the raster
+     */
+    double m_bestBeamRasterMargin;
+
+    /**
+     * Whether the raster has been built for the enabled beams
+     */
+    bool m_isBestBeamRasterBuilt;
+
+    /**
+     * Antenna pattern converting positions to grid boxes, 0 if the antenna
+     * patterns are not sampled on the same grid
+     */
+    Ptr<SatAntennaGainPattern> m_rasterPattern;
+
+    /**
+     * Best beams of each grid box, indexed by its lower left corner, latitude by latitude
+     */
+    std::vector<bestBeamCell_s> m_bestBeamRaster;
+
+    /**
+     * Whether the highest gains over the coverages have been built for the enabled beams
+     */
+    bool m_isMaxCoverageGainsBuilt;
+
+    /**
+     * Highest gain in linear format of the antenna pattern of a beam over the
+     * coverage of a beam, keyed by the coverage and antenna pattern beam ids
+     */
+    std::map<std::pair<uint32_t, uint32_t>, double> m_maxCoverageGains;
+
     /**
      * Container of antenna patterns
      */
@@ -20,20 +20,36 @@
 
 #include "satellite-antenna-gain-pattern.h"
 
+#include "satellite-table-bundle.h"
 #include "satellite-utils.h"
 
+#include "ns3/boolean.h"
 #include "ns3/double.h"
+#include "ns3/enum.h"
 #include "ns3/log.h"
 
 #include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
 #include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 NS_LOG_COMPONENT_DEFINE("SatAntennaGainPattern");
 
 namespace ns3
 {
 
-const std::string SatAntennaGainPattern::m_nanStringArray[4] = {"nan", "NaN", "Nan", "NAN"};
+/// Magic number at the start of a binary antenna pattern file
+static const char PATTERN_MAGIC[8] = {'S', 'N', 'S', '3', 'A', 'G', 'P', '\0'};
+
+/// Version of the binary antenna pattern format, to be increased on any layout change
+static const uint32_t PATTERN_VERSION = 3;
+
+/// Written in native byte order, detects files converted on another architecture
+static const uint64_t PATTERN_BYTE_ORDER = 0x0102030405060708ULL;
 
 NS_OBJECT_ENSURE_REGISTERED(SatAntennaGainPattern);
 
@@ -49,7 +65,23 @@ SatAntennaGainPattern::GetTypeId(void)
                 "Minimum acceptable antenna gain in dBs",
                 DoubleValue(48.0),
                 MakeDoubleAccessor(&SatAntennaGainPattern::m_minAcceptableAntennaGainInDb),
-                MakeDoubleChecker<double>());
+                MakeDoubleChecker<double>())
+            .AddAttribute("UseBinaryPattern",
+                          "Map the binary file of the pattern, if up to date, instead of "
+                          "parsing the text file.",
+                          BooleanValue(true),
+                          MakeBooleanAccessor(&SatAntennaGainPattern::m_useBinaryPattern),
+                          MakeBooleanChecker())
+            .AddAttribute("RandomPositionMode",
+                          "How GetValidRandomPosition draws a grid cell: among the cells whose "
+                          "four corners are valid, or by drawing valid positions until one is "
+                          "such a cell, as in previous versions.",
+                          EnumValue(SatAntennaGainPattern::RANDOM_POSITION_VALID_CELLS),
+                          MakeEnumAccessor(&SatAntennaGainPattern::m_randomPositionMode),
+                          MakeEnumChecker(SatAntennaGainPattern::RANDOM_POSITION_VALID_CELLS,
+                                          "ValidCells",
+                                          SatAntennaGainPattern::RANDOM_POSITION_REJECTION,
+                                          "Rejection"));
     return tid;
 }
 
@@ -60,8 +92,20 @@ SatAntennaGainPattern::GetInstanceTypeId(void) const
 }
 
 SatAntennaGainPattern::SatAntennaGainPattern()
-    : m_antennaPattern(),
+    : m_gains(0),
+      m_textGains(),
+      m_linearGains(0),
+      m_textLinearGains(),
+      m_validBoxes(0),
+      m_textValidBoxes(),
+      m_mapping(0),
+      m_mappingSize(0),
+      m_useBinaryPattern(true),
       m_validPositions(),
+      m_validCells(),
+      m_isValidCell(),
+      m_rejectionCellCount(0),
+      m_randomPositionMode(RANDOM_POSITION_VALID_CELLS),
       m_minAcceptableAntennaGainInDb(40.0),
       m_uniformRandomVariable(),
       m_latitudes(),
@@ -72,17 +116,24 @@ SatAntennaGainPattern::SatAntennaGainPattern()
       m_maxLon(0.0),
       m_latInterval(0.0),
       m_lonInterval(0.0),
+      m_latInvInterval(0.0),
+      m_lonInvInterval(0.0),
       m_latDefaultSatellite(0.0),
-      m_lonDefaultSatellite(0.0),
-      m_nanStrings()
+      m_lonDefaultSatellite(0.0)
 {
     // Do nothing here
 }
 
 SatAntennaGainPattern::SatAntennaGainPattern(std::string filePathName,
                                              GeoCoordinate defaultSatellitePosition)
-    : m_nanStrings(m_nanStringArray,
-                   m_nanStringArray + (sizeof m_nanStringArray / sizeof m_nanStringArray[0]))
+    : m_gains(0),
+      m_linearGains(0),
+      m_validBoxes(0),
+      m_mapping(0),
+      m_mappingSize(0),
+      m_useBinaryPattern(true),
+      m_rejectionCellCount(0),
+      m_randomPositionMode(RANDOM_POSITION_VALID_CELLS)
 {
     // Attributes are needed already in construction phase:
     // - ConstructSelf call in constructor
@@ -92,10 +143,27 @@ SatAntennaGainPattern::SatAntennaGainPattern(std::string filePathName,
     m_latDefaultSatellite = defaultSatellitePosition.GetLatitude();
     m_lonDefaultSatellite = defaultSatellitePosition.GetLongitude();
 
-    ReadAntennaPatternFromFile(filePathName);
+    if (!m_useBinaryPattern || !MapAntennaPatternFromBinary(filePathName))
+    {
+        ReadAntennaPatternFromFile(filePathName);
+        BuildLinearGrid();
+    }
+    BuildValidPositions();
+
+    m_latInvInterval = 1.0 / m_latInterval;
+    m_lonInvInterval = 1.0 / m_lonInterval;
+
     m_uniformRandomVariable = CreateObject<UniformRandomVariable>();
 }
 
+SatAntennaGainPattern::~SatAntennaGainPattern()
+{
+    if (m_mapping != 0)
+    {
+        munmap(m_mapping, m_mappingSize);
+    }
+}
+
 void
 SatAntennaGainPattern::ReadAntennaPatternFromFile(std::string filePathName)
 {
@@ -117,11 +185,8 @@ SatAntennaGainPattern::ReadAntennaPatternFromFile(std::string filePathName)
         }
     }
 
-    // Row vector containing all the gain values for a certain latitude
-    std::vector<double> rowVector;
-
     // Start conditions
-    double lat, lon, gainDouble;
+    double lat, lon;
     std::string gainString;
     bool firstRowDone(false);
 
@@ -137,24 +202,9 @@ SatAntennaGainPattern::ReadAntennaPatternFromFile(std::string filePathName)
                            << lat << " or longitude. " << lon);
         }
 
-        // The antenna gain value is read to a string, so that we may check
-        // that whether the value is NaN. If not, then the number is just converted
-        // to a double.
-        if (find(m_nanStrings.begin(), m_nanStrings.end(), gainString) != m_nanStrings.end())
-        {
-            gainDouble = NAN;
-        }
-        else
-        {
-            gainDouble = atof(gainString.c_str());
-
-            // Add the position to valid positions vector if the gain is
-            // above a specified threshold.
-            if (gainDouble >= m_minAcceptableAntennaGainInDb)
-            {
-                m_validPositions.push_back(std::make_pair(lat, lon));
-            }
-        }
+        // The antenna gain value is read to a string, as stream extraction
+        // does not accept NaN. strtod accepts any case of the NaN spelling.
+        m_textGains.push_back(std::strtod(gainString.c_str(), 0));
 
         // Collect the valid latitude values
         if (!m_latitudes.empty())
@@ -169,6 +219,8 @@ SatAntennaGainPattern::ReadAntennaPatternFromFile(std::string filePathName)
         else
         {
             m_latitudes.push_back(lat);
+            m_minLat = lat;
+            m_minLon = lon;
         }
 
         // Collect the valid longitude values
@@ -185,29 +237,6 @@ SatAntennaGainPattern::ReadAntennaPatternFromFile(std::string filePathName)
             m_longitudes.push_back(lon);
         }
 
-        // If this is the first gain entry
-        if (rowVector.empty())
-        {
-            m_minLat = lat;
-            m_minLon = lon;
-            rowVector.push_back(gainDouble);
-        }
-        // We are still in the same row (= latitude)
-        else if (lat == m_maxLat)
-        {
-            rowVector.push_back(gainDouble);
-        }
-        // Latitude changed
-        // - Store the vector
-        // - Clean-up
-        // - Start from another row
-        else
-        {
-            m_antennaPattern.push_back(rowVector);
-            rowVector.clear();
-            rowVector.push_back(gainDouble);
-        }
-
         // Update the maximum values
         m_maxLat = lat;
         m_maxLon = lon;
@@ -216,17 +245,265 @@ SatAntennaGainPattern::ReadAntennaPatternFromFile(std::string filePathName)
         *ifs >> lat >> lon >> gainString;
     }
 
-    // At this point, the last row should not be stored, since the storing
-    // happens every time the row changes. I.e. the last row is stored here!
-    NS_ASSERT(rowVector.size() == m_longitudes.size());
+    // Every latitude holds a gain for every longitude
+    if (m_textGains.size() != m_latitudes.size() * m_longitudes.size())
+    {
+        NS_FATAL_ERROR("SatAntennaGainPattern::ReadAntennaPatternFromFile - The file "
+                       << filePathName << " is not a complete latitude-longitude grid.");
+    }
+
+    // The interpolation needs a grid box
+    if (m_latitudes.size() < 2 || m_longitudes.size() < 2)
+    {
+        NS_FATAL_ERROR("SatAntennaGainPattern::ReadAntennaPatternFromFile - The file "
+                       << filePathName << " holds less than two latitudes or longitudes.");
+    }
 
-    m_antennaPattern.push_back(rowVector);
-    rowVector.clear();
+    m_gains = m_textGains.data();
 
     ifs->close();
     delete ifs;
 }
 
+bool
+SatAntennaGainPattern::MapAntennaPatternFromBinary(std::string filePathName)
+{
+    NS_LOG_FUNCTION(this << filePathName);
+
+    std::string binaryPath = GetBinaryPath(filePathName);
+    int fd = open(binaryPath.c_str(), O_RDONLY);
+
+    if (fd < 0 && filePathName[0] != '/')
+    {
+        // script might be launched by test.py, try a different base path
+        filePathName = "../../" + filePathName;
+        binaryPath = GetBinaryPath(filePathName);
+        fd = open(binaryPath.c_str(), O_RDONLY);
+    }
+
+    if (fd < 0)
+    {
+        NS_LOG_INFO("No binary antenna pattern at " << binaryPath << ", text file is used");
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (uint64_t)st.st_size < sizeof(binaryHeader_s))
+    {
+        NS_LOG_WARN("Binary antenna pattern " << binaryPath << " is truncated, text file is used");
+        close(fd);
+        return false;
+    }
+
+    // the mapping stays valid after the descriptor is closed
+    void* mapping = mmap(0, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (mapping == MAP_FAILED)
+    {
+        NS_LOG_WARN("Binary antenna pattern " << binaryPath
+                                              << " cannot be mapped, text file is used");
+        return false;
+    }
+
+    const binaryHeader_s* header = static_cast<const binaryHeader_s*>(mapping);
+    uint64_t axisCount = (uint64_t)header->m_latCount + header->m_lonCount;
+    uint64_t linearGainsOffset, validBoxesOffset;
+
+    if (std::memcmp(header->m_magic, PATTERN_MAGIC, sizeof(PATTERN_MAGIC)) != 0 ||
+        header->m_version != PATTERN_VERSION || header->m_byteOrder != PATTERN_BYTE_ORDER ||
+        header->m_latCount < 2 || header->m_lonCount < 2 ||
+        (uint64_t)st.st_size != GetBinarySize(header->m_latCount,
+                                              header->m_lonCount,
+                                              linearGainsOffset,
+                                              validBoxesOffset))
+    {
+        NS_LOG_WARN("Binary antenna pattern " << binaryPath
+                                              << " has an unsupported format, text file is used");
+        munmap(mapping, st.st_size);
+        return false;
+    }
+
+    uint64_t sourceSize, sourceHash;
+    if (SatTableBundle::GetSourceDigest(filePathName, sourceSize, sourceHash) &&
+        (sourceSize != header->m_sourceSize || sourceHash != header->m_sourceHash))
+    {
+        NS_LOG_INFO("Binary antenna pattern " << binaryPath << " is stale, text file is used");
+        munmap(mapping, st.st_size);
+        return false;
+    }
+
+    m_mapping = mapping;
+    m_mappingSize = st.st_size;
+
+    const double* axes = reinterpret_cast<const double*>(header + 1);
+    m_latitudes.assign(axes, axes + header->m_latCount);
+    m_longitudes.assign(axes + header->m_latCount, axes + axisCount);
+    m_gains = axes + axisCount;
+    m_linearGains =
+        reinterpret_cast<const float*>(static_cast<const char*>(mapping) + linearGainsOffset);
+    m_validBoxes =
+        reinterpret_cast<const uint64_t*>(static_cast<const char*>(mapping) + validBoxesOffset);
+
+    m_minLat = header->m_minLat;
+    m_minLon = header->m_minLon;
+    m_maxLat = m_latitudes.back();
+    m_maxLon = m_longitudes.back();
+    m_latInterval = header->m_latInterval;
+    m_lonInterval = header->m_lonInterval;
+
+    NS_LOG_INFO("Binary antenna pattern " << binaryPath << " mapped with " << m_latitudes.size()
+                                          << " x " << m_longitudes.size() << " gains");
+
+    return true;
+}
+
+void
+SatAntennaGainPattern::WriteAntennaPatternToBinary(std::string filePathName) const
+{
+    NS_LOG_FUNCTION(this << filePathName);
+
+    binaryHeader_s header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.m_magic, PATTERN_MAGIC, sizeof(PATTERN_MAGIC));
+    header.m_version = PATTERN_VERSION;
+    header.m_latCount = m_latitudes.size();
+    header.m_lonCount = m_longitudes.size();
+    header.m_byteOrder = PATTERN_BYTE_ORDER;
+    header.m_minLat = m_minLat;
+    header.m_minLon = m_minLon;
+    header.m_latInterval = m_latInterval;
+    header.m_lonInterval = m_lonInterval;
+
+    if (!SatTableBundle::GetSourceDigest(filePathName, header.m_sourceSize, header.m_sourceHash))
+    {
+        NS_FATAL_ERROR("SatAntennaGainPattern::WriteAntennaPatternToBinary - The file "
+                       << filePathName << " is not found.");
+    }
+
+    // write aside and rename, running simulations keep their mapping of the previous file
+    std::string binaryPath = GetBinaryPath(filePathName);
+    std::string tmpPath = binaryPath + ".tmp";
+    std::ofstream ofs(tmpPath.c_str(), std::ofstream::out | std::ofstream::binary);
+
+    if (!ofs.is_open())
+    {
+        NS_FATAL_ERROR("SatAntennaGainPattern::WriteAntennaPatternToBinary - The file "
+                       << tmpPath << " cannot be created.");
+    }
+
+    ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    ofs.write(reinterpret_cast<const char*>(m_latitudes.data()),
+              m_latitudes.size() * sizeof(double));
+    ofs.write(reinterpret_cast<const char*>(m_longitudes.data()),
+              m_longitudes.size() * sizeof(double));
+    ofs.write(reinterpret_cast<const char*>(m_gains),
+              m_latitudes.size() * m_longitudes.size() * sizeof(double));
+
+    uint64_t linearGainsOffset, validBoxesOffset;
+    uint64_t size =
+        GetBinarySize(m_latitudes.size(), m_longitudes.size(), linearGainsOffset, validBoxesOffset);
+    uint64_t linearGainsSize = m_latitudes.size() * m_longitudes.size() * sizeof(float);
+    ofs.write(reinterpret_cast<const char*>(m_linearGains), linearGainsSize);
+
+    // pad the linear gains, so that the bitmap words are aligned in the mapping
+    const char padding[8] = {0};
+    ofs.write(padding, validBoxesOffset - linearGainsOffset - linearGainsSize);
+    ofs.write(reinterpret_cast<const char*>(m_validBoxes), size - validBoxesOffset);
+    ofs.close();
+
+    if (ofs.fail() || std::rename(tmpPath.c_str(), binaryPath.c_str()) != 0)
+    {
+        NS_FATAL_ERROR("SatAntennaGainPattern::WriteAntennaPatternToBinary - The file "
+                       << binaryPath << " cannot be written.");
+    }
+}
+
+std::string
+SatAntennaGainPattern::GetBinaryPath(std::string filePathName)
+{
+    std::string::size_type length = filePathName.size();
+    if (length > 4 && filePathName.compare(length - 4, 4, ".txt") == 0)
+    {
+        return filePathName.substr(0, length - 4) + ".bin";
+    }
+
+    return filePathName + ".bin";
+}
+
+void
+SatAntennaGainPattern::ConvertToBinary(std::string filePathName)
+{
+    NS_LOG_FUNCTION(filePathName);
+
+    Ptr<SatAntennaGainPattern> pattern = CreateObject<SatAntennaGainPattern>();
+    pattern->ReadAntennaPatternFromFile(filePathName);
+    pattern->BuildLinearGrid();
+    pattern->WriteAntennaPatternToBinary(filePathName);
+}
+
+void
+SatAntennaGainPattern::BuildValidPositions()
+{
+    NS_LOG_FUNCTION(this);
+
+    m_validPositions.clear();
+    m_validCells.clear();
+
+    uint32_t latCount = m_latitudes.size();
+    uint32_t lonCount = m_longitudes.size();
+
+    // Add the position to valid positions vector if the gain is
+    // above a specified threshold. NaN gains are never valid.
+    for (uint32_t latIndex = 0; latIndex < latCount; latIndex++)
+    {
+        for (uint32_t lonIndex = 0; lonIndex < lonCount; lonIndex++)
+        {
+            if (GetGridGainDb(latIndex, lonIndex) >= m_minAcceptableAntennaGainInDb)
+            {
+                // the position is the lower left corner of a cell whose
+                // four corners are valid
+                if (latIndex + 1 < latCount && lonIndex + 1 < lonCount &&
+                    GetGridGainDb(latIndex, lonIndex + 1) >= m_minAcceptableAntennaGainInDb &&
+                    GetGridGainDb(latIndex + 1, lonIndex) >= m_minAcceptableAntennaGainInDb &&
+                    GetGridGainDb(latIndex + 1, lonIndex + 1) >= m_minAcceptableAntennaGainInDb)
+                {
+                    m_validCells.push_back(m_validPositions.size());
+                }
+
+                m_validPositions.push_back(
+                    std::make_pair(m_latitudes[latIndex], m_longitudes[lonIndex]));
+            }
+        }
+    }
+
+    // The rejection sampling looks the three other corners up by value, the
+    // positions holding them are flagged once with the same comparisons
+    std::vector<std::pair<double, double>> sortedPositions(m_validPositions);
+    std::sort(sortedPositions.begin(), sortedPositions.end());
+
+    m_isValidCell.assign(m_validPositions.size(), false);
+    m_rejectionCellCount = 0;
+    for (uint32_t i = 0; i < m_validPositions.size(); i++)
+    {
+        std::pair<double, double> lowerLeftCoord = m_validPositions[i];
+        std::pair<double, double> upperLeft(lowerLeftCoord.first + m_latInterval,
+                                            lowerLeftCoord.second);
+        std::pair<double, double> upperRight(upperLeft.first,
+                                             lowerLeftCoord.second + m_lonInterval);
+        std::pair<double, double> lowerRight(lowerLeftCoord.first, upperRight.second);
+
+        m_isValidCell[i] =
+            std::binary_search(sortedPositions.begin(), sortedPositions.end(), upperLeft) &&
+            std::binary_search(sortedPositions.begin(), sortedPositions.end(), upperRight) &&
+            std::binary_search(sortedPositions.begin(), sortedPositions.end(), lowerRight);
+        m_rejectionCellCount += m_isValidCell[i];
+    }
+
+    NS_LOG_INFO(this << " " << m_validPositions.size() << " valid positions, "
+                     << m_validCells.size() << " valid cells");
+}
+
 void
 SatAntennaGainPattern::GetSatelliteOffset(double& latOffset,
                                           double& lonOffset,
@@ -249,6 +526,67 @@ SatAntennaGainPattern::GetSatelliteOffset(double& latOffset,
                       << latOffset << " / " << lonOffset);
 }
 
+bool
+SatAntennaGainPattern::HasSameGrid(Ptr<const SatAntennaGainPattern> other) const
+{
+    NS_LOG_FUNCTION(this << other);
+
+    return m_latitudes == other->m_latitudes && m_longitudes == other->m_longitudes &&
+           m_latDefaultSatellite == other->m_latDefaultSatellite &&
+           m_lonDefaultSatellite == other->m_lonDefaultSatellite;
+}
+
+uint32_t
+SatAntennaGainPattern::GetGridLatitudeCount() const
+{
+    return m_latitudes.size();
+}
+
+uint32_t
+SatAntennaGainPattern::GetGridLongitudeCount() const
+{
+    return m_longitudes.size();
+}
+
+double
+SatAntennaGainPattern::GetGridGain_lin(uint32_t latIndex, uint32_t lonIndex) const
+{
+    NS_LOG_FUNCTION(this << latIndex << lonIndex);
+
+    if (std::isnan(GetGridGainDb(latIndex, lonIndex)))
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    return m_linearGains[latIndex * m_longitudes.size() + lonIndex];
+}
+
+bool
+SatAntennaGainPattern::GetGridBox(GeoCoordinate coord,
+                                  Ptr<SatMobilityModel> mobility,
+                                  uint32_t& box) const
+{
+    NS_LOG_FUNCTION(this << coord.GetLatitude() << coord.GetLongitude());
+
+    double satLatOffset, satLonOffset;
+    GetSatelliteOffset(satLatOffset, satLonOffset, mobility);
+
+    double latitude = coord.GetLatitude() + satLatOffset;
+    double longitude = coord.GetLongitude() + satLonOffset;
+
+    if (m_minLat > latitude || latitude > m_maxLat || m_minLon > longitude || longitude > m_maxLon)
+    {
+        return false;
+    }
+
+    double latPosition, lonPosition;
+    std::size_t latIndex, lonIndex;
+    FindGridBox(latitude, longitude, latPosition, lonPosition, latIndex, lonIndex);
+    box = latIndex * m_longitudes.size() + lonIndex;
+
+    return true;
+}
+
 GeoCoordinate
 SatAntennaGainPattern::GetValidRandomPosition(Ptr<SatMobilityModel> mobility) const
 {
@@ -257,48 +595,38 @@ SatAntennaGainPattern::GetValidRandomPosition(Ptr<SatMobilityModel> mobility) co
     double satLatOffset, satLonOffset;
     GetSatelliteOffset(satLatOffset, satLonOffset, mobility);
 
-    uint32_t numPosGridPoints = m_validPositions.size();
-    uint32_t ind(0);
     std::pair<double, double> lowerLeftCoord;
 
-    while (1)
+    if (m_randomPositionMode == RANDOM_POSITION_VALID_CELLS)
     {
-        // Get random position (=lower left corner of a grid) from the valid ones
-        ind = m_uniformRandomVariable->GetInteger(0, numPosGridPoints - 1);
-        lowerLeftCoord = m_validPositions[ind];
-
-        // Test if the three other corners for interpolation are found.
-        // If they do not, loop again to find another position.
-
-        std::pair<double, double> testPos;
-
-        // Upper left corner
-        testPos.first = lowerLeftCoord.first + m_latInterval;
-        testPos.second = lowerLeftCoord.second;
-        if (find(m_validPositions.begin(), m_validPositions.end(), testPos) ==
-            m_validPositions.end())
+        if (m_validCells.empty())
         {
-            continue;
+            NS_FATAL_ERROR("SatAntennaGainPattern::GetValidRandomPosition - No cell with four "
+                           "valid corners in the antenna pattern");
         }
 
-        // Upper right corner
-        testPos.second = lowerLeftCoord.second + m_lonInterval;
-        if (find(m_validPositions.begin(), m_validPositions.end(), testPos) ==
-            m_validPositions.end())
+        // Get random position (=lower left corner of a grid) from the valid cells
+        uint32_t ind = m_uniformRandomVariable->GetInteger(0, m_validCells.size() - 1);
+        lowerLeftCoord = m_validPositions[m_validCells[ind]];
+    }
+    else
+    {
+        if (m_rejectionCellCount == 0)
         {
-            continue;
+            NS_FATAL_ERROR("SatAntennaGainPattern::GetValidRandomPosition - No cell with four "
+                           "valid corners in the antenna pattern");
         }
 
-        // Lower right corner
-        testPos.first = lowerLeftCoord.first;
-        if (find(m_validPositions.begin(), m_validPositions.end(), testPos) ==
-            m_validPositions.end())
+        // Get random position (=lower left corner of a grid) from the valid ones,
+        // until the three other corners for interpolation are found.
+        uint32_t numPosGridPoints = m_validPositions.size();
+        uint32_t ind(0);
+        do
         {
-            continue;
-        }
+            ind = m_uniformRandomVariable->GetInteger(0, numPosGridPoints - 1);
+        } while (!m_isValidCell[ind]);
 
-        // None of the previous checks triggered, thus we have a valid position.
-        break;
+        lowerLeftCoord = m_validPositions[ind];
     }
 
     // Pick a random position within a grid square
@@ -344,68 +672,102 @@ SatAntennaGainPattern::GetAntennaGain_lin(GeoCoordinate coord, Ptr<SatMobilityMo
         return std::numeric_limits<double>::quiet_NaN();
     }
 
-    // Calculate the minimum grid point {minLatIndex, minLonIndex} for the given {latitude,
-    // longitude} point
-    uint32_t minLatIndex = (uint32_t)(std::floor(std::abs(latitude - m_minLat) / m_latInterval));
-    uint32_t minLonIndex = (uint32_t)(std::floor(std::abs(longitude - m_minLon) / m_lonInterval));
+    double gain = InterpolateGain(latitude, longitude);
 
     // All the values within the grid box has to be valid! If UT is placed (or
     // is moving outside) the valid simulation area, the simulation will crash
     // to a fatal error.
-    if (std::isnan(m_antennaPattern[minLatIndex][minLonIndex]) ||
-        std::isnan(m_antennaPattern[minLatIndex][minLonIndex + 1]) ||
-        std::isnan(m_antennaPattern[minLatIndex + 1][minLonIndex]) ||
-        std::isnan(m_antennaPattern[minLatIndex + 1][minLonIndex + 1]))
+    if (std::isnan(gain))
     {
         NS_LOG_WARN(this << ", some value(s) of the interpolated grid point(s) is/are NAN!");
-        return std::numeric_limits<double>::quiet_NaN();
     }
 
-    /**
-     * 4-point bilinear interpolation
-     * R(x, y1) = (x2 - x)/(x2 - x1) * Q(x1, y1)) + (x - x1)/(x2 - x1) * Q(x2, y1);
-     * R(x, y2) = (x2 - x)/(x2 - x1) * Q(x1, y2)) + (x - x1)/(x2 - x1) * Q(x2, y2);
-     * R = (y2 - y)/(y2 - y1) * R(x, y1) + (y - y1)/(y2 - y1) * R(x, y2);
-     */
-
-    // Longitude direction with latitude minLatIndex
-    double upperLonShare = (m_longitudes[minLonIndex + 1] - longitude) / m_lonInterval;
-    double lowerLonShare = (longitude - m_longitudes[minLonIndex]) / m_lonInterval;
-
-    // Change the gains to linear values , because the interpolation is done in linear domain.
-    double G11 = SatUtils::DbToLinear(m_antennaPattern[minLatIndex][minLonIndex]);
-    double G12 = SatUtils::DbToLinear(m_antennaPattern[minLatIndex][minLonIndex + 1]);
-    double G21 = SatUtils::DbToLinear(m_antennaPattern[minLatIndex + 1][minLonIndex]);
-    double G22 = SatUtils::DbToLinear(m_antennaPattern[minLatIndex + 1][minLonIndex + 1]);
-
-    // Longitude direction with latitude minLatIndex
-    double valLatLower = upperLonShare * G11 + lowerLonShare * G12;
-
-    // Longitude direction with latitude minLatIndex+1
-    double valLatUpper = upperLonShare * G21 + lowerLonShare * G22;
-
-    // Latitude direction with longitude "longitude"
-    double gain = ((m_latitudes[minLatIndex + 1] - latitude) / m_latInterval) * valLatLower +
-                  ((latitude - m_latitudes[minLatIndex]) / m_latInterval) * valLatUpper;
-
-    /*
-    std::cout << "minLonIndex = " << minLonIndex <<
-        ", minLatIndex = " << minLatIndex <<
-        ", m_lonInterval = " << m_lonInterval <<
-        ", m_LatInterval = " << m_latInterval <<
-        ", x1 = " << m_longitudes[minLonIndex] <<
-        ", y1 = " << m_latitudes[minLatIndex] <<
-        ", x2 = " << m_longitudes[minLonIndex+1] <<
-        ", y2 = " << m_latitudes[minLatIndex+1] <<
-        ", G(x1, y1) = " << m_antennaPattern[minLatIndex][minLonIndex] <<
-        ", G(x1, y2) = " << m_antennaPattern[minLatIndex+1][minLonIndex] <<
-        ", G(x2, y1) = " << m_antennaPattern[minLatIndex][minLonIndex+1] <<
-        ", G(x2, y2) = " << m_antennaPattern[minLatIndex+1][minLonIndex+1] <<
-        ", x = " << longitude <<
-        ", y = " << latitude <<
-        ", interpolated gain: " << gain << std::endl;
-     */
     return gain;
 }
 
+void
+SatAntennaGainPattern::GetAntennaGains_lin(const std::vector<GeoCoordinate>& coords,
+                                           Ptr<SatMobilityModel> mobility,
+                                           std::vector<double>& gains) const
+{
+    NS_LOG_FUNCTION(this << coords.size());
+
+    double satLatOffset, satLonOffset;
+    GetSatelliteOffset(satLatOffset, satLonOffset, mobility);
+
+    gains.resize(coords.size());
+    for (std::size_t i = 0; i < coords.size(); i++)
+    {
+        double latitude = coords[i].GetLatitude() + satLatOffset;
+        double longitude = coords[i].GetLongitude() + satLonOffset;
+
+        bool inRange = m_minLat <= latitude && latitude <= m_maxLat && m_minLon <= longitude &&
+                       longitude <= m_maxLon;
+
+        // the interpolation clamps its grid box, an out of range position is
+        // interpolated in a border box and discarded
+        double gain = InterpolateGain(latitude, longitude);
+        gains[i] = inRange ? gain : std::numeric_limits<double>::quiet_NaN();
+    }
+}
+
+void
+SatAntennaGainPattern::BuildLinearGrid()
+{
+    NS_LOG_FUNCTION(this);
+
+    uint32_t latCount = m_latitudes.size();
+    uint32_t lonCount = m_longitudes.size();
+
+    // NaN gains are stored as 0, so that the interpolation does not branch
+    // on them, and their grid boxes are flagged invalid instead
+    m_textLinearGains.assign((std::size_t)latCount * lonCount, 0.0f);
+    m_textValidBoxes.assign(((std::size_t)latCount * lonCount + 63) / 64, 0);
+
+    for (uint32_t latIndex = 0; latIndex < latCount; latIndex++)
+    {
+        for (uint32_t lonIndex = 0; lonIndex < lonCount; lonIndex++)
+        {
+            double gainDb = GetGridGainDb(latIndex, lonIndex);
+            if (!std::isnan(gainDb))
+            {
+                m_textLinearGains[latIndex * lonCount + lonIndex] = SatUtils::DbToLinear(gainDb);
+            }
+        }
+    }
+
+    for (uint32_t latIndex = 0; latIndex + 1 < latCount; latIndex++)
+    {
+        for (uint32_t lonIndex = 0; lonIndex + 1 < lonCount; lonIndex++)
+        {
+            if (!std::isnan(GetGridGainDb(latIndex, lonIndex)) &&
+                !std::isnan(GetGridGainDb(latIndex, lonIndex + 1)) &&
+                !std::isnan(GetGridGainDb(latIndex + 1, lonIndex)) &&
+                !std::isnan(GetGridGainDb(latIndex + 1, lonIndex + 1)))
+            {
+                std::size_t box = (std::size_t)latIndex * lonCount + lonIndex;
+                m_textValidBoxes[box / 64] |= (uint64_t)1 << (box % 64);
+            }
+        }
+    }
+
+    m_linearGains = m_textLinearGains.data();
+    m_validBoxes = m_textValidBoxes.data();
+}
+
+uint64_t
+SatAntennaGainPattern::GetBinarySize(uint64_t latCount,
+                                     uint64_t lonCount,
+                                     uint64_t& linearGainsOffset,
+                                     uint64_t& validBoxesOffset)
+{
+    uint64_t gainCount = latCount * lonCount;
+    linearGainsOffset = sizeof(binaryHeader_s) + (latCount + lonCount + gainCount) * sizeof(double);
+
+    // the bitmap words are aligned on 8 bytes
+    uint64_t linearGainsEnd = linearGainsOffset + gainCount * sizeof(float);
+    validBoxesOffset = (linearGainsEnd + 7) / 8 * 8;
+    return validBoxesOffset + (gainCount + 63) / 64 * sizeof(uint64_t);
+}
+
 } // namespace ns3
@@ -28,7 +28,10 @@
 #include <ns3/random-variable-stream.h>
 #include <ns3/traced-callback.h>
 
+#include <algorithm>
 #include <fstream>
+#include <limits>
+#include <stdint.h>
 #include <vector>
 
 namespace ns3
@@ -40,19 +43,40 @@ namespace ns3
  * for a one single spot-beam. In initialization phase, the gain pattern
  * is read from a file to a container. Current implementation assumes
  * that the antenna pattern is using a constant longitude-latitude grid of
- * samples. This assumption is made to enable fast look-ups from the container
- * (= vector<vector<double>>).
+ * samples, of at least two latitudes and two longitudes. This assumption is
+ * made to enable fast look-ups from the container, a contiguous array of
+ * gains in dB, latitude by latitude.
+ *
+ * The pattern may also be stored in a binary file next to the text file,
+ * with the .bin extension instead of .txt, written by the
+ * sat-convert-antenna-patterns program. The binary file also holds the linear
+ * gains and the valid grid boxes described below. It is memory mapped
+ * read-only, so that the simulations running on a host share its pages. It
+ * is ignored when the size or the content hash of the text file differ from
+ * the ones recorded at the conversion.
  *
  * Antenna gain patter is used also for spot-beam selection. In initialization phase
  * a valid positions list is constructed based on a minimum accepted antenna gain set
- * as an attribute. This approach is selected to speed up the random UT positioning.
+ * as an attribute, along with the list of grid cells whose four corners are valid
+ * positions. This approach is selected to speed up the random UT positioning.
  *
  * Antenna gain value for a given longitude and latitude position is calculated by
- * using 4-point bilinear interpolation.
+ * using 4-point bilinear interpolation in linear domain. The gains are converted
+ * once to linear values, with a bitmap of the grid boxes whose four corners
+ * are valid, so that a look-up is a few multiply-adds.
  */
 class SatAntennaGainPattern : public Object
 {
   public:
+    /**
+     * \brief Drawing of the grid cell of a random position
+     */
+    enum RandomPositionMode
+    {
+        RANDOM_POSITION_VALID_CELLS,
+        RANDOM_POSITION_REJECTION
+    };
+
     /**
      * \brief Get the type ID
      * \return the object TypeId
@@ -77,9 +101,7 @@ class SatAntennaGainPattern : public Object
      */
     SatAntennaGainPattern(std::string filePathName, GeoCoordinate defaultSatellitePosition);
 
-    ~SatAntennaGainPattern()
-    {
-    }
+    ~SatAntennaGainPattern();
 
     /**
      * \brief Calculate the antenna gain value for a certain {latitude, longitude} point
@@ -88,6 +110,17 @@ class SatAntennaGainPattern : public Object
      */
     double GetAntennaGain_lin(GeoCoordinate coord, Ptr<SatMobilityModel> mobility) const;
 
+    /**
+     * \brief Calculate the antenna gain values for many {latitude, longitude} points
+     * \param coords The points
+     * \param mobility The mobility model of the associated satellite
+     * \param gains The gain values in linear format, NaN for the points out of the
+     * pattern coverage
+     */
+    void GetAntennaGains_lin(const std::vector<GeoCoordinate>& coords,
+                             Ptr<SatMobilityModel> mobility,
+                             std::vector<double>& gains) const;
+
     /**
      * \brief Get a valid random position under this spot-beam coverage.
      * \param mobility The mobility model of the associated satellite
@@ -109,7 +142,80 @@ class SatAntennaGainPattern : public Object
                             double& lonOffset,
                             Ptr<SatMobilityModel> mobility) const;
 
+    /**
+     * \brief Check if another antenna pattern is sampled on the same grid,
+     * for the same default satellite position
+     * \param other The other antenna pattern
+     * \return Whether the grid boxes of both patterns cover the same positions
+     */
+    bool HasSameGrid(Ptr<const SatAntennaGainPattern> other) const;
+
+    /**
+     * \brief Get the number of latitudes of the grid
+     * \return The number of latitudes
+     */
+    uint32_t GetGridLatitudeCount() const;
+
+    /**
+     * \brief Get the number of longitudes of the grid
+     * \return The number of longitudes
+     */
+    uint32_t GetGridLongitudeCount() const;
+
+    /**
+     * \brief Get the gain of a grid point
+     * \param latIndex Latitude index of the grid point
+     * \param lonIndex Longitude index of the grid point
+     * \return The gain value in linear format, NaN outside of the pattern coverage
+     */
+    double GetGridGain_lin(uint32_t latIndex, uint32_t lonIndex) const;
+
+    /**
+     * \brief Get the grid box interpolating the gain of a position
+     * \param coord The position
+     * \param mobility The mobility model of the associated satellite
+     * \param box Index of the lower left corner of the grid box, latitude by latitude
+     * \return false if the position is out of the pattern range
+     */
+    bool GetGridBox(GeoCoordinate coord, Ptr<SatMobilityModel> mobility, uint32_t& box) const;
+
+    /**
+     * \brief Get the path of the binary file of an antenna pattern
+     * \param filePathName Path of the antenna pattern text file
+     * \return Path with the .txt extension replaced by .bin
+     */
+    static std::string GetBinaryPath(std::string filePathName);
+
+    /**
+     * \brief Convert an antenna pattern text file to the binary format, written
+     * next to it.
+     * \param filePathName Path of the antenna pattern text file
+     */
+    static void ConvertToBinary(std::string filePathName);
+
   private:
+    /**
+     * \brief Binary antenna pattern file header. It is followed by the
+     * latitudes and the longitudes of the grid, then by the gains in dB,
+     * latitude by latitude, all as doubles. Then come the linear gains as
+     * floats, padded to 8 bytes, and the words of the valid box bitmap.
+     */
+    typedef struct
+    {
+        char m_magic[8];
+        uint32_t m_version;
+        uint32_t m_latCount;
+        uint32_t m_lonCount;
+        uint32_t m_reserved;
+        uint64_t m_byteOrder;
+        uint64_t m_sourceSize;
+        uint64_t m_sourceHash;
+        double m_minLat;
+        double m_minLon;
+        double m_latInterval;
+        double m_lonInterval;
+    } binaryHeader_s;
+
     /**
      * \brief Read the antenna gain pattern from a file
      * \param filePathName Path and file name of the antenna pattern file
@@ -117,11 +223,155 @@ class SatAntennaGainPattern : public Object
     void ReadAntennaPatternFromFile(std::string filePathName);
 
     /**
-     * Container for the antenna pattern from one spot-beam
-     * - Outer vector holds gain values for all latitudes
-     * - Inner vector holds gain values for all longitudes for a certain latitude
+     * \brief Map the binary file of the antenna gain pattern
+     * \param filePathName Path and file name of the antenna pattern text file
+     * \return true if an up to date binary file was mapped
+     */
+    bool MapAntennaPatternFromBinary(std::string filePathName);
+
+    /**
+     * \brief Write the antenna gain pattern read from a text file in the
+     * binary format
+     * \param filePathName Path of the text file the pattern was read from
+     */
+    void WriteAntennaPatternToBinary(std::string filePathName) const;
+
+    /**
+     * \brief Collect the grid points whose gain is above the minimum acceptable one
+     */
+    void BuildValidPositions();
+
+    /**
+     * \brief Convert the gains to linear values and flag the valid grid boxes,
+     * for a pattern read from a text file
+     */
+    void BuildLinearGrid();
+
+    /**
+     * \brief Get the size of the binary file of a grid
+     * \param latCount Number of latitudes
+     * \param lonCount Number of longitudes
+     * \param linearGainsOffset Offset of the linear gains in the file
+     * \param validBoxesOffset Offset of the valid box bitmap in the file
+     * \return Size of the file in bytes
+     */
+    static uint64_t GetBinarySize(uint64_t latCount,
+                                  uint64_t lonCount,
+                                  uint64_t& linearGainsOffset,
+                                  uint64_t& validBoxesOffset);
+
+    /**
+     * \brief Find the grid box interpolating the gain of a point
+     * \param latitude Latitude of the point in the pattern, within its range
+     * \param longitude Longitude of the point in the pattern, within its range
+     * \param latPosition Latitude of the point in grid intervals from the first one
+     * \param lonPosition Longitude of the point in grid intervals from the first one
+     * \param latIndex Latitude index of the lower left corner of the grid box
+     * \param lonIndex Longitude index of the lower left corner of the grid box
+     */
+    inline void FindGridBox(double latitude,
+                            double longitude,
+                            double& latPosition,
+                            double& lonPosition,
+                            std::size_t& latIndex,
+                            std::size_t& lonIndex) const
+    {
+        // a point on the last latitude or longitude is interpolated in the last grid box
+        latPosition = (latitude - m_minLat) * m_latInvInterval;
+        lonPosition = (longitude - m_minLon) * m_lonInvInterval;
+        latIndex =
+            std::min(static_cast<std::size_t>(std::max(latPosition, 0.0)), m_latitudes.size() - 2);
+        lonIndex =
+            std::min(static_cast<std::size_t>(std::max(lonPosition, 0.0)), m_longitudes.size() - 2);
+    }
+
+    /**
+     * \brief Interpolate the linear gain of a point
+     * \param latitude Latitude of the point in the pattern, within its range
+     * \param longitude Longitude of the point in the pattern, within its range
+     * \return The gain value in linear format, NaN if a corner of the grid box is NaN
+     */
+    inline double InterpolateGain(double latitude, double longitude) const
+    {
+        std::size_t lonCount = m_longitudes.size();
+
+        double latPosition, lonPosition;
+        std::size_t latIndex, lonIndex;
+        FindGridBox(latitude, longitude, latPosition, lonPosition, latIndex, lonIndex);
+        double latShare = latPosition - latIndex;
+        double lonShare = lonPosition - lonIndex;
+
+        std::size_t box = latIndex * lonCount + lonIndex;
+        const float* lower = &m_linearGains[box];
+        const float* upper = lower + lonCount;
+
+        double lowerGain = lower[0] + lonShare * (lower[1] - lower[0]);
+        double upperGain = upper[0] + lonShare * (upper[1] - upper[0]);
+        double gain = lowerGain + latShare * (upperGain - lowerGain);
+
+        bool valid = (m_validBoxes[box / 64] >> (box % 64)) & 1;
+        return valid ? gain : std::numeric_limits<double>::quiet_NaN();
+    }
+
+    /**
+     * \brief Get the gain of a grid point
+     * \param latIndex Latitude index of the grid point
+     * \param lonIndex Longitude index of the grid point
+     * \return The gain in dB, NaN outside of the pattern coverage
+     */
+    inline double GetGridGainDb(uint32_t latIndex, uint32_t lonIndex) const
+    {
+        return m_gains[latIndex * m_longitudes.size() + lonIndex];
+    }
+
+    /**
+     * Gains in dB of the antenna pattern from one spot-beam, latitude by
+     * latitude. Points either to m_textGains or to the mapped binary file.
+     */
+    const double* m_gains;
+
+    /**
+     * Gains read from the text file
+     */
+    std::vector<double> m_textGains;
+
+    /**
+     * Gains in linear format, latitude by latitude, 0 for NaN gains. Points
+     * either to m_textLinearGains or to the mapped binary file.
+     */
+    const float* m_linearGains;
+
+    /**
+     * Linear gains computed from the text file
+     */
+    std::vector<float> m_textLinearGains;
+
+    /**
+     * Bit set for each grid box, indexed by its lower left corner, whose four
+     * corners are valid gains. Points either to m_textValidBoxes or to the
+     * mapped binary file.
+     */
+    const uint64_t* m_validBoxes;
+
+    /**
+     * Valid grid boxes computed from the text file
+     */
+    std::vector<uint64_t> m_textValidBoxes;
+
+    /**
+     * Mapped binary file, 0 if not mapped
+     */
+    void* m_mapping;
+
+    /**
+     * Size of the mapped binary file
+     */
+    uint64_t m_mappingSize;
+
+    /**
+     * Look for an up to date binary file before parsing the text file
      */
-    std::vector<std::vector<double>> m_antennaPattern;
+    bool m_useBinaryPattern;
 
     /**
      * Container for valid positions
@@ -130,6 +380,28 @@ class SatAntennaGainPattern : public Object
      */
     std::vector<std::pair<double, double>> m_validPositions;
 
+    /**
+     * Indexes in m_validPositions of the lower left corners of the grid
+     * cells whose four corners are valid positions
+     */
+    std::vector<uint32_t> m_validCells;
+
+    /**
+     * Whether each valid position is the lower left corner of a grid cell
+     * whose three other corners are found in m_validPositions
+     */
+    std::vector<bool> m_isValidCell;
+
+    /**
+     * Number of valid positions flagged in m_isValidCell
+     */
+    uint32_t m_rejectionCellCount;
+
+    /**
+     * Drawing of the grid cell of a random position
+     */
+    RandomPositionMode m_randomPositionMode;
+
     /**
      * Minimum acceptable antenna gain for a serving spot-beam. Used
      * for beam selection.
@@ -181,6 +453,16 @@ class SatAntennaGainPattern : public Object
      */
     double m_lonInterval;
 
+    /**
+     * Inverse of the interval between latitudes
+     */
+    double m_latInvInterval;
+
+    /**
+     * Inverse of the interval between longitudes
+     */
+    double m_lonInvInterval;
+
     /**
      * Latitude of default satellite for antenna gain pattern
      */
@@ -190,12 +472,6 @@ class SatAntennaGainPattern : public Object
      * Longitude of default satellite for antenna gain pattern
      */
     double m_lonDefaultSatellite;
-
-    /**
-     * Valid Not-a-Number (NaN) strings
-     */
-    static const std::string m_nanStringArray[4];
-    std::vector<std::string> m_nanStrings;
 };
 
 } // namespace ns3
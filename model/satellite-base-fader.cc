@@ -46,4 +46,17 @@ SatBaseFader::~SatBaseFader()
     NS_LOG_FUNCTION(this);
 }
 
+void
+SatBaseFader::GetChannelGains(const std::vector<double>& timesInSeconds,
+                              std::vector<double>& gains)
+{
+    NS_LOG_FUNCTION(this << timesInSeconds.size());
+
+    gains.resize(timesInSeconds.size());
+    for (std::size_t i = 0; i < timesInSeconds.size(); i++)
+    {
+        gains[i] = GetChannelGain();
+    }
+}
+
 } // namespace ns3
@@ -24,6 +24,8 @@
 #include <ns3/simulator.h>
 #include <ns3/uinteger.h>
 
+#include <vector>
+
 namespace ns3
 {
 
@@ -67,6 +69,19 @@ class SatBaseFader : public Object
      */
     virtual double GetChannelGain(void) = 0;
 
+    /**
+     * \brief Returns channel gains at many times in the current state.
+     *
+     * The default implementation calls GetChannelGain once per time, which
+     * gives the gain at the current simulation time. Faders whose gain is a
+     * function of time override it to evaluate the given times.
+     *
+     * \param timesInSeconds times in seconds
+     * \param gains channel gains, one per time
+     */
+    virtual void GetChannelGains(const std::vector<double>& timesInSeconds,
+                                 std::vector<double>& gains);
+
     /**
      * \brief Function for updating the fader angle set and state
      * \param newSet new angle set
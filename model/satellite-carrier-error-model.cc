@@ -0,0 +1,193 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+#include "satellite-carrier-error-model.h"
+
+#include "satellite-link-results.h"
+#include "satellite-look-up-table.h"
+#include "satellite-utils.h"
+
+#include <ns3/log.h>
+
+NS_LOG_COMPONENT_DEFINE("SatCarrierErrorModel");
+
+namespace ns3
+{
+
+SatCarrierErrorModel::SatCarrierErrorModel()
+    : m_isEbNo(false),
+      m_isResolved(false),
+      m_tables(),
+      m_ebNoDivisors(),
+      m_shortFrameOffsetDb(0.0)
+{
+}
+
+void
+SatCarrierErrorModel::Resolve(Ptr<SatLinkResults> linkResults,
+                              SatEnums::ChannelType_t channelType,
+                              SatEnums::RegenerationMode_t regenerationMode)
+{
+    NS_LOG_FUNCTION(this << channelType << regenerationMode);
+
+    if (linkResults == nullptr || !linkResults->IsInitialized())
+    {
+        NS_FATAL_ERROR("Error retrieving link results, call Initialize first");
+    }
+
+    switch (channelType)
+    {
+    case SatEnums::FORWARD_FEEDER_CH:
+    case SatEnums::FORWARD_USER_CH: {
+        // In forward link the link results are in Es/No format
+        m_isEbNo = false;
+        break;
+    }
+    case SatEnums::RETURN_FEEDER_CH:
+    case SatEnums::RETURN_USER_CH: {
+        // In return link the link results are in Eb/No format, except on the
+        // feeder link of a regenerative satellite which transmits as in forward
+        m_isEbNo = !((regenerationMode == SatEnums::REGENERATION_LINK ||
+                      regenerationMode == SatEnums::REGENERATION_NETWORK) &&
+                     channelType == SatEnums::RETURN_FEEDER_CH);
+        break;
+    }
+    case SatEnums::UNKNOWN_CH:
+    default: {
+        NS_FATAL_ERROR("SatCarrierErrorModel::Resolve - Invalid channel type!");
+        break;
+    }
+    }
+
+    m_tables.clear();
+
+    if (m_isEbNo)
+    {
+        Ptr<SatLinkResultsRtn> linkResultsRtn = linkResults->GetObject<SatLinkResultsRtn>();
+        if (linkResultsRtn == nullptr)
+        {
+            NS_FATAL_ERROR("SatCarrierErrorModel::Resolve - Return link results expected");
+        }
+
+        const std::map<uint32_t, Ptr<SatLookUpTable>>& tables = linkResultsRtn->GetLookUpTables();
+        if (!tables.empty())
+        {
+            m_tables.assign(tables.rbegin()->first + 1, 0);
+        }
+        for (const std::pair<const uint32_t, Ptr<SatLookUpTable>>& table : tables)
+        {
+            m_tables[table.first] = PeekPointer(table.second);
+        }
+        m_shortFrameOffsetDb = 0.0;
+    }
+    else
+    {
+        Ptr<SatLinkResultsFwd> linkResultsFwd = linkResults->GetObject<SatLinkResultsFwd>();
+        if (linkResultsFwd == nullptr)
+        {
+            NS_FATAL_ERROR("SatCarrierErrorModel::Resolve - Forward link results expected");
+        }
+
+        const std::map<SatEnums::SatModcod_t, Ptr<SatLookUpTable>>& tables =
+            linkResultsFwd->GetLookUpTables();
+        if (!tables.empty())
+        {
+            m_tables.assign(tables.rbegin()->first + 1, 0);
+        }
+        for (const std::pair<const SatEnums::SatModcod_t, Ptr<SatLookUpTable>>& table : tables)
+        {
+            m_tables[table.first] = PeekPointer(table.second);
+        }
+        m_shortFrameOffsetDb = linkResultsFwd->GetShortFrameOffsetDb();
+    }
+
+    m_ebNoDivisors.clear();
+    m_isResolved = true;
+
+    NS_LOG_INFO(this << " resolved " << m_tables.size() << " look up tables, Eb/No: " << m_isEbNo);
+}
+
+double
+SatCarrierErrorModel::GetEbNoDivisor(SatEnums::SatModcod_t modcod)
+{
+    if (modcod >= m_ebNoDivisors.size())
+    {
+        m_ebNoDivisors.resize(modcod + 1, 0.0);
+    }
+
+    double& divisor = m_ebNoDivisors[modcod];
+    if (divisor == 0.0)
+    {
+        divisor = SatUtils::GetCodingRate(modcod) * SatUtils::GetModulatedBits(modcod);
+    }
+
+    return divisor;
+}
+
+double
+SatCarrierErrorModel::GetBler(double sinr,
+                              SatEnums::SatModcod_t modcod,
+                              uint32_t waveformId,
+                              SatEnums::SatBbFrameType_t frameType)
+{
+    NS_LOG_FUNCTION(this << sinr << modcod << waveformId << frameType);
+
+    uint32_t index;
+    double sinrDb;
+
+    if (m_isEbNo)
+    {
+        /**
+         * Eb/No = C/N * B/fb = (C/No / fs) * B/fb
+         * Eb/No = (Es/log2M)/No = (Es/No)*(1/log2M)  = C/N * (1/log2M) = C/No * (1/fs) * (1/log2M)
+         */
+        index = waveformId;
+        sinrDb = SatUtils::LinearToDb(sinr / GetEbNoDivisor(modcod));
+    }
+    else
+    {
+        /**
+         * Es/No = (C*Ts)/No = C/No * (1/fs) = C/N
+         *
+         * Short BB frame is assumed to be requiring m_shortFrameOffsetDb dB
+         * higher Es/No if compared to normal BB frame.
+         */
+        index = modcod;
+        sinrDb = SatUtils::LinearToDb(sinr);
+        if (frameType == SatEnums::SHORT_FRAME)
+        {
+            sinrDb -= m_shortFrameOffsetDb;
+        }
+    }
+
+    if (index >= m_tables.size() || m_tables[index] == 0)
+    {
+        NS_FATAL_ERROR("SatCarrierErrorModel::GetBler - No link results for "
+                       << (m_isEbNo ? "waveform " : "MODCOD ") << index);
+    }
+
+    double bler = m_tables[index]->GetBler(sinrDb);
+
+    NS_LOG_INFO((m_isEbNo ? "ebNo" : "esNo") << " (dB): " << sinrDb << " bler: " << bler);
+
+    return bler;
+}
+
+} // namespace ns3
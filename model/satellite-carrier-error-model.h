@@ -0,0 +1,129 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+#ifndef SATELLITE_CARRIER_ERROR_MODEL_H
+#define SATELLITE_CARRIER_ERROR_MODEL_H
+
+#include "satellite-enums.h"
+
+#include <ns3/ptr.h>
+
+#include <vector>
+
+namespace ns3
+{
+
+class SatLinkResults;
+class SatLookUpTable;
+
+/**
+ * \ingroup satellite
+ * \brief Link results error model of a receiver carrier, resolved once.
+ *
+ * The link results to use, the link results domain (Es/No or Eb/No) and the
+ * index of the look up tables (MODCOD or waveform id) only depend on the
+ * channel type and regeneration mode of the carrier. They are resolved when
+ * the carrier is configured into flat arrays holding the look up tables and
+ * the SINR to Eb/No conversion of each MODCOD, so that the BLER of a
+ * packet costs a couple of array accesses and one interpolation.
+ *
+ * The resolved model borrows the look up tables: the link results must
+ * outlive it.
+ */
+class SatCarrierErrorModel
+{
+  public:
+    /**
+     * Default constructor, the model needs to be resolved before use.
+     */
+    SatCarrierErrorModel();
+
+    /**
+     * \brief Resolve the look up tables used by a carrier.
+     *
+     * \param linkResults Initialized link results of the carrier
+     * \param channelType Channel type of the carrier
+     * \param regenerationMode Link regeneration mode of the carrier
+     */
+    void Resolve(Ptr<SatLinkResults> linkResults,
+                 SatEnums::ChannelType_t channelType,
+                 SatEnums::RegenerationMode_t regenerationMode);
+
+    /**
+     * \return Whether the model has been resolved
+     */
+    inline bool IsResolved() const
+    {
+        return m_isResolved;
+    }
+
+    /**
+     * \brief Get the BLER of a packet.
+     *
+     * \param sinr Composite SINR of the packet in linear scale
+     * \param modcod MODCOD of the packet
+     * \param waveformId Waveform id of the packet, used for Eb/No link results
+     * \param frameType BB frame type of the packet, used for Es/No link results
+     * \return BLER value, ranging between [0..1]
+     */
+    double GetBler(double sinr,
+                   SatEnums::SatModcod_t modcod,
+                   uint32_t waveformId,
+                   SatEnums::SatBbFrameType_t frameType);
+
+  private:
+    /**
+     * \brief Get the divisor converting the SINR to Eb/No for a MODCOD,
+     * computed on first use of the MODCOD.
+     * \param modcod MODCOD of the packet
+     * \return coding rate * modulated bits
+     */
+    double GetEbNoDivisor(SatEnums::SatModcod_t modcod);
+
+    /**
+     * \brief Whether the link results are in Eb/No and indexed by waveform id,
+     * otherwise they are in Es/No and indexed by MODCOD
+     */
+    bool m_isEbNo;
+
+    /**
+     * \brief Whether Resolve has been called
+     */
+    bool m_isResolved;
+
+    /**
+     * \brief Look up tables by MODCOD or waveform id, 0 when missing
+     */
+    std::vector<const SatLookUpTable*> m_tables;
+
+    /**
+     * \brief SINR to Eb/No conversion divisors by MODCOD, 0 until computed
+     */
+    std::vector<double> m_ebNoDivisors;
+
+    /**
+     * \brief Es/No increase required by a short BB frame, in dB
+     */
+    double m_shortFrameOffsetDb;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_CARRIER_ERROR_MODEL_H */
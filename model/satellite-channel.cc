@@ -20,6 +20,7 @@
 
 #include "satellite-channel.h"
 
+#include "satellite-antenna-gain-pattern-container.h"
 #include "satellite-fading-external-input-trace-container.h"
 #include "satellite-fading-output-trace-container.h"
 #include "satellite-id-mapper.h"
@@ -32,6 +33,7 @@
 #include "satellite-utils.h"
 
 #include <ns3/boolean.h>
+#include <ns3/double.h>
 #include <ns3/enum.h>
 #include <ns3/log.h>
 #include <ns3/mobility-model.h>
@@ -55,6 +57,9 @@ NS_OBJECT_ENSURE_REGISTERED(SatChannel);
 SatChannel::SatChannel()
     : m_fwdMode(SatChannel::ONLY_DEST_BEAM),
       m_phyRxContainer(),
+      m_beamRxIndex(),
+      m_addressRxIndex(),
+      m_rxIndexOutdated(false),
       m_channelType(SatEnums::UNKNOWN_CH),
       m_carrierFreqConverter(),
       m_freqId(),
@@ -70,7 +75,15 @@ SatChannel::SatChannel()
        */
       m_enableRxPowerOutputTrace(false),
       m_enableFadingOutputTrace(false),
-      m_enableExternalFadingInputTrace(false)
+      m_enableExternalFadingInputTrace(false),
+      m_enableLinkBudgetCache(false),
+      m_linkBudgetCacheUpdatePeriod(Seconds(1)),
+      m_enableBatchedRx(false),
+      m_linkBudgetCache(),
+      m_enableInterferenceCulling(false),
+      m_interferenceCullingThreshold(SatUtils::DbToLinear(-20.0)),
+      m_antennaGainPatterns(),
+      m_interferenceGains()
 {
     NS_LOG_FUNCTION(this);
 }
@@ -84,7 +97,18 @@ void
 SatChannel::DoDispose()
 {
     NS_LOG_FUNCTION(this);
+    for (PhyRxContainer::const_iterator it = m_phyRxContainer.begin();
+         it != m_phyRxContainer.end();
+         ++it)
+    {
+        (*it)->SetAddressingChangedCallback(SatPhyRx::AddressingChangedCallback());
+    }
     m_phyRxContainer.clear();
+    m_beamRxIndex.clear();
+    m_addressRxIndex.clear();
+    m_linkBudgetCache.Clear();
+    m_antennaGainPatterns = nullptr;
+    m_interferenceGains.clear();
     m_propagationDelay = 0;
     Channel::DoDispose();
 }
@@ -111,6 +135,42 @@ SatChannel::GetTypeId(void)
                           BooleanValue(false),
                           MakeBooleanAccessor(&SatChannel::m_enableExternalFadingInputTrace),
                           MakeBooleanChecker())
+            .AddAttribute("EnableLinkBudgetCache",
+                          "Cache antenna gains and free space loss per transmitter, receiver and "
+                          "carrier. Entries are recalculated when the mobility of either end "
+                          "notifies a course change or the antenna of either end is "
+                          "reconfigured.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&SatChannel::m_enableLinkBudgetCache),
+                          MakeBooleanChecker())
+            .AddAttribute("LinkBudgetCacheUpdatePeriod",
+                          "Refresh period of the cached link budgets of links with a time driven "
+                          "mobility model (e.g. SGP4 satellite).",
+                          TimeValue(Seconds(1)),
+                          MakeTimeAccessor(&SatChannel::m_linkBudgetCacheUpdatePeriod),
+                          MakeTimeChecker())
+            .AddAttribute("EnableBatchedRx",
+                          "Schedule one reception event per group of receivers of the same node "
+                          "sharing the same propagation delay, instead of one event per receiver. "
+                          "The receptions of a group run in the context of their node.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&SatChannel::m_enableBatchedRx),
+                          MakeBooleanChecker())
+            .AddAttribute("EnableInterferenceCulling",
+                          "In AllBeams forwarding mode of the user link channels, do not "
+                          "deliver transmissions to receivers of other beams when the highest "
+                          "interference they may cause in the receiver beam, according to the "
+                          "antenna gain patterns, is below the interference floor.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&SatChannel::SetInterferenceCullingEnabled,
+                                              &SatChannel::IsInterferenceCullingEnabled),
+                          MakeBooleanChecker())
+            .AddAttribute("InterferenceCullingThresholdDb",
+                          "Interference floor in dB relative to the receiver noise power.",
+                          DoubleValue(-20.0),
+                          MakeDoubleAccessor(&SatChannel::SetInterferenceCullingThresholdDb,
+                                             &SatChannel::GetInterferenceCullingThresholdDb),
+                          MakeDoubleChecker<double>())
             .AddAttribute("RxPowerCalculationMode",
                           "Rx Power calculation mode",
                           EnumValue(SatEnums::RX_PWR_CALCULATION),
@@ -130,7 +190,12 @@ SatChannel::GetTypeId(void)
                                           SatChannel::ONLY_DEST_BEAM,
                                           "OnlyDestBeam",
                                           SatChannel::ALL_BEAMS,
-                                          "AllBeams"));
+                                          "AllBeams"))
+            .AddTraceSource("CulledInterference",
+                            "Interference not delivered to a receiver of another beam, "
+                            "because it is below the interference floor",
+                            MakeTraceSourceAccessor(&SatChannel::m_culledInterferenceTrace),
+                            "ns3::SatChannel::CulledInterferenceCallback");
     return tid;
 }
 
@@ -139,6 +204,8 @@ SatChannel::AddRx(Ptr<SatPhyRx> phyRx)
 {
     NS_LOG_FUNCTION(this << phyRx);
     m_phyRxContainer.push_back(phyRx);
+    phyRx->SetAddressingChangedCallback(MakeCallback(&SatChannel::InvalidateRxIndex, this));
+    InvalidateRxIndex();
 }
 
 void
@@ -152,15 +219,49 @@ SatChannel::RemoveRx(Ptr<SatPhyRx> phyRx)
     if (phyIter != m_phyRxContainer.end()) // == vector.end() means the element was not found
     {
         m_phyRxContainer.erase(phyIter);
+        phyRx->SetAddressingChangedCallback(SatPhyRx::AddressingChangedCallback());
+        InvalidateRxIndex();
     }
 }
 
+void
+SatChannel::InvalidateRxIndex()
+{
+    NS_LOG_FUNCTION(this);
+    m_rxIndexOutdated = true;
+}
+
+void
+SatChannel::UpdateRxIndex()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (!m_rxIndexOutdated)
+    {
+        return;
+    }
+
+    m_beamRxIndex.clear();
+    m_addressRxIndex.clear();
+
+    for (uint32_t i = 0; i < m_phyRxContainer.size(); ++i)
+    {
+        m_beamRxIndex[m_phyRxContainer[i]->GetBeamId()].push_back(i);
+        m_addressRxIndex[m_phyRxContainer[i]->GetAddress()].push_back(i);
+    }
+
+    m_rxIndexOutdated = false;
+}
+
 void
 SatChannel::StartTx(Ptr<SatSignalParameters> txParams)
 {
     NS_LOG_FUNCTION(this << txParams);
     NS_ASSERT_MSG(txParams->m_phyTx, "NULL phyTx");
 
+    // Receivers of the transmission
+    PhyRxContainer receivers;
+
     switch (m_fwdMode)
     {
     /**
@@ -170,60 +271,100 @@ SatChannel::StartTx(Ptr<SatSignalParameters> txParams)
      * since there will be no interference.
      */
     case SatChannel::ONLY_DEST_NODE: {
-        // For all receivers
-        for (PhyRxContainer::const_iterator rxPhyIterator = m_phyRxContainer.begin();
-             rxPhyIterator != m_phyRxContainer.end();
-             ++rxPhyIterator)
+        UpdateRxIndex();
+
+        std::map<uint32_t, RxIndexList_t>::const_iterator beamIt =
+            m_beamRxIndex.find(txParams->m_beamId);
+
+        // No receivers in the same beam
+        if (beamIt == m_beamRxIndex.end())
         {
-            // If the same beam
-            if ((*rxPhyIterator)->GetBeamId() == txParams->m_beamId)
+            break;
+        }
+
+        switch (m_channelType)
+        {
+        // If the destination is satellite
+        case SatEnums::FORWARD_FEEDER_CH:
+        case SatEnums::RETURN_USER_CH: {
+            // The packet burst is passed on to the satellite receivers of the beam
+            for (RxIndexList_t::const_iterator it = beamIt->second.begin();
+                 it != beamIt->second.end();
+                 ++it)
+            {
+                receivers.push_back(m_phyRxContainer[*it]);
+            }
+            break;
+        }
+        // If the destination is terrestrial node
+        case SatEnums::FORWARD_USER_CH:
+        case SatEnums::RETURN_FEEDER_CH: {
+            // Go through the packets and collect the receivers of the beam addressed by
+            // them by peeking the MAC tag
+            RxIndexList_t addressed;
+            bool toWholeBeam = false;
+
+            SatSignalParameters::PacketsInBurst_t::const_iterator it =
+                txParams->m_packetsInBurst.begin();
+            for (; it != txParams->m_packetsInBurst.end(); ++it)
             {
-                switch (m_channelType)
+                SatMacTag macTag;
+                bool mSuccess = (*it)->PeekPacketTag(macTag);
+                if (!mSuccess)
+                {
+                    NS_FATAL_ERROR("MAC tag was not found from the packet!");
+                }
+
+                Mac48Address dest = macTag.GetDestAddress();
+
+                // Broadcast and group packets are received by all the receivers of the beam
+                if (dest.IsBroadcast() || dest.IsGroup())
                 {
-                // If the destination is satellite
-                case SatEnums::FORWARD_FEEDER_CH:
-                case SatEnums::RETURN_USER_CH: {
-                    // The packet burst is passed on to the satellite receiver
-                    ScheduleRx(txParams, *rxPhyIterator);
+                    toWholeBeam = true;
                     break;
                 }
-                // If the destination is terrestrial node
-                case SatEnums::FORWARD_USER_CH:
-                case SatEnums::RETURN_FEEDER_CH: {
-                    // Go through the packets and check their destination address by peeking the MAC
-                    // tag
-                    SatSignalParameters::PacketsInBurst_t::const_iterator it =
-                        txParams->m_packetsInBurst.begin();
-                    for (; it != txParams->m_packetsInBurst.end(); ++it)
-                    {
-                        SatMacTag macTag;
-                        bool mSuccess = (*it)->PeekPacketTag(macTag);
-                        if (!mSuccess)
-                        {
-                            NS_FATAL_ERROR("MAC tag was not found from the packet!");
-                        }
 
-                        Mac48Address dest = macTag.GetDestAddress();
+                std::map<Mac48Address, RxIndexList_t>::const_iterator addrIt =
+                    m_addressRxIndex.find(dest);
 
-                        // If the packet destination is the same as the receiver MAC
-                        if (dest == (*rxPhyIterator)->GetAddress() || dest.IsBroadcast() ||
-                            dest.IsGroup())
+                if (addrIt != m_addressRxIndex.end())
+                {
+                    for (RxIndexList_t::const_iterator rxIt = addrIt->second.begin();
+                         rxIt != addrIt->second.end();
+                         ++rxIt)
+                    {
+                        if (m_phyRxContainer[*rxIt]->GetBeamId() == txParams->m_beamId)
                         {
-                            ScheduleRx(txParams, *rxPhyIterator);
-
-                            // Remember to break the packet loop, so that the transmission
-                            // is not received several times!
-                            break;
+                            addressed.push_back(*rxIt);
                         }
                     }
-                    break;
-                }
-                default: {
-                    NS_FATAL_ERROR("Unsupported channel type!");
-                    break;
-                }
                 }
             }
+
+            if (toWholeBeam)
+            {
+                addressed = beamIt->second;
+            }
+            else
+            {
+                // Keep the receiver order of the channel and make sure that the
+                // transmission is not received several times by the same receiver!
+                std::sort(addressed.begin(), addressed.end());
+                addressed.erase(std::unique(addressed.begin(), addressed.end()),
+                                addressed.end());
+            }
+
+            for (RxIndexList_t::const_iterator rxIt = addressed.begin(); rxIt != addressed.end();
+                 ++rxIt)
+            {
+                receivers.push_back(m_phyRxContainer[*rxIt]);
+            }
+            break;
+        }
+        default: {
+            NS_FATAL_ERROR("Unsupported channel type!");
+            break;
+        }
         }
         break;
     }
@@ -233,14 +374,18 @@ SatChannel::StartTx(Ptr<SatSignalParameters> txParams)
      * since there will be no interference.
      */
     case SatChannel::ONLY_DEST_BEAM: {
-        for (PhyRxContainer::const_iterator rxPhyIterator = m_phyRxContainer.begin();
-             rxPhyIterator != m_phyRxContainer.end();
-             ++rxPhyIterator)
+        UpdateRxIndex();
+
+        std::map<uint32_t, RxIndexList_t>::const_iterator beamIt =
+            m_beamRxIndex.find(txParams->m_beamId);
+
+        if (beamIt != m_beamRxIndex.end())
         {
-            // If the same beam
-            if ((*rxPhyIterator)->GetBeamId() == txParams->m_beamId)
+            for (RxIndexList_t::const_iterator it = beamIt->second.begin();
+                 it != beamIt->second.end();
+                 ++it)
             {
-                ScheduleRx(txParams, *rxPhyIterator);
+                receivers.push_back(m_phyRxContainer[*it]);
             }
         }
         break;
@@ -252,11 +397,31 @@ SatChannel::StartTx(Ptr<SatSignalParameters> txParams)
      * is needed by the PerPacket interference.
      */
     case SatChannel::ALL_BEAMS: {
+        /**
+         * Interference culling is applicable only when the Rx power is calculated, and
+         * only in the user link channels, whose beams are the ones of the antenna gain
+         * patterns of the satellite.
+         */
+        bool culling = m_enableInterferenceCulling && !m_interferenceGains.empty() &&
+                       m_rxPowerCalculationMode == SatEnums::RX_PWR_CALCULATION;
+
         for (PhyRxContainer::const_iterator rxPhyIterator = m_phyRxContainer.begin();
              rxPhyIterator != m_phyRxContainer.end();
              ++rxPhyIterator)
         {
-            ScheduleRx(txParams, *rxPhyIterator);
+            if (culling && (*rxPhyIterator)->GetBeamId() != txParams->m_beamId)
+            {
+                double ifPower_W = 0.0;
+                if (!IsInterferenceSignificant(txParams, *rxPhyIterator, ifPower_W))
+                {
+                    m_culledInterferenceTrace(txParams->m_beamId,
+                                              (*rxPhyIterator)->GetBeamId(),
+                                              ifPower_W);
+                    continue;
+                }
+            }
+
+            receivers.push_back(*rxPhyIterator);
         }
         break;
     }
@@ -265,21 +430,46 @@ SatChannel::StartTx(Ptr<SatSignalParameters> txParams)
         break;
     }
     }
+
+    if (receivers.size() == 1)
+    {
+        ScheduleRx(txParams->Copy(), receivers.front());
+    }
+    else if (!receivers.empty())
+    {
+        /**
+         * The packets of the burst are copied once and the copy is shared by all
+         * the receivers. Only the receivers accepting the transmission copy the
+         * packets for themselves, the rest see the burst only as interference.
+         */
+        Ptr<SatSignalParameters> burstParams = txParams->Copy();
+
+        if (m_enableBatchedRx)
+        {
+            ScheduleRxBatches(burstParams, receivers);
+        }
+        else
+        {
+            for (PhyRxContainer::const_iterator rxPhyIterator = receivers.begin();
+                 rxPhyIterator != receivers.end();
+                 ++rxPhyIterator)
+            {
+                ScheduleRx(burstParams->CopySharingPackets(), *rxPhyIterator);
+            }
+        }
+    }
 }
 
-void
-SatChannel::ScheduleRx(Ptr<SatSignalParameters> txParams, Ptr<SatPhyRx> receiver)
+Time
+SatChannel::GetRxDelay(Ptr<SatSignalParameters> rxParams, Ptr<SatPhyRx> receiver)
 {
-    NS_LOG_FUNCTION(this << txParams << receiver);
+    NS_LOG_FUNCTION(this << rxParams << receiver);
 
     Time delay = Seconds(0);
 
-    Ptr<MobilityModel> senderMobility = txParams->m_phyTx->GetMobility();
+    Ptr<MobilityModel> senderMobility = rxParams->m_phyTx->GetMobility();
     Ptr<MobilityModel> receiverMobility = receiver->GetMobility();
 
-    NS_LOG_INFO("copying signal parameters " << txParams);
-    Ptr<SatSignalParameters> rxParams = txParams->Copy();
-
     if (m_propagationDelay)
     {
         /**
@@ -300,6 +490,16 @@ SatChannel::ScheduleRx(Ptr<SatSignalParameters> txParams, Ptr<SatPhyRx> receiver
 
     NS_LOG_INFO("Setting propagation delay: " << delay);
 
+    return delay;
+}
+
+void
+SatChannel::ScheduleRx(Ptr<SatSignalParameters> rxParams, Ptr<SatPhyRx> receiver)
+{
+    NS_LOG_FUNCTION(this << rxParams << receiver);
+
+    Time delay = GetRxDelay(rxParams, receiver);
+
     Ptr<NetDevice> netDev = receiver->GetDevice();
     uint32_t dstNodeId = netDev->GetNode()->GetId();
     Simulator::ScheduleWithContext(dstNodeId,
@@ -310,6 +510,68 @@ SatChannel::ScheduleRx(Ptr<SatSignalParameters> txParams, Ptr<SatPhyRx> receiver
                                    receiver);
 }
 
+void
+SatChannel::ScheduleRxBatches(Ptr<SatSignalParameters> burstParams,
+                              const PhyRxContainer& receivers)
+{
+    NS_LOG_FUNCTION(this << burstParams << receivers.size());
+
+    /**
+     * Receptions are batched by propagation delay and receiver node, all the receptions
+     * of a burst being on the same carrier. The event of a batch is scheduled in the
+     * context of the node of its receivers, as the events of ScheduleRx are.
+     */
+    typedef std::pair<Time, uint32_t> BatchKey_t;
+
+    // Batches in the order of their first receiver, with their delay and context
+    std::vector<std::pair<BatchKey_t, RxBatch_t>> batches;
+    std::map<BatchKey_t, uint32_t> batchIndexes;
+
+    for (PhyRxContainer::const_iterator rxPhyIterator = receivers.begin();
+         rxPhyIterator != receivers.end();
+         ++rxPhyIterator)
+    {
+        Ptr<SatSignalParameters> rxParams = burstParams->CopySharingPackets();
+
+        BatchKey_t key = std::make_pair(GetRxDelay(rxParams, *rxPhyIterator),
+                                        (*rxPhyIterator)->GetDevice()->GetNode()->GetId());
+
+        std::map<BatchKey_t, uint32_t>::const_iterator indexIt = batchIndexes.find(key);
+        if (indexIt == batchIndexes.end())
+        {
+            indexIt = batchIndexes.insert(std::make_pair(key, batches.size())).first;
+            batches.push_back(std::make_pair(key, RxBatch_t()));
+        }
+
+        batches[indexIt->second].second.push_back(std::make_pair(rxParams, *rxPhyIterator));
+    }
+
+    NS_LOG_INFO("Scheduling " << receivers.size() << " receptions in " << batches.size()
+                              << " events");
+
+    for (std::vector<std::pair<BatchKey_t, RxBatch_t>>::const_iterator it = batches.begin();
+         it != batches.end();
+         ++it)
+    {
+        Simulator::ScheduleWithContext(it->first.second,
+                                       it->first.first,
+                                       &SatChannel::StartRxBatch,
+                                       this,
+                                       it->second);
+    }
+}
+
+void
+SatChannel::StartRxBatch(RxBatch_t batch)
+{
+    NS_LOG_FUNCTION(this << batch.size());
+
+    for (RxBatch_t::const_iterator it = batch.begin(); it != batch.end(); ++it)
+    {
+        StartRx(it->first, it->second);
+    }
+}
+
 void
 SatChannel::StartRx(Ptr<SatSignalParameters> rxParams, Ptr<SatPhyRx> phyRx)
 {
@@ -402,31 +664,8 @@ SatChannel::DoRxPowerInputTrace(Ptr<SatSignalParameters> rxParams, Ptr<SatPhyRx>
                                                             rxParams->m_carrierId,
                                                             SatEnums::EFFECTIVE_BANDWIDTH);
 
-    switch (m_channelType)
-    {
-    case SatEnums::RETURN_FEEDER_CH:
-    case SatEnums::FORWARD_USER_CH: {
-        // Calculate the Rx power from Rx power density
-        rxParams->m_rxPower_W =
-            carrierBandwidthHz *
-            Singleton<SatRxPowerInputTraceContainer>::Get()->GetRxPowerDensity(
-                std::make_pair(phyRx->GetDevice()->GetAddress(), m_channelType));
-
-        break;
-    }
-    case SatEnums::FORWARD_FEEDER_CH:
-    case SatEnums::RETURN_USER_CH: {
-        // Calculate the Rx power from Rx power density
-        rxParams->m_rxPower_W =
-            carrierBandwidthHz * Singleton<SatRxPowerInputTraceContainer>::Get()->GetRxPowerDensity(
-                                     std::make_pair(GetSourceAddress(rxParams), m_channelType));
-        break;
-    }
-    default: {
-        NS_FATAL_ERROR("SatChannel::DoRxPowerInputTrace - Invalid channel type");
-        break;
-    }
-    }
+    // Calculate the Rx power from Rx power density
+    rxParams->m_rxPower_W = carrierBandwidthHz * GetInputTraceHandle(rxParams, phyRx).GetValue();
 
     NS_LOG_INFO("Carrier bw: " << carrierBandwidthHz
                                << ", rxPower: " << SatUtils::LinearToDb(rxParams->m_rxPower_W)
@@ -463,13 +702,13 @@ SatChannel::DoRxCnoInputTrace(Ptr<SatSignalParameters> rxParams, Ptr<SatPhyRx> p
     double rxNoisePowerW =
         SatConstVariables::BOLTZMANN_CONSTANT * rxTemperatureK * carrierBandwidthHz;
 
+    // Calculate the Rx power from C/N0
+    cno = GetInputTraceHandle(rxParams, phyRx).GetValue();
+
     switch (m_channelType)
     {
     case SatEnums::RETURN_FEEDER_CH:
     case SatEnums::FORWARD_USER_CH: {
-        // Calculate the Rx power from C/N0
-        cno = Singleton<SatRxCnoInputTraceContainer>::Get()->GetRxCno(
-            std::make_pair(phyRx->GetDevice()->GetAddress(), m_channelType));
         if (cno == 0)
         {
             DoRxPowerCalculation(rxParams, phyRx);
@@ -486,9 +725,6 @@ SatChannel::DoRxCnoInputTrace(Ptr<SatSignalParameters> rxParams, Ptr<SatPhyRx> p
     }
     case SatEnums::FORWARD_FEEDER_CH:
     case SatEnums::RETURN_USER_CH: {
-        // Calculate the Rx power from C/N0
-        cno = Singleton<SatRxCnoInputTraceContainer>::Get()->GetRxCno(
-            std::make_pair(GetSourceAddress(rxParams), m_channelType));
         if (cno == 0)
         {
             DoRxPowerCalculation(rxParams, phyRx);
@@ -565,6 +801,7 @@ SatChannel::DoRxPowerCalculation(Ptr<SatSignalParameters> rxParams, Ptr<SatPhyRx
 
     double txAntennaGain_W = 0.0;
     double rxAntennaGain_W = 0.0;
+    double fsl = 0.0;
     double markovFading = 0.0;
     double extFading = 1.0;
 
@@ -573,15 +810,13 @@ SatChannel::DoRxPowerCalculation(Ptr<SatSignalParameters> rxParams, Ptr<SatPhyRx
     {
     case SatEnums::RETURN_FEEDER_CH:
     case SatEnums::FORWARD_USER_CH: {
-        txAntennaGain_W = rxParams->m_phyTx->GetAntennaGain(rxMobility);
-        rxAntennaGain_W = phyRx->GetAntennaGain(rxMobility);
+        GetLinkBudget(rxParams, phyRx, rxMobility, txAntennaGain_W, rxAntennaGain_W, fsl);
         markovFading = phyRx->GetFadingValue(phyRx->GetDevice()->GetAddress(), m_channelType);
         break;
     }
     case SatEnums::RETURN_USER_CH:
     case SatEnums::FORWARD_FEEDER_CH: {
-        txAntennaGain_W = rxParams->m_phyTx->GetAntennaGain(txMobility);
-        rxAntennaGain_W = phyRx->GetAntennaGain(txMobility);
+        GetLinkBudget(rxParams, phyRx, txMobility, txAntennaGain_W, rxAntennaGain_W, fsl);
         markovFading = rxParams->m_phyTx->GetFadingValue(GetSourceAddress(rxParams), m_channelType);
         break;
     }
@@ -612,13 +847,188 @@ SatChannel::DoRxPowerCalculation(Ptr<SatSignalParameters> rxParams, Ptr<SatPhyRx
         DoFadingOutputTrace(rxParams, phyRx, markovFading);
     }
 
-    // get (calculate) free space loss and RX power and set it to RX params
-    double rxPower_W = (rxParams->m_txPower_W * txAntennaGain_W) /
-                       m_freeSpaceLoss->GetFsl(txMobility, rxMobility, rxParams->m_carrierFreq_hz);
+    // calculate RX power and set it to RX params
+    double rxPower_W = (rxParams->m_txPower_W * txAntennaGain_W) / fsl;
     rxParams->m_rxPower_W =
         rxPower_W * rxAntennaGain_W / phyRx->GetLosses() * markovFading / extFading;
 }
 
+void
+SatChannel::GetLinkBudget(Ptr<SatSignalParameters> rxParams,
+                          Ptr<SatPhyRx> phyRx,
+                          Ptr<MobilityModel> gainMobility,
+                          double& txAntennaGain_W,
+                          double& rxAntennaGain_W,
+                          double& fsl)
+{
+    NS_LOG_FUNCTION(this << rxParams << phyRx);
+
+    SatLinkBudgetCache::linkBudget_s linkBudget;
+
+    if (m_enableLinkBudgetCache &&
+        m_linkBudgetCache.Get(rxParams->m_phyTx,
+                              phyRx,
+                              rxParams->m_carrierId,
+                              m_linkBudgetCacheUpdatePeriod,
+                              linkBudget))
+    {
+        txAntennaGain_W = linkBudget.m_txAntennaGain_W;
+        rxAntennaGain_W = linkBudget.m_rxAntennaGain_W;
+        fsl = linkBudget.m_fsl;
+        return;
+    }
+
+    txAntennaGain_W = rxParams->m_phyTx->GetAntennaGain(gainMobility);
+    rxAntennaGain_W = phyRx->GetAntennaGain(gainMobility);
+    fsl = m_freeSpaceLoss->GetFsl(rxParams->m_phyTx->GetMobility(),
+                                  phyRx->GetMobility(),
+                                  rxParams->m_carrierFreq_hz);
+
+    if (m_enableLinkBudgetCache)
+    {
+        linkBudget.m_txAntennaGain_W = txAntennaGain_W;
+        linkBudget.m_rxAntennaGain_W = rxAntennaGain_W;
+        linkBudget.m_fsl = fsl;
+
+        m_linkBudgetCache.Add(rxParams->m_phyTx, phyRx, rxParams->m_carrierId, linkBudget);
+    }
+}
+
+bool
+SatChannel::IsInterferenceSignificant(Ptr<SatSignalParameters> txParams,
+                                      Ptr<SatPhyRx> phyRx,
+                                      double& ifPower_W)
+{
+    NS_LOG_FUNCTION(this << txParams << phyRx);
+
+    std::map<std::pair<uint32_t, uint32_t>, double>::const_iterator it =
+        m_interferenceGains.find(std::make_pair(txParams->m_beamId, phyRx->GetBeamId()));
+
+    // The interference of beams without antenna gain pattern is never culled
+    if (it == m_interferenceGains.end())
+    {
+        return true;
+    }
+
+    Ptr<MobilityModel> txMobility = txParams->m_phyTx->GetMobility();
+    Ptr<MobilityModel> rxMobility = phyRx->GetMobility();
+
+    // The satellite gain is the highest one over the beam of the UT, while the UT
+    // gain does not depend on the position
+    double utAntennaGain_W = 0.0;
+    if (m_channelType == SatEnums::FORWARD_USER_CH)
+    {
+        utAntennaGain_W = phyRx->GetAntennaGain(rxMobility);
+    }
+    else
+    {
+        utAntennaGain_W = txParams->m_phyTx->GetAntennaGain(txMobility);
+    }
+
+    double frequency_hz = m_carrierFreqConverter(m_channelType, m_freqId, txParams->m_carrierId);
+    double carrierBandwidthHz = m_carrierBandwidthConverter(m_channelType,
+                                                            txParams->m_carrierId,
+                                                            SatEnums::EFFECTIVE_BANDWIDTH);
+
+    double noisePower_W = SatConstVariables::BOLTZMANN_CONSTANT *
+                          phyRx->GetRxTemperatureK(txParams) * carrierBandwidthHz;
+
+    ifPower_W = txParams->m_txPower_W * it->second * utAntennaGain_W /
+                m_freeSpaceLoss->GetFsl(txMobility, rxMobility, frequency_hz) /
+                phyRx->GetLosses();
+
+    return ifPower_W >= noisePower_W * m_interferenceCullingThreshold;
+}
+
+void
+SatChannel::BuildInterferenceGains()
+{
+    NS_LOG_FUNCTION(this);
+
+    m_interferenceGains.clear();
+
+    if (!m_antennaGainPatterns ||
+        (m_channelType != SatEnums::FORWARD_USER_CH && m_channelType != SatEnums::RETURN_USER_CH))
+    {
+        return;
+    }
+
+    const std::map<std::pair<uint32_t, uint32_t>, double>& coverageGains =
+        m_antennaGainPatterns->GetMaxCoverageGains();
+
+    for (std::map<std::pair<uint32_t, uint32_t>, double>::const_iterator it =
+             coverageGains.begin();
+         it != coverageGains.end();
+         ++it)
+    {
+        // The UT is in the coverage of the receiver beam in the forward link and of
+        // the transmitter beam in the return link
+        if (m_channelType == SatEnums::FORWARD_USER_CH)
+        {
+            m_interferenceGains[std::make_pair(it->first.second, it->first.first)] = it->second;
+        }
+        else
+        {
+            m_interferenceGains[it->first] = it->second;
+        }
+    }
+
+    NS_LOG_INFO("Highest satellite antenna gains of " << m_interferenceGains.size()
+                                                      << " beam pairs");
+}
+
+void
+SatChannel::SetAntennaGainPatterns(Ptr<SatAntennaGainPatternContainer> antennaPatterns)
+{
+    NS_LOG_FUNCTION(this << antennaPatterns);
+
+    m_antennaGainPatterns = antennaPatterns;
+
+    if (m_enableInterferenceCulling)
+    {
+        BuildInterferenceGains();
+    }
+}
+
+void
+SatChannel::SetInterferenceCullingEnabled(bool enableCulling)
+{
+    NS_LOG_FUNCTION(this << enableCulling);
+
+    m_enableInterferenceCulling = enableCulling;
+
+    if (m_enableInterferenceCulling)
+    {
+        BuildInterferenceGains();
+    }
+    else
+    {
+        m_interferenceGains.clear();
+    }
+}
+
+bool
+SatChannel::IsInterferenceCullingEnabled() const
+{
+    return m_enableInterferenceCulling;
+}
+
+void
+SatChannel::SetInterferenceCullingThresholdDb(double thresholdDb)
+{
+    NS_LOG_FUNCTION(this << thresholdDb);
+
+    m_interferenceCullingThreshold = SatUtils::DbToLinear(thresholdDb);
+}
+
+double
+SatChannel::GetInterferenceCullingThresholdDb() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return SatUtils::LinearToDb(m_interferenceCullingThreshold);
+}
+
 double
 SatChannel::GetExternalFadingTrace(Ptr<SatSignalParameters> rxParams, Ptr<SatPhyRx> phyRx)
 {
@@ -666,6 +1076,59 @@ SatChannel::GetExternalFadingTrace(Ptr<SatSignalParameters> rxParams, Ptr<SatPhy
         ->GetFading();
 }
 
+SatInputTraceHandle&
+SatChannel::GetInputTraceHandle(Ptr<SatSignalParameters> rxParams, Ptr<SatPhyRx> phyRx)
+{
+    NS_LOG_FUNCTION(this << rxParams << phyRx);
+
+    bool isCno = (m_rxPowerCalculationMode == SatEnums::RX_CNO_INPUT_TRACE);
+
+    // Downlink traces are those of the receiver and uplink traces those of the
+    // sender, so that each PHY holds the handle matching its own address
+    Address address;
+    SatInputTraceHandle* handle = NULL;
+
+    switch (m_channelType)
+    {
+    case SatEnums::RETURN_FEEDER_CH:
+    case SatEnums::FORWARD_USER_CH: {
+        address = phyRx->GetDevice()->GetAddress();
+        handle = isCno ? &phyRx->GetRxCnoInputTraceHandle() : &phyRx->GetRxPowerInputTraceHandle();
+        break;
+    }
+    case SatEnums::FORWARD_FEEDER_CH:
+    case SatEnums::RETURN_USER_CH: {
+        address = GetSourceAddress(rxParams);
+        handle = isCno ? &rxParams->m_phyTx->GetRxCnoInputTraceHandle()
+                       : &rxParams->m_phyTx->GetRxPowerInputTraceHandle();
+        break;
+    }
+    default: {
+        NS_FATAL_ERROR("SatChannel::GetInputTraceHandle - Invalid channel type");
+        break;
+    }
+    }
+
+    if (isCno)
+    {
+        SatRxCnoInputTraceContainer* container = Singleton<SatRxCnoInputTraceContainer>::Get();
+        if (!handle->IsResolvedFor(address, container->GetGeneration()))
+        {
+            *handle = container->GetHandle(std::make_pair(address, m_channelType));
+        }
+    }
+    else
+    {
+        SatRxPowerInputTraceContainer* container = Singleton<SatRxPowerInputTraceContainer>::Get();
+        if (!handle->IsResolvedFor(address, container->GetGeneration()))
+        {
+            *handle = container->GetHandle(std::make_pair(address, m_channelType));
+        }
+    }
+
+    return *handle;
+}
+
 /// TODO get rid of source MAC address peeking
 Mac48Address
 SatChannel::GetSourceAddress(Ptr<SatSignalParameters> rxParams)
@@ -23,6 +23,8 @@
 
 #include "satellite-enums.h"
 #include "satellite-free-space-loss.h"
+#include "satellite-input-trace-handle.h"
+#include "satellite-link-budget-cache.h"
 #include "satellite-phy-rx-carrier-conf.h"
 #include "satellite-phy-rx.h"
 #include "satellite-signal-parameters.h"
@@ -34,9 +36,14 @@
 #include <ns3/propagation-delay-model.h>
 #include <ns3/traced-callback.h>
 
+#include <map>
+#include <vector>
+
 namespace ns3
 {
 
+class SatAntennaGainPatternContainer;
+
 /**
  * \ingroup satellite
  *
@@ -104,6 +111,16 @@ class SatChannel : public Channel
      */
     typedef Callback<double, SatEnums::ChannelType_t, uint32_t, uint32_t> CarrierFreqConverter;
 
+    /**
+     * \brief Callback signature for `CulledInterference` trace source.
+     * \param txBeamId Beam id of the transmission
+     * \param rxBeamId Beam id of the receiver which did not receive the transmission
+     * \param ifPower_W Estimated interference power not delivered to the receiver
+     */
+    typedef void (*CulledInterferenceCallback)(uint32_t txBeamId,
+                                               uint32_t rxBeamId,
+                                               double ifPower_W);
+
     /**
      * \brief Set the  propagation delay model to be used in the SatChannel
      * \param delay Ptr to the propagation delay model to be used.
@@ -160,6 +177,13 @@ class SatChannel : public Channel
      */
     virtual Ptr<SatFreeSpaceLoss> GetFreeSpaceLoss() const;
 
+    /**
+     * \brief Set the antenna gain patterns of the satellite, used to evaluate the
+     * highest interference between the beams with interference culling.
+     * \param antennaPatterns Antenna gain pattern container
+     */
+    void SetAntennaGainPatterns(Ptr<SatAntennaGainPatternContainer> antennaPatterns);
+
     /**
      * \brief Used by attached SatPhyTx instances to transmit signals to the channel
      * \param params the parameters of the signals being transmitted
@@ -205,6 +229,26 @@ class SatChannel : public Channel
      */
     PhyRxContainer m_phyRxContainer;
 
+    /**
+     * Define type RxIndexList_t, positions of receivers within m_phyRxContainer
+     */
+    typedef std::vector<uint32_t> RxIndexList_t;
+
+    /**
+     * \brief Receivers of the channel indexed by their beam id
+     */
+    std::map<uint32_t, RxIndexList_t> m_beamRxIndex;
+
+    /**
+     * \brief Receivers of the channel indexed by their MAC address
+     */
+    std::map<Mac48Address, RxIndexList_t> m_addressRxIndex;
+
+    /**
+     * \brief Flag telling that the receiver indexes need to be rebuilt before use
+     */
+    bool m_rxIndexOutdated;
+
     /**
      * \brief Type of the channel
      */
@@ -255,17 +299,133 @@ class SatChannel : public Channel
      */
     bool m_enableExternalFadingInputTrace;
 
+    /**
+     * \brief Defines whether the geometric part of the link budget is cached or not
+     */
+    bool m_enableLinkBudgetCache;
+
+    /**
+     * \brief Refresh period of cached link budgets involving a time driven mobility model
+     */
+    Time m_linkBudgetCacheUpdatePeriod;
+
+    /**
+     * \brief Defines whether receptions with the same delay and node are scheduled as one event
+     */
+    bool m_enableBatchedRx;
+
+    /**
+     * Define type RxBatch_t, receptions started by one event
+     */
+    typedef std::vector<std::pair<Ptr<SatSignalParameters>, Ptr<SatPhyRx>>> RxBatch_t;
+
+    /**
+     * \brief Cache of the geometric part of the link budgets
+     */
+    SatLinkBudgetCache m_linkBudgetCache;
+
+    /**
+     * \brief Defines whether insignificant interference is culled in ALL_BEAMS mode
+     */
+    bool m_enableInterferenceCulling;
+
+    /**
+     * \brief Interference floor relative to the receiver noise power in linear format
+     */
+    double m_interferenceCullingThreshold;
+
+    /**
+     * \brief Antenna gain patterns of the satellite
+     */
+    Ptr<SatAntennaGainPatternContainer> m_antennaGainPatterns;
+
+    /**
+     * \brief Highest satellite antenna gain in linear format towards the UTs of the
+     * receiver beam (forward link) or from the UTs of the transmitter beam (return
+     * link), keyed by the transmitter and receiver beam ids
+     */
+    std::map<std::pair<uint32_t, uint32_t>, double> m_interferenceGains;
+
+    /**
+     * \brief Trace of the interference culled from the receivers
+     */
+    TracedCallback<uint32_t, uint32_t, double> m_culledInterferenceTrace;
+
     /**
      * Dispose SatChannel.
      */
     virtual void DoDispose();
 
+    /**
+     * \brief Mark the receiver indexes outdated. Called when receivers are added or
+     * removed, or when the beam id or MAC address of an attached receiver changes.
+     */
+    void InvalidateRxIndex();
+
+    /**
+     * \brief Rebuild the beam and MAC address indexes of the attached receivers,
+     * if they are outdated. The indexes keep the order of m_phyRxContainer.
+     */
+    void UpdateRxIndex();
+
+    /**
+     * \brief Build the highest satellite antenna gains between the beams from the
+     * antenna gain patterns, for the user link channels.
+     */
+    void BuildInterferenceGains();
+
+    /**
+     * \brief Enable or disable interference culling.
+     * \param enableCulling Whether insignificant interference is culled
+     */
+    void SetInterferenceCullingEnabled(bool enableCulling);
+
+    /**
+     * \brief Check whether interference culling is enabled.
+     * \return true if insignificant interference is culled
+     */
+    bool IsInterferenceCullingEnabled() const;
+
+    /**
+     * \brief Set the interference floor used with interference culling.
+     * \param thresholdDb Interference floor in dB relative to the receiver noise power
+     */
+    void SetInterferenceCullingThresholdDb(double thresholdDb);
+
+    /**
+     * \brief Get the interference floor used with interference culling.
+     * \return Interference floor in dB relative to the receiver noise power
+     */
+    double GetInterferenceCullingThresholdDb() const;
+
     /**
      * \brief Used internally to schedule the StartRx method call after the propagation delay.
+     * \param rxParams Parameters of the signal being received, owned by the receiver
+     * \param phyRx The receiver SatPhyRx entity
+     */
+    void ScheduleRx(Ptr<SatSignalParameters> rxParams, Ptr<SatPhyRx> phyRx);
+
+    /**
+     * \brief Get the propagation delay from the transmitter to the receiver.
      * \param rxParams Parameters of the signal being received
      * \param phyRx The receiver SatPhyRx entity
+     * \return The propagation delay
+     */
+    Time GetRxDelay(Ptr<SatSignalParameters> rxParams, Ptr<SatPhyRx> phyRx);
+
+    /**
+     * \brief Used internally to schedule the receptions of a burst grouped by propagation
+     * delay and receiver node, one StartRxBatch call per group in the context of the node.
+     * \param burstParams Parameters of the signal shared by the receivers
+     * \param receivers The receiver SatPhyRx entities
+     */
+    void ScheduleRxBatches(Ptr<SatSignalParameters> burstParams, const PhyRxContainer& receivers);
+
+    /**
+     * \brief Used internally to start the packet receptions of a batch.
+     * \param batch Parameters of the signal and receiver SatPhyRx entity of each reception
      */
-    void ScheduleRx(Ptr<SatSignalParameters> txParams, Ptr<SatPhyRx> phyRx);
+    void StartRxBatch(RxBatch_t batch);
 
     /**
      * \brief Used internally to start the packet reception of at the phyRx.
@@ -313,6 +473,37 @@ class SatChannel : public Channel
      */
     void DoRxPowerCalculation(Ptr<SatSignalParameters> rxParams, Ptr<SatPhyRx> phyRx);
 
+    /**
+     * \brief Get the geometric part of the link budget, either from the link budget
+     * cache or by calculating it.
+     * \param rxParams Rx parameters
+     * \param phyRx The receiver SatPhyRx entity
+     * \param gainMobility Mobility of the UT or GW, used when getting antenna gains
+     * \param txAntennaGain_W Transmitter antenna gain (output)
+     * \param rxAntennaGain_W Receiver antenna gain (output)
+     * \param fsl Free space loss (output)
+     */
+    void GetLinkBudget(Ptr<SatSignalParameters> rxParams,
+                       Ptr<SatPhyRx> phyRx,
+                       Ptr<MobilityModel> gainMobility,
+                       double& txAntennaGain_W,
+                       double& rxAntennaGain_W,
+                       double& fsl);
+
+    /**
+     * \brief Check whether a transmission causes interference above the interference floor
+     * at a receiver in another beam. The interference is evaluated without fading, with
+     * the highest satellite antenna gain over the beam of the UT and the current free
+     * space loss of the link.
+     * \param txParams Parameters of the signal being transmitted
+     * \param phyRx The receiver SatPhyRx entity
+     * \param ifPower_W Highest interference power at the receiver (output)
+     * \return true if the interference is significant, false if it may be culled
+     */
+    bool IsInterferenceSignificant(Ptr<SatSignalParameters> txParams,
+                                   Ptr<SatPhyRx> phyRx,
+                                   double& ifPower_W);
+
     /**
      * \brief Function for getting the external source fading value
      * \param rxParams Rx parameters
@@ -321,6 +512,17 @@ class SatChannel : public Channel
      */
     double GetExternalFadingTrace(Ptr<SatSignalParameters> rxParams, Ptr<SatPhyRx> phyRx);
 
+    /**
+     * \brief Function for getting the handle to the input trace of a reception
+     * in the current Rx power calculation mode, resolving it from the input
+     * trace container when it does not match the address of the reception
+     * \param rxParams Rx parameters
+     * \param phyRx The receiver SatPhyRx entity
+     * \return handle to the input trace
+     */
+    SatInputTraceHandle& GetInputTraceHandle(Ptr<SatSignalParameters> rxParams,
+                                             Ptr<SatPhyRx> phyRx);
+
     /**
      * \brief Function for getting the source MAC address from Rx parameters
      * \param rxParams Rx parameters
@@ -75,7 +75,7 @@ SatConstantInterference::DoAdd(Time duration, double power, Address rxAddress)
     return event;
 }
 
-std::vector<std::pair<double, double>>
+const SatFragmentVector&
 SatConstantInterference::DoCalculate(Ptr<SatInterference::InterferenceChangeEvent> event)
 {
     NS_LOG_FUNCTION(this);
@@ -86,10 +86,10 @@ SatConstantInterference::DoCalculate(Ptr<SatInterference::InterferenceChangeEven
                     " this should be fine, but with dedicated access prohibited!");
     }
 
-    std::vector<std::pair<double, double>> ifPowerPerFragment;
-    ifPowerPerFragment.emplace_back(1.0, m_power);
+    m_ifPowerPerPacket.Clear();
+    m_ifPowerPerPacket.Add(1.0, m_power);
 
-    return ifPowerPerFragment;
+    return m_ifPowerPerPacket;
 }
 
 void
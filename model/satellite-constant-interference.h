@@ -78,7 +78,7 @@ class SatConstantInterference : public SatInterference
      *
      * \return Final power value at end of receiving
      */
-    virtual std::vector<std::pair<double, double>> DoCalculate(
+    virtual const SatFragmentVector& DoCalculate(
         Ptr<SatInterference::InterferenceChangeEvent> event);
 
     /**
@@ -112,6 +112,11 @@ class SatConstantInterference : public SatInterference
      *
      */
     bool m_rxing;
+
+    /**
+     * \brief Calculated interference, reused between calculations
+     */
+    SatFragmentVector m_ifPowerPerPacket;
 };
 
 } // namespace ns3
@@ -29,6 +29,7 @@
 #include <ns3/string.h>
 
 #include <fstream>
+#include <set>
 
 NS_LOG_COMPONENT_DEFINE("SatFadingExternalInputTraceContainer");
 
@@ -111,6 +112,7 @@ SatFadingExternalInputTraceContainer::~SatFadingExternalInputTraceContainer()
 
     m_utFadingMap.clear();
     m_gwFadingMap.clear();
+    m_loadedTraces.clear();
 }
 
 void
@@ -325,6 +327,41 @@ SatFadingExternalInputTraceContainer::TestFadingTraces(uint32_t numOfUts, uint32
     return true;
 }
 
+uint32_t
+SatFadingExternalInputTraceContainer::ConvertFadingTraces()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (!m_indexFilesLoaded)
+    {
+        LoadIndexFiles();
+    }
+
+    // the file types follow CreateUtFadingTrace and CreateGwFadingTrace
+    std::set<TraceInputKey_t> traces;
+    const TraceFileContainer_t* twoColumnFiles[] = {&m_utRtnUpFileNames,
+                                                    &m_gwRtnDownFileNames,
+                                                    &m_gwFwdUpFileNames};
+    for (const TraceFileContainer_t* files : twoColumnFiles)
+    {
+        for (const TraceFileContainerItem_t& item : *files)
+        {
+            traces.insert(std::make_pair(SatFadingExternalInputTrace::FT_TWO_COLUMN, item.first));
+        }
+    }
+    for (const TraceFileContainerItem_t& item : m_utFwdDownFileNames)
+    {
+        traces.insert(std::make_pair(SatFadingExternalInputTrace::FT_THREE_COLUMN, item.first));
+    }
+
+    for (const TraceInputKey_t& trace : traces)
+    {
+        SatFadingExternalInputTrace::ConvertToLinear(trace.first, m_dataPath + trace.second);
+    }
+
+    return traces.size();
+}
+
 void
 SatFadingExternalInputTraceContainer::ReadIndexFile(std::string indexFile,
                                                     TraceFileContainer_t& container)
@@ -414,14 +451,16 @@ SatFadingExternalInputTraceContainer::CreateFadingTrace(
     NS_LOG_INFO("Creation info: Mode=" << m_utInputMode << ", ID (GW/UT)=" << id
                                        << ", FileName=" << fileName);
 
-    // find from loaded list
+    // find from loaded list, a file is mapped once for all the nodes using it
 
-    TraceInputContainer_t::iterator it = m_loadedTraces.find(fileName);
+    TraceInputKey_t key = std::make_pair(fileType, fileName);
+    TraceInputContainer_t::iterator it = m_loadedTraces.find(key);
 
     if (it == m_loadedTraces.end())
     {
         // create if not found
         trace = Create<SatFadingExternalInputTrace>(fileType, m_dataPath + fileName);
+        m_loadedTraces.insert(std::make_pair(key, trace));
     }
     else
     {
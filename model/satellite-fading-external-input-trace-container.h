@@ -101,11 +101,19 @@ class SatFadingExternalInputTraceContainer : public Object
      */
     bool TestFadingTraces(uint32_t numOfUts, uint32_t numOfGws);
 
+    /**
+     * \brief Convert the fading values of all the trace files listed in the
+     * index files to linear format, written next to the trace files.
+     * \return number of converted trace files
+     */
+    uint32_t ConvertFadingTraces();
+
   private:
     typedef std::pair<std::string, GeoCoordinate> TraceFileContainerItem_t;
     typedef std::vector<TraceFileContainerItem_t> TraceFileContainer_t;
 
-    typedef std::map<std::string, Ptr<SatFadingExternalInputTrace>> TraceInputContainer_t;
+    typedef std::pair<SatFadingExternalInputTrace::TraceFileType_e, std::string> TraceInputKey_t;
+    typedef std::map<TraceInputKey_t, Ptr<SatFadingExternalInputTrace>> TraceInputContainer_t;
 
     /**
      * Container of the UT fading traces
@@ -167,7 +175,7 @@ class SatFadingExternalInputTraceContainer : public Object
     TraceFileContainer_t m_gwRtnDownFileNames;
 
     /**
-     * Loaded trace files
+     * Loaded trace files, by type and name, shared by the nodes using the same file
      */
     TraceInputContainer_t m_loadedTraces;
 
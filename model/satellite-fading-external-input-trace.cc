@@ -20,23 +20,49 @@
 
 #include "satellite-fading-external-input-trace.h"
 
+#include "satellite-table-bundle.h"
 #include "satellite-utils.h"
 
 #include <ns3/log.h>
+#include <ns3/ptr.h>
 #include <ns3/simulator.h>
 
-#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
 #include <fstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 NS_LOG_COMPONENT_DEFINE("SatFadingExternalInputTrace");
 
 namespace ns3
 {
 
+/// Magic number at the start of a linear fading file
+static const char LINEAR_MAGIC[8] = {'S', 'N', 'S', '3', 'F', 'L', 'N', '\0'};
+
+/// Version of the linear fading format, to be increased on any layout change
+static const uint32_t LINEAR_VERSION = 1;
+
+/// Written in native byte order, detects files converted on another architecture
+static const uint64_t LINEAR_BYTE_ORDER = 0x0102030405060708ULL;
+
 SatFadingExternalInputTrace::SatFadingExternalInputTrace()
     : m_traceFileType(),
       m_startTime(),
-      m_timeInterval()
+      m_timeInterval(),
+      m_columns(0),
+      m_sampleCount(0),
+      m_samples(0),
+      m_mapping(0),
+      m_mappingSize(0),
+      m_linearFading(0),
+      m_linearMapping(0),
+      m_linearMappingSize(0),
+      m_cursor(0)
 {
     NS_FATAL_ERROR(
         "SatFadingExternalInputTrace::SatFadingExternalInputTrace - Constructor not in use");
@@ -44,83 +70,231 @@ SatFadingExternalInputTrace::SatFadingExternalInputTrace()
 
 SatFadingExternalInputTrace::SatFadingExternalInputTrace(TraceFileType_e type, std::string fileName)
     : m_startTime(-1.0),
-      m_timeInterval(-1.0)
+      m_timeInterval(-1.0),
+      m_columns(0),
+      m_sampleCount(0),
+      m_samples(0),
+      m_mapping(0),
+      m_mappingSize(0),
+      m_linearFading(0),
+      m_linearMapping(0),
+      m_linearMappingSize(0),
+      m_cursor(0)
 {
     NS_LOG_FUNCTION(this);
 
     m_traceFileType = type;
-    ReadTrace(fileName);
+    MapTrace(fileName);
 }
 
 SatFadingExternalInputTrace::~SatFadingExternalInputTrace()
 {
     NS_LOG_FUNCTION(this);
+
+    if (m_mapping != 0)
+    {
+        munmap(m_mapping, m_mappingSize);
+    }
+
+    if (m_linearMapping != 0)
+    {
+        munmap(m_linearMapping, m_linearMappingSize);
+    }
 }
 
 void
-SatFadingExternalInputTrace::ReadTrace(std::string filePathName)
+SatFadingExternalInputTrace::MapTrace(std::string filePathName)
 {
     NS_LOG_FUNCTION(this << filePathName);
 
-    // READ FROM THE SPECIFIED INPUT FILE
-    std::ifstream* ifs = new std::ifstream(filePathName.c_str(), std::ios::in | std::ios::binary);
+    int fd = open(filePathName.c_str(), O_RDONLY);
 
-    if (!ifs->is_open())
+    if (fd < 0)
     {
         // script might be launched by test.py, try a different base path
-        delete ifs;
         filePathName = "../../" + filePathName;
-        ifs = new std::ifstream(filePathName.c_str(), std::ifstream::in);
+        fd = open(filePathName.c_str(), O_RDONLY);
 
-        if (!ifs->is_open())
+        if (fd < 0)
         {
             NS_FATAL_ERROR("The file " << filePathName << " is not found.");
         }
     }
 
-    // Currently supports two or three column formats
-    uint32_t columns = (m_traceFileType == FT_TWO_COLUMN) ? 2 : 3;
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        close(fd);
+        NS_FATAL_ERROR("The file " << filePathName << " cannot be read.");
+    }
 
-    float temp;
-    int32_t count(0);
-    std::vector<float> values;
-    ifs->read((char*)&temp, sizeof(float));
-    m_startTime = temp;
+    // Currently supports two or three column formats, an incomplete last row is ignored
+    m_columns = (m_traceFileType == FT_TWO_COLUMN) ? 2 : 3;
+    m_sampleCount = st.st_size / (m_columns * sizeof(float));
 
-    // While state is good
-    while (ifs->good())
+    if (m_sampleCount < 2)
     {
-        // Store previous value
-        values.push_back(temp);
+        close(fd);
+        NS_FATAL_ERROR("The file " << filePathName << " does not hold two fading samples.");
+    }
 
-        // Read the new value
-        ++count;
-        ifs->read((char*)&temp, sizeof(float));
+    // the mapping stays valid after the descriptor is closed
+    void* mapping = mmap(0, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
 
-        // Handle previous value
-        if (count % columns == 0)
-        {
-            NS_ASSERT(values.size() == columns);
+    if (mapping == MAP_FAILED)
+    {
+        NS_FATAL_ERROR("The file " << filePathName << " cannot be mapped.");
+    }
 
-            m_traceVector.push_back(values);
-            values.clear();
+    m_mapping = mapping;
+    m_mappingSize = st.st_size;
+    m_samples = static_cast<const float*>(mapping);
 
-            // Calculate the sampling interval
-            if (m_timeInterval < 0.0)
-            {
-                m_timeInterval = temp - m_startTime;
-            }
+    m_startTime = GetTime(0);
+    m_timeInterval = GetTime(1) - m_startTime;
+
+    // Interpolation is done in linear domain
+    if (!MapLinearFading(filePathName))
+    {
+        m_convertedLinearFading.resize(m_sampleCount);
+        for (uint32_t i = 0; i < m_sampleCount; i++)
+        {
+            m_convertedLinearFading[i] =
+                SatUtils::DbToLinear(m_samples[i * m_columns + FADING_INDEX]);
         }
+        m_linearFading = m_convertedLinearFading.data();
+    }
+
+    NS_LOG_INFO("Fading trace " << filePathName << " mapped with " << m_sampleCount
+                                << " samples");
+}
+
+bool
+SatFadingExternalInputTrace::MapLinearFading(std::string filePathName)
+{
+    NS_LOG_FUNCTION(this << filePathName);
+
+    std::string linearPath = GetLinearPath(filePathName);
+    int fd = open(linearPath.c_str(), O_RDONLY);
+
+    if (fd < 0)
+    {
+        NS_LOG_INFO("No linear fading file at " << linearPath << ", fading is converted");
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (uint64_t)st.st_size < sizeof(linearHeader_s))
+    {
+        NS_LOG_WARN("Linear fading file " << linearPath << " is truncated, fading is converted");
+        close(fd);
+        return false;
+    }
+
+    // the mapping stays valid after the descriptor is closed
+    void* mapping = mmap(0, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (mapping == MAP_FAILED)
+    {
+        NS_LOG_WARN("Linear fading file " << linearPath
+                                          << " cannot be mapped, fading is converted");
+        return false;
+    }
+
+    const linearHeader_s* header = static_cast<const linearHeader_s*>(mapping);
+
+    if (std::memcmp(header->m_magic, LINEAR_MAGIC, sizeof(LINEAR_MAGIC)) != 0 ||
+        header->m_version != LINEAR_VERSION || header->m_byteOrder != LINEAR_BYTE_ORDER ||
+        header->m_columns != m_columns || header->m_sampleCount != m_sampleCount ||
+        (uint64_t)st.st_size != sizeof(linearHeader_s) + (uint64_t)m_sampleCount * sizeof(float))
+    {
+        NS_LOG_WARN("Linear fading file " << linearPath
+                                          << " has an unsupported format, fading is converted");
+        munmap(mapping, st.st_size);
+        return false;
+    }
+
+    uint64_t sourceSize, sourceHash;
+    if (!SatTableBundle::GetSourceDigest(filePathName, sourceSize, sourceHash) ||
+        sourceSize != header->m_sourceSize || sourceHash != header->m_sourceHash)
+    {
+        NS_LOG_INFO("Linear fading file " << linearPath << " is stale, fading is converted");
+        munmap(mapping, st.st_size);
+        return false;
+    }
+
+    m_linearMapping = mapping;
+    m_linearMappingSize = st.st_size;
+    m_linearFading = reinterpret_cast<const float*>(header + 1);
+
+    NS_LOG_INFO("Linear fading file " << linearPath << " mapped");
+
+    return true;
+}
+
+void
+SatFadingExternalInputTrace::WriteLinearFading(std::string filePathName) const
+{
+    NS_LOG_FUNCTION(this << filePathName);
+
+    linearHeader_s header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.m_magic, LINEAR_MAGIC, sizeof(LINEAR_MAGIC));
+    header.m_version = LINEAR_VERSION;
+    header.m_columns = m_columns;
+    header.m_sampleCount = m_sampleCount;
+    header.m_byteOrder = LINEAR_BYTE_ORDER;
+
+    if (!SatTableBundle::GetSourceDigest(filePathName, header.m_sourceSize, header.m_sourceHash))
+    {
+        NS_FATAL_ERROR("SatFadingExternalInputTrace::WriteLinearFading - The file "
+                       << filePathName << " is not found.");
+    }
+
+    // write aside and rename, running simulations keep their mapping of the previous file
+    std::string linearPath = GetLinearPath(filePathName);
+    std::string tmpPath = linearPath + ".tmp";
+    std::ofstream ofs(tmpPath.c_str(), std::ofstream::out | std::ofstream::binary);
+
+    if (!ofs.is_open())
+    {
+        NS_FATAL_ERROR("SatFadingExternalInputTrace::WriteLinearFading - The file "
+                       << tmpPath << " cannot be created.");
+    }
+
+    ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    ofs.write(reinterpret_cast<const char*>(m_linearFading), m_sampleCount * sizeof(float));
+    ofs.close();
+
+    if (ofs.fail() || std::rename(tmpPath.c_str(), linearPath.c_str()) != 0)
+    {
+        NS_FATAL_ERROR("SatFadingExternalInputTrace::WriteLinearFading - The file "
+                       << linearPath << " cannot be written.");
     }
-    ifs->close();
-    delete ifs;
+}
+
+std::string
+SatFadingExternalInputTrace::GetLinearPath(std::string filePathName)
+{
+    return filePathName + ".lin";
+}
+
+void
+SatFadingExternalInputTrace::ConvertToLinear(TraceFileType_e type, std::string filePathName)
+{
+    NS_LOG_FUNCTION(type << filePathName);
+
+    Ptr<SatFadingExternalInputTrace> trace =
+        Create<SatFadingExternalInputTrace>(type, filePathName);
+    trace->WriteLinearFading(filePathName);
 }
 
 double
 SatFadingExternalInputTrace::GetFading() const
 {
     NS_LOG_FUNCTION(this);
-    NS_ASSERT(!m_traceVector.empty());
 
     float simTime = Simulator::Now().GetSeconds();
 
@@ -129,33 +303,40 @@ SatFadingExternalInputTrace::GetFading() const
         NS_LOG_ERROR(this << " requested time is smaller than the minimum time value!");
     }
 
-    // Calculate the index to the time sample just before current time
-    uint32_t lowerIndex = (uint32_t)(std::floor(std::abs(simTime - m_startTime) / m_timeInterval));
+    if (simTime > GetTime(m_sampleCount - 1))
+    {
+        NS_LOG_ERROR(this << " requested time exceeds the trace file!");
+    }
+
+    uint32_t lastIndex = m_sampleCount - 2;
 
-    if (lowerIndex >= m_traceVector.size())
+    if (simTime < GetTime(m_cursor) ||
+        (m_cursor < lastIndex && simTime >= GetTime(m_cursor + 2)))
     {
-        NS_LOG_ERROR(this << " calculated index exceeds trace file size!");
+        // Far from the cursor, calculate the index to the time sample just
+        // before current time from the constant interval
+        float position = std::floor((simTime - m_startTime) / m_timeInterval);
+        m_cursor = (position <= 0) ? 0 : (position >= lastIndex) ? lastIndex : (uint32_t)position;
     }
 
-    float lowerKey = m_traceVector.at(lowerIndex).at(TIME_INDEX);
-    float upperKey = m_traceVector.at(lowerIndex + 1).at(TIME_INDEX);
+    // Move the cursor to the samples surrounding current time
+    while (m_cursor > 0 && simTime < GetTime(m_cursor))
+    {
+        --m_cursor;
+    }
+    while (m_cursor < lastIndex && GetTime(m_cursor + 1) <= simTime)
+    {
+        ++m_cursor;
+    }
 
-    // Interpolation in linear domain
-    float lowerVal = SatUtils::DbToLinear(m_traceVector.at(lowerIndex).at(FADING_INDEX));
-    float upperVal = SatUtils::DbToLinear(m_traceVector.at(lowerIndex + 1).at(FADING_INDEX));
+    float lowerKey = GetTime(m_cursor);
+    float upperKey = GetTime(m_cursor + 1);
+    float lowerVal = m_linearFading[m_cursor];
+    float upperVal = m_linearFading[m_cursor + 1];
 
     // y = y0 + (y1 - y0) * (x - x0) / (x1 - x0)
     double fading = lowerVal + (upperVal - lowerVal) * (simTime - lowerKey) / (upperKey - lowerKey);
 
-    /*
-    std::cout << "Now: " << simTime <<
-        ", interpolated fading: " << fading_dB <<
-        ", interpolated fading: " << SatUtils::DbToLinear (fading_dB) <<
-        ", Lower time: " << lowerKey <<
-        ", Upper time: " << upperKey <<
-        ", Lower fading: " << lowerVal <<
-        ", Upper fading: " << upperVal << std::endl;
-    */
     return fading;
 }
 
@@ -163,17 +344,16 @@ bool
 SatFadingExternalInputTrace::TestFadingTrace() const
 {
     NS_LOG_FUNCTION(this);
-    NS_ASSERT(!m_traceVector.empty());
+    NS_ASSERT(m_sampleCount > 0);
 
-    std::vector<std::vector<float>>::const_iterator cit;
     float prevTime(-1.0);
     float currTime(-1.0);
 
-    for (cit = m_traceVector.begin(); cit != m_traceVector.end(); ++cit)
+    for (uint32_t i = 0; i < m_sampleCount; i++)
     {
         if (prevTime > 0)
         {
-            currTime = cit->at(TIME_INDEX);
+            currTime = GetTime(i);
             double diff = std::abs(std::abs(currTime - prevTime) - m_timeInterval);
 
             // Test that the the time samples are from constant interval and
@@ -183,7 +363,7 @@ SatFadingExternalInputTrace::TestFadingTrace() const
                 return false;
             }
         }
-        prevTime = cit->at(TIME_INDEX);
+        prevTime = GetTime(i);
     }
 
     // Succeeded
@@ -23,6 +23,8 @@
 
 #include <ns3/simple-ref-count.h>
 
+#include <stdint.h>
+#include <string>
 #include <vector>
 
 namespace ns3
@@ -33,6 +35,24 @@ namespace ns3
  * \brief The class for satellite fading external input trace. The class reads
  * fading trace input samples from a file and provides the current fading value
  * for this specific fading file.
+ *
+ * The trace file is a sequence of binary float rows, which is memory mapped
+ * read-only instead of being copied, so that the simulations running on a
+ * host share its pages. A trace object is created once per file by
+ * SatFadingExternalInputTraceContainer and shared by all the terminals using
+ * the file.
+ *
+ * The fading values are interpolated in linear format. They are read from a
+ * linear fading file next to the trace file, with the .lin extension added,
+ * written by the sat-convert-fading-traces program and mapped as the trace
+ * file. The linear fading file is ignored when the size or the content hash
+ * of the trace file differ from the ones recorded at the conversion, in which
+ * case the fading values are converted to linear format in memory when the
+ * trace is loaded.
+ *
+ * The fading is read at the current simulation time, through a cursor to the
+ * samples surrounding the last requested time. The cursor advances with the
+ * simulation time, and is moved back only when the simulation is restarted.
  */
 class SatFadingExternalInputTrace : public SimpleRefCount<SatFadingExternalInputTrace>
 {
@@ -73,12 +93,66 @@ class SatFadingExternalInputTrace : public SimpleRefCount<SatFadingExternalInput
      */
     bool TestFadingTrace() const;
 
+    /**
+     * \brief Get the path of the linear fading file of a fading trace
+     * \param filePathName Path of the fading trace file
+     * \return Path with the .lin extension added
+     */
+    static std::string GetLinearPath(std::string filePathName);
+
+    /**
+     * \brief Convert the fading values of a fading trace to linear format,
+     * written in the linear fading file next to it.
+     * \param type Type of the fading trace file
+     * \param filePathName Path of the fading trace file
+     */
+    static void ConvertToLinear(TraceFileType_e type, std::string filePathName);
+
   private:
     /**
-     * Read the fading trace from a binary file
+     * \brief Linear fading file header. It is followed by the linear fading
+     * values of the samples as floats.
+     */
+    typedef struct
+    {
+        char m_magic[8];
+        uint32_t m_version;
+        uint32_t m_columns;
+        uint32_t m_sampleCount;
+        uint32_t m_reserved;
+        uint64_t m_byteOrder;
+        uint64_t m_sourceSize;
+        uint64_t m_sourceHash;
+    } linearHeader_s;
+
+    /**
+     * Map the fading trace from a binary file
      * \param filePathName Path and file name of the fading file
      */
-    void ReadTrace(std::string filePathName);
+    void MapTrace(std::string filePathName);
+
+    /**
+     * \brief Map the linear fading file of the fading trace
+     * \param filePathName Path of the fading trace file
+     * \return true if an up to date linear fading file was mapped
+     */
+    bool MapLinearFading(std::string filePathName);
+
+    /**
+     * \brief Write the linear fading values in the linear fading file
+     * \param filePathName Path of the fading trace file
+     */
+    void WriteLinearFading(std::string filePathName) const;
+
+    /**
+     * Get the time of a sample of the fading trace
+     * \param index Index of the sample
+     * \return time of the sample in seconds
+     */
+    inline float GetTime(uint32_t index) const
+    {
+        return m_samples[index * m_columns + TIME_INDEX];
+    }
 
     /**
      * There may be different fading file types.
@@ -109,9 +183,55 @@ class SatFadingExternalInputTrace : public SimpleRefCount<SatFadingExternalInput
     float m_timeInterval;
 
     /**
-     * Container for the fading trace.
+     * Number of columns of the fading trace file
+     */
+    uint32_t m_columns;
+
+    /**
+     * Number of samples (rows) of the fading trace
+     */
+    uint32_t m_sampleCount;
+
+    /**
+     * Samples of the fading trace, row by row, in the mapped file
+     */
+    const float* m_samples;
+
+    /**
+     * Mapped fading trace file
+     */
+    void* m_mapping;
+
+    /**
+     * Size of the mapped fading trace file
+     */
+    uint64_t m_mappingSize;
+
+    /**
+     * Fading values of the samples in linear format. Points either to
+     * m_convertedLinearFading or to the mapped linear fading file.
+     */
+    const float* m_linearFading;
+
+    /**
+     * Fading values converted in memory, when no linear fading file is mapped
+     */
+    std::vector<float> m_convertedLinearFading;
+
+    /**
+     * Mapped linear fading file, 0 if not mapped
+     */
+    void* m_linearMapping;
+
+    /**
+     * Size of the mapped linear fading file
+     */
+    uint64_t m_linearMappingSize;
+
+    /**
+     * Index of the sample just before the last requested time
      */
-    std::vector<std::vector<float>> m_traceVector;
+    mutable uint32_t m_cursor;
 };
 
 } // namespace ns3
@@ -154,7 +154,7 @@ SatFadingInputTraceContainer::GetFadingValue(key_t key)
 {
     NS_LOG_FUNCTION(this);
 
-    return FindNode(key)->ProceedToNextClosestTimeSample().at(
+    return FindNode(key)->ProceedToNextClosestTimeSampleValue(
         SatBaseTraceContainer::FADING_TRACE_DEFAULT_FADING_VALUE_INDEX);
 }
 
@@ -0,0 +1,206 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+#include "satellite-fading-oscillator-bank.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ns3
+{
+
+const std::size_t SatFadingOscillatorBank::BLOCK_SIZE;
+
+SatFadingOscillatorBank::SatFadingOscillatorBank()
+    : m_amplitudesReal(),
+      m_amplitudesImag(),
+      m_phases(),
+      m_omegas()
+{
+}
+
+void
+SatFadingOscillatorBank::Clear()
+{
+    m_amplitudesReal.clear();
+    m_amplitudesImag.clear();
+    m_phases.clear();
+    m_omegas.clear();
+}
+
+void
+SatFadingOscillatorBank::Reserve(std::size_t count)
+{
+    m_amplitudesReal.reserve(count);
+    m_amplitudesImag.reserve(count);
+    m_phases.reserve(count);
+    m_omegas.reserve(count);
+}
+
+void
+SatFadingOscillatorBank::ComputePhases(const double* omegas,
+                                       const double* phases,
+                                       double timeInSeconds,
+                                       std::size_t count,
+                                       double* cosines,
+                                       double* sines)
+{
+    for (std::size_t i = 0; i < count; i++)
+    {
+        cosines[i] = std::cos(timeInSeconds * omegas[i] + phases[i]);
+    }
+
+    if (sines)
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            sines[i] = std::sin(timeInSeconds * omegas[i] + phases[i]);
+        }
+    }
+}
+
+std::complex<double>
+SatFadingOscillatorBank::GetComplexSumAt(double timeInSeconds) const
+{
+    double cosines[BLOCK_SIZE];
+    double sumReal = 0.0;
+    double sumImag = 0.0;
+
+    std::size_t count = m_omegas.size();
+    for (std::size_t start = 0; start < count; start += BLOCK_SIZE)
+    {
+        std::size_t size = std::min(BLOCK_SIZE, count - start);
+        ComputePhases(&m_omegas[start], &m_phases[start], timeInSeconds, size, cosines, nullptr);
+
+        const double* amplitudesReal = &m_amplitudesReal[start];
+        const double* amplitudesImag = &m_amplitudesImag[start];
+        for (std::size_t i = 0; i < size; i++)
+        {
+            sumReal += amplitudesReal[i] * cosines[i];
+            sumImag += amplitudesImag[i] * cosines[i];
+        }
+    }
+
+    return std::complex<double>(sumReal, sumImag);
+}
+
+std::complex<double>
+SatFadingOscillatorBank::GetCosineWaveSumAt(double timeInSeconds) const
+{
+    double cosines[BLOCK_SIZE];
+    double sines[BLOCK_SIZE];
+    std::complex<double> sum(0.0, 0.0);
+
+    std::size_t count = m_omegas.size();
+    for (std::size_t start = 0; start < count; start += BLOCK_SIZE)
+    {
+        std::size_t size = std::min(BLOCK_SIZE, count - start);
+        ComputePhases(&m_omegas[start], &m_phases[start], timeInSeconds, size, cosines, sines);
+
+        const double* amplitudes = &m_amplitudesReal[start];
+        for (std::size_t i = 0; i < size; i++)
+        {
+            sum += amplitudes[i] * std::exp(std::complex<double>(cosines[i], sines[i]));
+        }
+    }
+
+    return sum;
+}
+
+void
+SatFadingOscillatorBank::GetComplexSumsAt(const std::vector<double>& timesInSeconds,
+                                          std::vector<std::complex<double>>& sums) const
+{
+    double sumsReal[BLOCK_SIZE];
+    double sumsImag[BLOCK_SIZE];
+    double cosines[BLOCK_SIZE];
+
+    // the times are processed by blocks, each oscillator being added to all
+    // the sums of the block in turn: the phases of an oscillator at many
+    // times are computed together, and the sums add the oscillators in order
+    sums.resize(timesInSeconds.size());
+    std::size_t count = m_omegas.size();
+    for (std::size_t start = 0; start < timesInSeconds.size(); start += BLOCK_SIZE)
+    {
+        std::size_t size = std::min(BLOCK_SIZE, timesInSeconds.size() - start);
+        const double* times = &timesInSeconds[start];
+        std::fill(sumsReal, sumsReal + size, 0.0);
+        std::fill(sumsImag, sumsImag + size, 0.0);
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            double omega = m_omegas[i];
+            double phase = m_phases[i];
+            for (std::size_t k = 0; k < size; k++)
+            {
+                cosines[k] = std::cos(times[k] * omega + phase);
+            }
+
+            double amplitudeReal = m_amplitudesReal[i];
+            double amplitudeImag = m_amplitudesImag[i];
+            for (std::size_t k = 0; k < size; k++)
+            {
+                sumsReal[k] += amplitudeReal * cosines[k];
+                sumsImag[k] += amplitudeImag * cosines[k];
+            }
+        }
+
+        for (std::size_t k = 0; k < size; k++)
+        {
+            sums[start + k] = std::complex<double>(sumsReal[k], sumsImag[k]);
+        }
+    }
+}
+
+void
+SatFadingOscillatorBank::GetCosineWaveSumsAt(const std::vector<double>& timesInSeconds,
+                                             std::vector<std::complex<double>>& sums) const
+{
+    double cosines[BLOCK_SIZE];
+    double sines[BLOCK_SIZE];
+
+    sums.assign(timesInSeconds.size(), std::complex<double>(0.0, 0.0));
+    std::size_t count = m_omegas.size();
+    for (std::size_t start = 0; start < timesInSeconds.size(); start += BLOCK_SIZE)
+    {
+        std::size_t size = std::min(BLOCK_SIZE, timesInSeconds.size() - start);
+        const double* times = &timesInSeconds[start];
+        std::complex<double>* blockSums = &sums[start];
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            double omega = m_omegas[i];
+            double phase = m_phases[i];
+            for (std::size_t k = 0; k < size; k++)
+            {
+                cosines[k] = std::cos(times[k] * omega + phase);
+                sines[k] = std::sin(times[k] * omega + phase);
+            }
+
+            double amplitude = m_amplitudesReal[i];
+            for (std::size_t k = 0; k < size; k++)
+            {
+                blockSums[k] += amplitude * std::exp(std::complex<double>(cosines[k], sines[k]));
+            }
+        }
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,158 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+#ifndef SATELLITE_FADING_OSCILLATOR_BANK_H
+#define SATELLITE_FADING_OSCILLATOR_BANK_H
+
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup satellite
+ * \brief Bank of the fading oscillators of a channel state, summed as in
+ * the Jakes model.
+ *
+ * The oscillators behave as SatFadingOscillator instances: oscillator n has
+ * a complex amplitude A_n, an initial phase phi_n and a rotation speed
+ * omega_n. The complex sum at time t is
+ *
+ *   sum_n A_n * cos(omega_n * t + phi_n)
+ *
+ * and the cosine wave sum, for real amplitudes, is
+ *
+ *   sum_n A_n * exp(cos(omega_n * t + phi_n) + i * sin(omega_n * t + phi_n))
+ *
+ * Amplitudes, phases and rotation speeds are stored in separate contiguous
+ * arrays instead of one object per oscillator. The cosines and sines of a
+ * block of oscillators are computed together, then the oscillators are
+ * accumulated in their order, so that the sums are the same as the ones of
+ * the SatFadingOscillator instances. The block loop calls std::cos and
+ * std::sin, it is only vectorized when built with -ffast-math and a vector
+ * math library such as libmvec.
+ */
+class SatFadingOscillatorBank
+{
+  public:
+    /**
+     * Default constructor, no oscillator.
+     */
+    SatFadingOscillatorBank();
+
+    /**
+     * Remove all oscillators, keeping the allocated storage.
+     */
+    void Clear();
+
+    /**
+     * Reserve storage for a number of oscillators.
+     *
+     * \param count Number of oscillators
+     */
+    void Reserve(std::size_t count);
+
+    /**
+     * Append an oscillator.
+     *
+     * \param amplitude Complex amplitude, real for the cosine wave sum
+     * \param initialPhase Initial phase
+     * \param omega Rotation speed
+     */
+    inline void Add(std::complex<double> amplitude, double initialPhase, double omega)
+    {
+        m_amplitudesReal.push_back(amplitude.real());
+        m_amplitudesImag.push_back(amplitude.imag());
+        m_phases.push_back(initialPhase);
+        m_omegas.push_back(omega);
+    }
+
+    /**
+     * \return Number of oscillators
+     */
+    inline std::size_t GetSize() const
+    {
+        return m_omegas.size();
+    }
+
+    /**
+     * \brief Sum the complex values of the oscillators
+     * \param timeInSeconds Time in seconds
+     * \return Sum of A_n * cos(omega_n * t + phi_n)
+     */
+    std::complex<double> GetComplexSumAt(double timeInSeconds) const;
+
+    /**
+     * \brief Sum the cosine wave values of the oscillators
+     * \param timeInSeconds Time in seconds
+     * \return Sum of A_n * exp(cos(omega_n * t + phi_n) + i * sin(omega_n * t + phi_n))
+     */
+    std::complex<double> GetCosineWaveSumAt(double timeInSeconds) const;
+
+    /**
+     * \brief Sum the complex values of the oscillators at many times
+     * \param timesInSeconds Times in seconds
+     * \param sums The sums, one per time
+     */
+    void GetComplexSumsAt(const std::vector<double>& timesInSeconds,
+                          std::vector<std::complex<double>>& sums) const;
+
+    /**
+     * \brief Sum the cosine wave values of the oscillators at many times
+     * \param timesInSeconds Times in seconds
+     * \param sums The sums, one per time
+     */
+    void GetCosineWaveSumsAt(const std::vector<double>& timesInSeconds,
+                             std::vector<std::complex<double>>& sums) const;
+
+  private:
+    /**
+     * Number of oscillators, or of times, whose phases are computed together
+     */
+    static const std::size_t BLOCK_SIZE = 64;
+
+    /**
+     * \brief Phase kernel over contiguous arrays.
+     *
+     * \param omegas Rotation speeds
+     * \param phases Initial phases
+     * \param timeInSeconds Time in seconds
+     * \param count Number of oscillators
+     * \param cosines Cosines of the phases at the time
+     * \param sines Sines of the phases at the time, not computed if 0
+     */
+    static void ComputePhases(const double* omegas,
+                              const double* phases,
+                              double timeInSeconds,
+                              std::size_t count,
+                              double* cosines,
+                              double* sines);
+
+    std::vector<double> m_amplitudesReal;
+    std::vector<double> m_amplitudesImag;
+    std::vector<double> m_phases;
+    std::vector<double> m_omegas;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_FADING_OSCILLATOR_BANK_H */
@@ -0,0 +1,72 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+#include "satellite-fragment-vector.h"
+
+namespace ns3
+{
+
+SatFragmentVector::SatFragmentVector()
+    : m_durations(),
+      m_values()
+{
+}
+
+SatFragmentVector::SatFragmentVector(double duration, double value)
+    : m_durations(1, duration),
+      m_values(1, value)
+{
+}
+
+void
+SatFragmentVector::Clear()
+{
+    m_durations.clear();
+    m_values.clear();
+}
+
+void
+SatFragmentVector::Reserve(std::size_t count)
+{
+    m_durations.reserve(count);
+    m_values.reserve(count);
+}
+
+double
+SatFragmentVector::GetWeightedSum() const
+{
+    return WeightedSum(m_durations.data(), m_values.data(), m_durations.size());
+}
+
+double
+SatFragmentVector::WeightedSum(const double* durations, const double* values, std::size_t count)
+{
+    // Summed in fragment order, as the former scalar product of the
+    // fragment pairs, so that results stay bit identical
+    double sum = 0.0;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        sum += durations[i] * values[i];
+    }
+
+    return sum;
+}
+
+} // namespace ns3
@@ -0,0 +1,173 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+#ifndef SATELLITE_FRAGMENT_VECTOR_H
+#define SATELLITE_FRAGMENT_VECTOR_H
+
+#include <cstddef>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup satellite
+ * \brief Piecewise constant value over the duration of a packet, e.g. the
+ * interference power or the SINR per packet fragment.
+ *
+ * Fragment i covers GetDuration(i) of the packet, as a fraction of the
+ * packet duration, with value GetValue(i). As an example, the fragments
+ * {(0.25, x), (0.5, y), (0.25, z)} represent the following values on the
+ * packet:
+ *
+ *  +---+-----+---+
+ *  | x |  y  | z |
+ *  +---+-----+---+
+ *  0   ¼     ¾   1
+ *
+ * Durations and values are stored in two separate contiguous arrays that
+ * the weighted sum walks linearly, in fragment order so that results stay
+ * bit identical to a scalar product of the pairs. Clear() and assignment
+ * keep the allocated storage, so a vector rebuilt for every packet or every
+ * SIC pass only allocates when it grows.
+ */
+class SatFragmentVector
+{
+  public:
+    /**
+     * Default constructor, no fragment.
+     */
+    SatFragmentVector();
+
+    /**
+     * Constructor with a single fragment.
+     *
+     * \param duration Duration of the fragment as a fraction of the packet
+     * \param value Value on the fragment
+     */
+    SatFragmentVector(double duration, double value);
+
+    /**
+     * Remove all fragments, keeping the allocated storage.
+     */
+    void Clear();
+
+    /**
+     * Reserve storage for a number of fragments.
+     *
+     * \param count Number of fragments
+     */
+    void Reserve(std::size_t count);
+
+    /**
+     * Append a fragment.
+     *
+     * \param duration Duration of the fragment as a fraction of the packet
+     * \param value Value on the fragment
+     */
+    inline void Add(double duration, double value)
+    {
+        m_durations.push_back(duration);
+        m_values.push_back(value);
+    }
+
+    /**
+     * \return Number of fragments
+     */
+    inline std::size_t GetSize() const
+    {
+        return m_durations.size();
+    }
+
+    /**
+     * \return Whether there is no fragment
+     */
+    inline bool IsEmpty() const
+    {
+        return m_durations.empty();
+    }
+
+    /**
+     * \param index Index of the fragment
+     * \return Duration of the fragment as a fraction of the packet
+     */
+    inline double GetDuration(std::size_t index) const
+    {
+        return m_durations[index];
+    }
+
+    /**
+     * \param index Index of the fragment
+     * \return Value on the fragment
+     */
+    inline double GetValue(std::size_t index) const
+    {
+        return m_values[index];
+    }
+
+    /**
+     * \return Contiguous array of the fragment durations
+     */
+    inline const double* GetDurations() const
+    {
+        return m_durations.data();
+    }
+
+    /**
+     * \return Contiguous array of the fragment values
+     */
+    inline const double* GetValues() const
+    {
+        return m_values.data();
+    }
+
+    /**
+     * \param index Index of the fragment
+     * \param value New value on the fragment
+     */
+    inline void SetValue(std::size_t index, double value)
+    {
+        m_values[index] = value;
+    }
+
+    /**
+     * \return Sum of the values weighted by the fragment durations, i.e. the
+     * mean value over the packet
+     */
+    double GetWeightedSum() const;
+
+    /**
+     * \brief Weighted sum kernel over contiguous arrays.
+     *
+     * \param durations Fragment durations
+     * \param values Fragment values
+     * \param count Number of fragments
+     * \return Sum of durations[i] * values[i], accumulated in fragment order
+     */
+    static double WeightedSum(const double* durations, const double* values, std::size_t count);
+
+  private:
+    std::vector<double> m_durations;
+    std::vector<double> m_values;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_FRAGMENT_VECTOR_H */
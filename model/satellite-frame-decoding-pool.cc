@@ -0,0 +1,271 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+#include "satellite-frame-decoding-pool.h"
+
+#include "satellite-phy-rx-carrier-per-frame.h"
+
+#include <ns3/boolean.h>
+#include <ns3/log.h>
+#include <ns3/simulator.h>
+#include <ns3/uinteger.h>
+
+#include <algorithm>
+
+NS_LOG_COMPONENT_DEFINE("SatFrameDecodingPool");
+
+namespace ns3
+{
+
+NS_OBJECT_ENSURE_REGISTERED(SatFrameDecodingPool);
+
+TypeId
+SatFrameDecodingPool::GetTypeId(void)
+{
+    static TypeId tid =
+        TypeId("ns3::SatFrameDecodingPool")
+            .SetParent<Object>()
+            .AddConstructor<SatFrameDecodingPool>()
+            .AddAttribute("Enabled",
+                          "Decode the CRDSA frames ending at the same time on worker threads.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&SatFrameDecodingPool::m_enabled),
+                          MakeBooleanChecker())
+            .AddAttribute("Threads",
+                          "Number of threads decoding the frames, including the simulation "
+                          "thread. 0 uses the number of hardware threads.",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&SatFrameDecodingPool::SetThreadCount,
+                                               &SatFrameDecodingPool::GetThreadCount),
+                          MakeUintegerChecker<uint32_t>());
+    return tid;
+}
+
+TypeId
+SatFrameDecodingPool::GetInstanceTypeId(void) const
+{
+    return GetTypeId();
+}
+
+SatFrameDecodingPool::SatFrameDecodingPool()
+    : m_enabled(false),
+      m_threadCount(0),
+      m_batch(0),
+      m_doneWorkers(0),
+      m_stopping(false),
+      m_nextFrame(0)
+{
+    NS_LOG_FUNCTION(this);
+
+    // Attributes are needed already in construction phase:
+    // - ConstructSelf call in constructor
+    // - GetInstanceTypeId needs to be implemented
+    ObjectBase::ConstructSelf(AttributeConstructionList());
+}
+
+SatFrameDecodingPool::~SatFrameDecodingPool()
+{
+    NS_LOG_FUNCTION(this);
+
+    StopWorkers();
+}
+
+void
+SatFrameDecodingPool::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+
+    StopWorkers();
+    m_submitted.clear();
+
+    Object::DoDispose();
+}
+
+void
+SatFrameDecodingPool::SetThreadCount(uint32_t threadCount)
+{
+    NS_LOG_FUNCTION(this << threadCount);
+
+    // the workers are started again with the new count on the next batch
+    StopWorkers();
+    m_threadCount = threadCount;
+}
+
+uint32_t
+SatFrameDecodingPool::GetThreadCount() const
+{
+    return m_threadCount;
+}
+
+void
+SatFrameDecodingPool::Submit(Ptr<SatPhyRxCarrierPerFrame> carrier, frameOrder_t order)
+{
+    NS_LOG_FUNCTION(this << carrier);
+
+    // the frame end events of the other carriers at this time are already scheduled, the
+    // decoding runs after them
+    if (m_submitted.empty())
+    {
+        Simulator::ScheduleNow(&SatFrameDecodingPool::DecodeSubmittedFrames, this);
+    }
+
+    m_submitted.push_back(std::make_pair(order, carrier));
+}
+
+void
+SatFrameDecodingPool::DecodeSubmittedFrames()
+{
+    NS_LOG_FUNCTION(this);
+
+    std::sort(m_submitted.begin(),
+              m_submitted.end(),
+              [](const std::pair<frameOrder_t, Ptr<SatPhyRxCarrierPerFrame>>& a,
+                 const std::pair<frameOrder_t, Ptr<SatPhyRxCarrierPerFrame>>& b) {
+                  return a.first < b.first;
+              });
+
+    // logging is not serialized between the threads, the frames are decoded by the simulation
+    // thread alone while a log component is enabled
+    bool useWorkers = m_submitted.size() > 1 && !IsLoggingEnabled();
+
+    if (useWorkers && m_workers.empty())
+    {
+        StartWorkers();
+    }
+
+    NS_LOG_INFO("Decoding " << m_submitted.size() << " frames with "
+                            << (useWorkers ? m_workers.size() : 0) << " worker threads");
+
+    if (useWorkers && !m_workers.empty())
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_nextFrame = 0;
+            m_doneWorkers = 0;
+            m_batch++;
+        }
+        m_batchStarted.notify_all();
+
+        DecodeFrames();
+
+        // wait for every worker, so that none of them still reads the batch when it is cleared
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_batchDone.wait(lock, [this] { return m_doneWorkers == m_workers.size(); });
+    }
+    else
+    {
+        m_nextFrame = 0;
+        DecodeFrames();
+    }
+
+    for (std::pair<frameOrder_t, Ptr<SatPhyRxCarrierPerFrame>>& frame : m_submitted)
+    {
+        Simulator::ScheduleWithContext(std::get<0>(frame.first),
+                                       Seconds(0),
+                                       &SatPhyRxCarrierPerFrame::DeliverFrame,
+                                       frame.second);
+    }
+
+    m_submitted.clear();
+}
+
+bool
+SatFrameDecodingPool::IsLoggingEnabled()
+{
+    for (const auto& component : *LogComponent::GetComponentList())
+    {
+        if (!component.second->IsNoneEnabled())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void
+SatFrameDecodingPool::DecodeFrames()
+{
+    for (uint32_t index = m_nextFrame++; index < m_submitted.size(); index = m_nextFrame++)
+    {
+        m_submitted[index].second->DecodeFrame();
+    }
+}
+
+void
+SatFrameDecodingPool::RunWorker(uint64_t batch)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (true)
+    {
+        m_batchStarted.wait(lock, [this, batch] { return m_stopping || m_batch != batch; });
+        if (m_stopping)
+        {
+            return;
+        }
+        batch = m_batch;
+
+        lock.unlock();
+        DecodeFrames();
+        lock.lock();
+
+        m_doneWorkers++;
+        m_batchDone.notify_one();
+    }
+}
+
+void
+SatFrameDecodingPool::StartWorkers()
+{
+    NS_LOG_FUNCTION(this);
+
+    uint32_t threadCount = m_threadCount;
+    if (threadCount == 0)
+    {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stopping = false;
+    for (uint32_t i = 1; i < threadCount; i++)
+    {
+        m_workers.push_back(std::thread(&SatFrameDecodingPool::RunWorker, this, m_batch));
+    }
+}
+
+void
+SatFrameDecodingPool::StopWorkers()
+{
+    NS_LOG_FUNCTION(this);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_batchStarted.notify_all();
+
+    for (std::thread& worker : m_workers)
+    {
+        worker.join();
+    }
+    m_workers.clear();
+}
+
+} // namespace ns3
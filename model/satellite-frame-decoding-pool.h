@@ -0,0 +1,219 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+#ifndef SATELLITE_FRAME_DECODING_POOL_H
+#define SATELLITE_FRAME_DECODING_POOL_H
+
+#include <ns3/object.h>
+#include <ns3/ptr.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <stdint.h>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace ns3
+{
+
+class SatPhyRxCarrierPerFrame;
+
+/**
+ * \ingroup satellite
+ *
+ * \brief Worker pool decoding the CRDSA frames of the random access carriers
+ * ending at the same time.
+ *
+ * All the random access carriers reach their frame end at the same superframe
+ * boundary. When the pool is enabled, each carrier submits its frame instead
+ * of decoding it in its own event. Once all the frame end events of the
+ * timestamp have run, the submitted frames are decoded concurrently by the
+ * worker threads and the simulation thread. The decoded frames are then
+ * delivered, traces and receive callbacks, in the order of the node, beam
+ * and carrier ids, whatever the number of threads.
+ *
+ * The decoding of a frame only uses the state of its carrier, including the
+ * random stream of the carrier, so the decoded packets do not depend on the
+ * number of threads either. The decoding reads no object shared between the
+ * carriers: the link results are resolved and the burst lengths of the
+ * waveforms cached by the simulation thread beforehand. As logging is not
+ * serialized between the threads, the frames are decoded by the simulation
+ * thread alone while a log component is enabled.
+ *
+ * The class is used through Singleton<SatFrameDecodingPool>.
+ */
+class SatFrameDecodingPool : public Object
+{
+  public:
+    /**
+     * \brief Delivery order of a frame: node id, beam id and carrier id
+     */
+    typedef std::tuple<uint32_t, uint32_t, uint32_t> frameOrder_t;
+
+    /**
+     * \brief NS-3 function for type id
+     * \return type id
+     */
+    static TypeId GetTypeId(void);
+
+    /**
+     * \brief Get the type ID of instance
+     * \return the object TypeId
+     */
+    virtual TypeId GetInstanceTypeId(void) const;
+
+    /**
+     * \brief Constructor
+     */
+    SatFrameDecodingPool();
+
+    /**
+     * \brief Destructor
+     */
+    ~SatFrameDecodingPool();
+
+    /**
+     * \return Whether the frames are decoded by the pool
+     */
+    inline bool IsEnabled() const
+    {
+        return m_enabled;
+    }
+
+    /**
+     * \brief Submit the frame of a carrier, to be decoded with the other
+     * frames ending at the current time.
+     *
+     * \param carrier Carrier whose frame ends
+     * \param order Delivery order of the frame, the node id being used as
+     * context of the delivery
+     */
+    void Submit(Ptr<SatPhyRxCarrierPerFrame> carrier, frameOrder_t order);
+
+  private:
+    virtual void DoDispose();
+
+    /**
+     * \brief Set the number of threads decoding the frames, stopping the
+     * workers of the previous count
+     * \param threadCount Number of threads, 0 for the number of hardware threads
+     */
+    void SetThreadCount(uint32_t threadCount);
+
+    /**
+     * \return Number of threads decoding the frames
+     */
+    uint32_t GetThreadCount() const;
+
+    /**
+     * \brief Decode the frames submitted at the current time and schedule
+     * their delivery
+     */
+    void DecodeSubmittedFrames();
+
+    /**
+     * \brief Check whether any log component is enabled
+     * \return true if a component logs at some level
+     */
+    static bool IsLoggingEnabled();
+
+    /**
+     * \brief Decode the submitted frames not yet taken by another thread
+     */
+    void DecodeFrames();
+
+    /**
+     * \brief Loop of a worker thread, decoding the frames of each batch
+     * \param batch Number of the last batch started before the thread
+     */
+    void RunWorker(uint64_t batch);
+
+    /**
+     * \brief Start the worker threads
+     */
+    void StartWorkers();
+
+    /**
+     * \brief Stop and join the worker threads
+     */
+    void StopWorkers();
+
+    /**
+     * \brief Enable the decoding of the frames by the pool
+     */
+    bool m_enabled;
+
+    /**
+     * \brief Number of threads decoding the frames, including the simulation
+     * thread, 0 for the number of hardware threads
+     */
+    uint32_t m_threadCount;
+
+    /**
+     * \brief Frames submitted at the current time
+     */
+    std::vector<std::pair<frameOrder_t, Ptr<SatPhyRxCarrierPerFrame>>> m_submitted;
+
+    /**
+     * \brief Worker threads
+     */
+    std::vector<std::thread> m_workers;
+
+    /**
+     * \brief Protects the batch and worker state below
+     */
+    std::mutex m_mutex;
+
+    /**
+     * \brief Signals a new batch, or the stop of the workers
+     */
+    std::condition_variable m_batchStarted;
+
+    /**
+     * \brief Signals that a worker is done with the current batch
+     */
+    std::condition_variable m_batchDone;
+
+    /**
+     * \brief Number of the current batch
+     */
+    uint64_t m_batch;
+
+    /**
+     * \brief Number of workers done with the current batch
+     */
+    uint32_t m_doneWorkers;
+
+    /**
+     * \brief Whether the workers are asked to stop
+     */
+    bool m_stopping;
+
+    /**
+     * \brief Index of the next submitted frame to decode
+     */
+    std::atomic<uint32_t> m_nextFrame;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_FRAME_DECODING_POOL_H */
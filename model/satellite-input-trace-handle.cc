@@ -0,0 +1,62 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+#include "satellite-input-trace-handle.h"
+
+namespace ns3
+{
+
+SatInputTraceHandle::SatInputTraceHandle()
+    : m_resolved(false),
+      m_address(),
+      m_generation(0),
+      m_trace(),
+      m_column(0),
+      m_constantValue(0.0)
+{
+}
+
+SatInputTraceHandle::SatInputTraceHandle(const Address& address,
+                                         uint32_t generation,
+                                         Ptr<SatInputFileStreamTimeDoubleContainer> trace,
+                                         uint32_t column)
+    : m_resolved(true),
+      m_address(address),
+      m_generation(generation),
+      m_trace(trace),
+      m_column(column),
+      m_constantValue(0.0)
+{
+    NS_ASSERT(trace);
+}
+
+SatInputTraceHandle::SatInputTraceHandle(const Address& address,
+                                         uint32_t generation,
+                                         double constantValue)
+    : m_resolved(true),
+      m_address(address),
+      m_generation(generation),
+      m_trace(),
+      m_column(0),
+      m_constantValue(constantValue)
+{
+}
+
+} // namespace ns3
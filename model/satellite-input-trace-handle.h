@@ -0,0 +1,138 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+#ifndef SATELLITE_INPUT_TRACE_HANDLE_H
+#define SATELLITE_INPUT_TRACE_HANDLE_H
+
+#include <ns3/address.h>
+#include <ns3/ptr.h>
+#include <ns3/satellite-input-fstream-time-double-container.h>
+
+#include <stdint.h>
+
+namespace ns3
+{
+
+/**
+ * \ingroup satellite
+ *
+ * \brief Direct handle to the input trace of a node address and a channel type.
+ *
+ * The handle is resolved once by an input trace container from its key, and
+ * held by the component reading the trace on each reception. The trace is then
+ * read without building the key nor looking it up in the container. The
+ * address the handle was resolved for is kept, so that the holder checks that
+ * the handle still matches the address of the current reception, along with
+ * the generation of the container, increased each time the container is reset
+ * or its values are changed.
+ *
+ * A handle reads either a column of a trace file or a constant value.
+ */
+class SatInputTraceHandle
+{
+  public:
+    /**
+     * \brief Default constructor, creating a handle not resolved for any address
+     */
+    SatInputTraceHandle();
+
+    /**
+     * \brief Constructor of a handle reading a trace file
+     * \param address address the handle is resolved for
+     * \param generation generation of the container resolving the handle
+     * \param trace trace file container
+     * \param column index of the value read in the rows of the trace
+     */
+    SatInputTraceHandle(const Address& address,
+                        uint32_t generation,
+                        Ptr<SatInputFileStreamTimeDoubleContainer> trace,
+                        uint32_t column);
+
+    /**
+     * \brief Constructor of a handle reading a constant value
+     * \param address address the handle is resolved for
+     * \param generation generation of the container resolving the handle
+     * \param constantValue value read
+     */
+    SatInputTraceHandle(const Address& address, uint32_t generation, double constantValue);
+
+    /**
+     * \brief Check whether the handle is resolved for an address by the
+     * current generation of its container
+     * \param address address
+     * \param generation current generation of the container
+     * \return true if the handle is resolved for the address and the generation
+     */
+    inline bool IsResolvedFor(const Address& address, uint32_t generation) const
+    {
+        return m_resolved && m_generation == generation && m_address == address;
+    }
+
+    /**
+     * \brief Get the value of the trace at the current simulation time
+     * \return value of the trace
+     */
+    inline double GetValue() const
+    {
+        NS_ASSERT(m_resolved);
+
+        if (m_trace)
+        {
+            return m_trace->ProceedToNextClosestTimeSampleValue(m_column);
+        }
+
+        return m_constantValue;
+    }
+
+  private:
+    /**
+     * \brief Whether the handle is resolved for m_address
+     */
+    bool m_resolved;
+
+    /**
+     * \brief Address the handle is resolved for
+     */
+    Address m_address;
+
+    /**
+     * \brief Generation of the container the handle was resolved by
+     */
+    uint32_t m_generation;
+
+    /**
+     * \brief Trace file container, NULL for a constant value
+     */
+    Ptr<SatInputFileStreamTimeDoubleContainer> m_trace;
+
+    /**
+     * \brief Index of the value read in the rows of the trace
+     */
+    uint32_t m_column;
+
+    /**
+     * \brief Value read when there is no trace file
+     */
+    double m_constantValue;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_INPUT_TRACE_HANDLE_H */
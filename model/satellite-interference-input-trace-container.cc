@@ -51,6 +51,7 @@ SatInterferenceInputTraceContainer::GetInstanceTypeId(void) const
 }
 
 SatInterferenceInputTraceContainer::SatInterferenceInputTraceContainer()
+    : m_generation(0)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -77,6 +78,9 @@ SatInterferenceInputTraceContainer::Reset()
 {
     NS_LOG_FUNCTION(this);
 
+    // the handles resolved so far are resolved again
+    m_generation++;
+
     if (!m_container.empty())
     {
         m_container.clear();
@@ -154,8 +158,27 @@ SatInterferenceInputTraceContainer::GetInterferenceDensity(key_t key)
 {
     NS_LOG_FUNCTION(this);
 
-    return FindNode(key)->ProceedToNextClosestTimeSample().at(
+    return FindNode(key)->ProceedToNextClosestTimeSampleValue(
         SatBaseTraceContainer::INTF_TRACE_DEFAULT_INTF_DENSITY_INDEX);
 }
 
+SatInputTraceHandle
+SatInterferenceInputTraceContainer::GetHandle(key_t key)
+{
+    NS_LOG_FUNCTION(this);
+
+    Ptr<SatInputFileStreamTimeDoubleContainer> trace = FindNode(key);
+
+    if (trace == NULL)
+    {
+        NS_FATAL_ERROR("SatInterferenceInputTraceContainer::GetHandle - No trace for MAC "
+                       << key.first << " channel type " << key.second);
+    }
+
+    return SatInputTraceHandle(key.first,
+                               m_generation,
+                               trace,
+                               SatBaseTraceContainer::INTF_TRACE_DEFAULT_INTF_DENSITY_INDEX);
+}
+
 } // namespace ns3
@@ -22,6 +22,7 @@
 
 #include "satellite-base-trace-container.h"
 #include "satellite-enums.h"
+#include "satellite-input-trace-handle.h"
 
 #include <ns3/mac48-address.h>
 #include <ns3/satellite-input-fstream-time-double-container.h>
@@ -82,11 +83,28 @@ class SatInterferenceInputTraceContainer : public SatBaseTraceContainer
      */
     double GetInterferenceDensity(key_t key);
 
+    /**
+     * \brief Function for getting a direct handle to the interference density trace
+     * \param key key
+     * \return handle to the interference density trace, resolved for the address of the key
+     */
+    SatInputTraceHandle GetHandle(key_t key);
+
     /**
      * \brief Function for resetting the variables
      */
     void Reset();
 
+    /**
+     * \brief Function for getting the generation of the container, increased
+     * each time the container is reset
+     * \return generation of the container
+     */
+    inline uint32_t GetGeneration() const
+    {
+        return m_generation;
+    }
+
   private:
     /**
      * \brief Function for adding the node to the map
@@ -107,6 +125,11 @@ class SatInterferenceInputTraceContainer : public SatBaseTraceContainer
      * \brief Map for containers
      */
     container_t m_container;
+
+    /**
+     * \brief Generation of the container, checked by the handles
+     */
+    uint32_t m_generation;
 };
 
 } // namespace ns3
@@ -129,7 +129,7 @@ SatInterference::Add(Time duration, double power, Address rxAddress)
     return DoAdd(duration, power, rxAddress);
 }
 
-std::vector<std::pair<double, double>>
+const SatFragmentVector&
 SatInterference::Calculate(Ptr<SatInterference::InterferenceChangeEvent> event)
 {
     NS_LOG_FUNCTION(this);
@@ -21,6 +21,8 @@
 #ifndef SATELLITE_INTERFERENCE_H
 #define SATELLITE_INTERFERENCE_H
 
+#include "satellite-fragment-vector.h"
+
 #include <ns3/mac48-address.h>
 #include <ns3/nstime.h>
 #include <ns3/object.h>
@@ -135,10 +137,10 @@ class SatInterference : public Object
      * Calculates interference power for the given reference
      *
      * \param event Reference event which for interference is calculated.
-     * \return Calculated power value at end of receiving
+     * \return Calculated power value per packet fragment at end of receiving, valid until
+     * the next call
      */
-    std::vector<std::pair<double, double>> Calculate(
-        Ptr<SatInterference::InterferenceChangeEvent> event);
+    const SatFragmentVector& Calculate(Ptr<SatInterference::InterferenceChangeEvent> event);
 
     /**
      * Resets current interference.
@@ -185,11 +187,12 @@ class SatInterference : public Object
      * Sets final power at end time to finalPower.
      *
      * \param event Reference event which for interference is calculated.
-     * \return Final power value at end of receiving
+     * \return Final power value per packet fragment at end of receiving, stored in a
+     * buffer of the subclass reused between calls
      *
      * Concrete subclasses of this base class must implement this method.
      */
-    virtual std::vector<std::pair<double, double>> DoCalculate(
+    virtual const SatFragmentVector& DoCalculate(
         Ptr<SatInterference::InterferenceChangeEvent> event) = 0;
 
     /**
@@ -0,0 +1,127 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+#include "satellite-link-budget-cache.h"
+
+#include "satellite-mobility-model.h"
+#include "satellite-phy-rx.h"
+#include "satellite-phy-tx.h"
+
+#include <ns3/log.h>
+#include <ns3/simulator.h>
+
+NS_LOG_COMPONENT_DEFINE("SatLinkBudgetCache");
+
+namespace ns3
+{
+
+SatLinkBudgetCache::SatLinkBudgetCache()
+    : m_entries()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+bool
+SatLinkBudgetCache::Get(Ptr<SatPhyTx> phyTx,
+                        Ptr<SatPhyRx> phyRx,
+                        uint32_t carrierId,
+                        Time updatePeriod,
+                        linkBudget_s& linkBudget) const
+{
+    NS_LOG_FUNCTION(this << phyTx << phyRx << carrierId);
+
+    std::map<key_t, entry_s>::const_iterator it =
+        m_entries.find(std::make_tuple(phyTx, phyRx, carrierId));
+
+    if (it == m_entries.end())
+    {
+        return false;
+    }
+
+    Ptr<SatMobilityModel> txMobility = DynamicCast<SatMobilityModel>(phyTx->GetMobility());
+    Ptr<SatMobilityModel> rxMobility = DynamicCast<SatMobilityModel>(phyRx->GetMobility());
+
+    if (!txMobility || !rxMobility ||
+        it->second.m_txCourseChangeVersion != txMobility->GetCourseChangeVersion() ||
+        it->second.m_rxCourseChangeVersion != rxMobility->GetCourseChangeVersion() ||
+        it->second.m_txAntennaConfVersion != phyTx->GetAntennaConfVersion() ||
+        it->second.m_rxAntennaConfVersion != phyRx->GetAntennaConfVersion())
+    {
+        return false;
+    }
+
+    if (it->second.m_timeDriven && Now() >= it->second.m_updateTime + updatePeriod)
+    {
+        return false;
+    }
+
+    linkBudget = it->second.m_linkBudget;
+    return true;
+}
+
+void
+SatLinkBudgetCache::Add(Ptr<SatPhyTx> phyTx,
+                        Ptr<SatPhyRx> phyRx,
+                        uint32_t carrierId,
+                        const linkBudget_s& linkBudget)
+{
+    NS_LOG_FUNCTION(this << phyTx << phyRx << carrierId);
+
+    /**
+     * The link budget can be cached only when changes in the position of both ends
+     * can be detected.
+     */
+    Ptr<SatMobilityModel> txMobility = DynamicCast<SatMobilityModel>(phyTx->GetMobility());
+    Ptr<SatMobilityModel> rxMobility = DynamicCast<SatMobilityModel>(phyRx->GetMobility());
+
+    if (!txMobility || !rxMobility)
+    {
+        return;
+    }
+
+    entry_s entry;
+    entry.m_linkBudget = linkBudget;
+    entry.m_txCourseChangeVersion = txMobility->GetCourseChangeVersion();
+    entry.m_rxCourseChangeVersion = rxMobility->GetCourseChangeVersion();
+    entry.m_txAntennaConfVersion = phyTx->GetAntennaConfVersion();
+    entry.m_rxAntennaConfVersion = phyRx->GetAntennaConfVersion();
+    entry.m_timeDriven = txMobility->IsPositionTimeDriven() || rxMobility->IsPositionTimeDriven();
+    entry.m_updateTime = Now();
+
+    m_entries[std::make_tuple(phyTx, phyRx, carrierId)] = entry;
+}
+
+void
+SatLinkBudgetCache::Clear()
+{
+    NS_LOG_FUNCTION(this);
+
+    m_entries.clear();
+}
+
+uint32_t
+SatLinkBudgetCache::GetSize() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return m_entries.size();
+}
+
+} // namespace ns3
@@ -0,0 +1,134 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+#ifndef SATELLITE_LINK_BUDGET_CACHE_H
+#define SATELLITE_LINK_BUDGET_CACHE_H
+
+#include <ns3/nstime.h>
+#include <ns3/ptr.h>
+
+#include <map>
+#include <stdint.h>
+#include <tuple>
+
+namespace ns3
+{
+
+class SatPhyTx;
+class SatPhyRx;
+
+/**
+ * \ingroup satellite
+ *
+ * \brief Cache of the geometric part of the link budgets of a channel, i.e.
+ * the antenna gains and the free space loss, per transmitter, receiver and
+ * carrier.
+ *
+ * An entry is valid as long as the course change versions of the mobility
+ * models of both ends and the antenna configuration versions of both PHYs
+ * stay the same. Entries of links with a time driven mobility model are
+ * valid for the given update period only. Links whose ends do not both have
+ * a SatMobilityModel are never cached.
+ */
+class SatLinkBudgetCache
+{
+  public:
+    /**
+     * Geometric part of the link budget of a link
+     */
+    typedef struct
+    {
+        double m_txAntennaGain_W;
+        double m_rxAntennaGain_W;
+        double m_fsl;
+    } linkBudget_s;
+
+    /**
+     * \brief Constructor
+     */
+    SatLinkBudgetCache();
+
+    /**
+     * \brief Get the cached link budget of a link
+     * \param phyTx transmitter
+     * \param phyRx receiver
+     * \param carrierId carrier id
+     * \param updatePeriod validity period of entries of time driven links
+     * \param linkBudget link budget (output), set on a cache hit only
+     * \return true on a cache hit, false otherwise
+     */
+    bool Get(Ptr<SatPhyTx> phyTx,
+             Ptr<SatPhyRx> phyRx,
+             uint32_t carrierId,
+             Time updatePeriod,
+             linkBudget_s& linkBudget) const;
+
+    /**
+     * \brief Store the link budget of a link, if the link can be cached
+     * \param phyTx transmitter
+     * \param phyRx receiver
+     * \param carrierId carrier id
+     * \param linkBudget link budget calculated at the current simulation time
+     */
+    void Add(Ptr<SatPhyTx> phyTx,
+             Ptr<SatPhyRx> phyRx,
+             uint32_t carrierId,
+             const linkBudget_s& linkBudget);
+
+    /**
+     * \brief Remove all entries
+     */
+    void Clear();
+
+    /**
+     * \brief Get the number of entries
+     * \return number of entries
+     */
+    uint32_t GetSize() const;
+
+  private:
+    /**
+     * Key of the cache: transmitter, receiver and carrier id.
+     */
+    typedef std::tuple<Ptr<SatPhyTx>, Ptr<SatPhyRx>, uint32_t> key_t;
+
+    /**
+     * Cached link budget together with the state it was calculated for.
+     */
+    typedef struct
+    {
+        linkBudget_s m_linkBudget;
+        uint64_t m_txCourseChangeVersion;
+        uint64_t m_rxCourseChangeVersion;
+        uint64_t m_txAntennaConfVersion;
+        uint64_t m_rxAntennaConfVersion;
+        bool m_timeDriven;
+        Time m_updateTime;
+    } entry_s;
+
+    /**
+     * \brief Cached link budgets
+     */
+    std::map<key_t, entry_s> m_entries;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_LINK_BUDGET_CACHE_H */
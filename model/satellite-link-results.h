@@ -75,6 +75,15 @@ class SatLinkResults : public Object
      */
     void Initialize();
 
+    /**
+     * \brief Check whether SatLinkResults::Initialize has been called.
+     * \return true if the look up tables are loaded
+     */
+    inline bool IsInitialized() const
+    {
+        return m_isInitialized;
+    }
+
   protected:
     /**
      * \brief Initialize look up tables.
@@ -150,6 +159,15 @@ class SatLinkResultsRtn : public SatLinkResults
      */
     double GetEbNoDb(uint32_t waveformId, double blerTarget) const;
 
+    /**
+     * \brief Get the look up tables, e.g. to resolve them once per receiver.
+     * \return Look up tables by waveform id
+     */
+    inline const std::map<uint32_t, Ptr<SatLookUpTable>>& GetLookUpTables() const
+    {
+        return m_table;
+    }
+
   protected:
     /**
      * \brief Initialize by loading DVB-RCS2 look up tables.
@@ -397,6 +415,24 @@ class SatLinkResultsFwd : public SatLinkResults
                      SatEnums::SatBbFrameType_t frameType,
                      double blerTarget) const;
 
+    /**
+     * \brief Get the look up tables, e.g. to resolve them once per receiver.
+     * \return Look up tables by modulation and coding scheme
+     */
+    inline const std::map<SatEnums::SatModcod_t, Ptr<SatLookUpTable>>& GetLookUpTables() const
+    {
+        return m_table;
+    }
+
+    /**
+     * \brief Get the Es/No increase required by a short BB frame.
+     * \return Es/No offset in dB
+     */
+    inline double GetShortFrameOffsetDb() const
+    {
+        return m_shortFrameOffsetInDb;
+    }
+
   protected:
     /**
      * \brief Initialize look up tables.
@@ -100,29 +100,8 @@ SatLooModel::Reset()
     m_normalRandomVariable = NULL;
     m_uniformVariable = NULL;
 
-    if (!m_directSignalOscillators.empty())
-    {
-        for (uint32_t i = 0; i < m_numOfStates; i++)
-        {
-            if (!m_directSignalOscillators[i].empty())
-            {
-                m_directSignalOscillators[i].clear();
-            }
-        }
-        m_directSignalOscillators.clear();
-    }
-
-    if (!m_multipathOscillators.empty())
-    {
-        for (uint32_t i = 0; i < m_numOfStates; i++)
-        {
-            if (!m_multipathOscillators[i].empty())
-            {
-                m_multipathOscillators[i].clear();
-            }
-        }
-        m_multipathOscillators.clear();
-    }
+    m_directSignalOscillators.clear();
+    m_multipathOscillators.clear();
 
     m_looParameters.clear();
     m_sigma.clear();
@@ -133,9 +112,11 @@ SatLooModel::ConstructDirectSignalOscillators()
 {
     NS_LOG_FUNCTION(this);
 
+    m_directSignalOscillators.resize(m_numOfStates);
     for (uint32_t i = 0; i < m_numOfStates; i++)
     {
-        std::vector<Ptr<SatFadingOscillator>> oscillators;
+        SatFadingOscillatorBank& oscillators = m_directSignalOscillators[i];
+        oscillators.Reserve(m_looParameters[i][3]);
 
         /// Initial phase is common for all oscillators:
         double phi = m_uniformVariable->GetValue();
@@ -162,9 +143,8 @@ SatLooModel::ConstructDirectSignalOscillators()
             amplitude = pow(10, amplitude / 10) / m_looParameters[i][3];
 
             /// 3. Construct oscillator:
-            oscillators.push_back(CreateObject<SatFadingOscillator>(amplitude, phi, omega));
+            oscillators.Add(std::complex<double>(amplitude, 0.0), phi, omega);
         }
-        m_directSignalOscillators.push_back(oscillators);
     }
 }
 
@@ -173,9 +153,11 @@ SatLooModel::ConstructMultipathOscillators()
 {
     NS_LOG_FUNCTION(this);
 
+    m_multipathOscillators.resize(m_numOfStates);
     for (uint32_t i = 0; i < m_numOfStates; i++)
     {
-        std::vector<Ptr<SatFadingOscillator>> oscillators;
+        SatFadingOscillatorBank& oscillators = m_multipathOscillators[i];
+        oscillators.Reserve(m_looParameters[i][4]);
 
         /// Initial phase is common for all oscillators:
         double phi = m_uniformVariable->GetValue();
@@ -195,9 +177,8 @@ SatLooModel::ConstructMultipathOscillators()
             std::complex<double> amplitude = std::complex<double>(std::cos(psi), std::sin(psi)) *
                                              2.0 / std::sqrt(m_looParameters[i][4]);
             /// 3. Construct oscillator:
-            oscillators.push_back(CreateObject<SatFadingOscillator>(amplitude, phi, omega));
+            oscillators.Add(amplitude, phi, omega);
         }
-        m_multipathOscillators.push_back(oscillators);
     }
 }
 
@@ -220,11 +201,11 @@ SatLooModel::GetChannelGain()
 
     /// Direct signal
     std::complex<double> directComplexGain =
-        GetOscillatorCosineWaveSum(m_directSignalOscillators[m_currentState], timeInSeconds);
+        m_directSignalOscillators[m_currentState].GetCosineWaveSumAt(timeInSeconds);
 
     /// Multipath
     std::complex<double> multipathComplexGain =
-        GetOscillatorComplexSum(m_multipathOscillators[m_currentState], timeInSeconds);
+        m_multipathOscillators[m_currentState].GetComplexSumAt(timeInSeconds);
     multipathComplexGain = multipathComplexGain * m_sigma[m_currentState];
 
     /// Combining
@@ -232,36 +213,25 @@ SatLooModel::GetChannelGain()
     return sqrt((pow(fadingGain.real(), 2) + pow(fadingGain.imag(), 2)));
 }
 
-std::complex<double>
-SatLooModel::GetOscillatorCosineWaveSum(std::vector<Ptr<SatFadingOscillator>> oscillator,
-                                        double timeInSeconds)
-{
-    NS_LOG_FUNCTION(this);
-
-    std::complex<double> complexSum = std::complex<double>(0, 0);
-
-    for (uint32_t i = 0; i < oscillator.size(); i++)
-    {
-        complexSum += oscillator[i]->GetCosineWaveValueAt(timeInSeconds);
-    }
-
-    return complexSum;
-}
-
-std::complex<double>
-SatLooModel::GetOscillatorComplexSum(std::vector<Ptr<SatFadingOscillator>> oscillator,
-                                     double timeInSeconds)
+void
+SatLooModel::GetChannelGains(const std::vector<double>& timesInSeconds,
+                             std::vector<double>& gains)
 {
-    NS_LOG_FUNCTION(this);
+    NS_LOG_FUNCTION(this << timesInSeconds.size());
 
-    std::complex<double> complexSum = std::complex<double>(0, 0);
+    std::vector<std::complex<double>> directComplexGains;
+    std::vector<std::complex<double>> multipathComplexGains;
+    m_directSignalOscillators[m_currentState].GetCosineWaveSumsAt(timesInSeconds,
+                                                                  directComplexGains);
+    m_multipathOscillators[m_currentState].GetComplexSumsAt(timesInSeconds, multipathComplexGains);
 
-    for (uint32_t i = 0; i < oscillator.size(); i++)
+    gains.resize(timesInSeconds.size());
+    for (std::size_t i = 0; i < timesInSeconds.size(); i++)
     {
-        complexSum += oscillator[i]->GetComplexValueAt(timeInSeconds);
+        std::complex<double> fadingGain =
+            directComplexGains[i] + multipathComplexGains[i] * m_sigma[m_currentState];
+        gains[i] = sqrt((pow(fadingGain.real(), 2) + pow(fadingGain.imag(), 2)));
     }
-
-    return complexSum;
 }
 
 void
@@ -291,29 +261,8 @@ SatLooModel::ChangeSet(uint32_t newSet, uint32_t newState)
 
     ChangeState(newState);
 
-    if (!m_directSignalOscillators.empty())
-    {
-        for (uint32_t i = 0; i < m_numOfStates; i++)
-        {
-            if (!m_directSignalOscillators[i].empty())
-            {
-                m_directSignalOscillators[i].clear();
-            }
-        }
-        m_directSignalOscillators.clear();
-    }
-
-    if (!m_multipathOscillators.empty())
-    {
-        for (uint32_t i = 0; i < m_numOfStates; i++)
-        {
-            if (!m_multipathOscillators[i].empty())
-            {
-                m_multipathOscillators[i].clear();
-            }
-        }
-        m_multipathOscillators.clear();
-    }
+    m_directSignalOscillators.clear();
+    m_multipathOscillators.clear();
 
     m_sigma.clear();
 
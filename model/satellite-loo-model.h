@@ -21,7 +21,7 @@
 #define SATELLITE_LOO_MODEL_H
 
 #include "satellite-base-fader.h"
-#include "satellite-fading-oscillator.h"
+#include "satellite-fading-oscillator-bank.h"
 #include "satellite-loo-conf.h"
 
 #include <ns3/random-variable-stream.h>
@@ -85,6 +85,14 @@ class SatLooModel : public SatBaseFader
      */
     double GetChannelGain();
 
+    /**
+     * \brief Function for returning the channel gains at many times in the
+     * current state
+     * \param timesInSeconds times in seconds
+     * \param gains channel gains, one per time
+     */
+    void GetChannelGains(const std::vector<double>& timesInSeconds, std::vector<double>& gains);
+
     /**
      * \brief Function for updating the parameter set and state
      * \param set parameter set
@@ -134,14 +142,14 @@ class SatLooModel : public SatBaseFader
     Ptr<UniformRandomVariable> m_uniformVariable;
 
     /**
-     * \brief Direct signal oscillators
+     * \brief Direct signal oscillators of each state
      */
-    std::vector<std::vector<Ptr<SatFadingOscillator>>> m_directSignalOscillators;
+    std::vector<SatFadingOscillatorBank> m_directSignalOscillators;
 
     /**
-     * \brief Multipath oscillators
+     * \brief Multipath oscillators of each state
      */
-    std::vector<std::vector<Ptr<SatFadingOscillator>>> m_multipathOscillators;
+    std::vector<SatFadingOscillatorBank> m_multipathOscillators;
 
     /**
      * \brief Function for constructing direct signal oscillators
@@ -153,25 +161,6 @@ class SatLooModel : public SatBaseFader
      */
     void ConstructMultipathOscillators();
 
-    /**
-     * \brief Function for calculating cosine wave oscillator complex sum
-     * \param oscillator oscillator
-     * \param timeInSeconds current time in seconds
-     * \return sum
-     */
-    std::complex<double> GetOscillatorCosineWaveSum(
-        std::vector<Ptr<SatFadingOscillator>> oscillator,
-        double timeInSeconds);
-
-    /**
-     * \brief Function for calculating oscillator complex sum
-     * \param oscillator oscillator
-     * \param timeInSeconds current time in seconds
-     * \return sum
-     */
-    std::complex<double> GetOscillatorComplexSum(std::vector<Ptr<SatFadingOscillator>> oscillator,
-                                                 double timeInSeconds);
-
     /**
      * \brief Function for setting the state
      * \param newState new state
@@ -23,10 +23,15 @@
 
 #include "satellite-utils.h"
 
+#include <ns3/enum.h>
 #include <ns3/fatal-error.h>
 #include <ns3/log.h>
+#include <ns3/singleton.h>
 
+#include <algorithm>
 #include <cmath>
+#include <fstream>
+#include <functional>
 
 NS_LOG_COMPONENT_DEFINE("SatLookUpTable");
 
@@ -36,6 +41,8 @@ namespace ns3
 NS_OBJECT_ENSURE_REGISTERED(SatLookUpTable);
 
 SatLookUpTable::SatLookUpTable(std::string linkResultPath)
+    : m_gridInvStepDb(0.0),
+      m_lookUpMode(LUT_UNIFORM_GRID)
 {
     NS_LOG_FUNCTION(this << linkResultPath);
     Load(linkResultPath);
@@ -53,17 +60,8 @@ SatLookUpTable::DoDispose()
 
     m_esNoDb.clear();
     m_bler.clear();
-
-    if (m_ifs != 0)
-    {
-        if (m_ifs->is_open())
-        {
-            m_ifs->close();
-        }
-
-        delete m_ifs;
-        m_ifs = 0;
-    }
+    m_slope.clear();
+    m_gridRow.clear();
 
     Object::DoDispose();
 }
@@ -71,7 +69,17 @@ SatLookUpTable::DoDispose()
 TypeId
 SatLookUpTable::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::SatLookUpTable").SetParent<Object>();
+    static TypeId tid =
+        TypeId("ns3::SatLookUpTable")
+            .SetParent<Object>()
+            .AddAttribute("LookUpMode",
+                          "Mode used to find the table rows bracketing an Es/No value",
+                          EnumValue(SatLookUpTable::LUT_UNIFORM_GRID),
+                          MakeEnumAccessor(&SatLookUpTable::m_lookUpMode),
+                          MakeEnumChecker(SatLookUpTable::LUT_BINARY_SEARCH,
+                                          "BinarySearch",
+                                          SatLookUpTable::LUT_UNIFORM_GRID,
+                                          "UniformGrid"));
     return tid;
 }
 
@@ -92,12 +100,7 @@ SatLookUpTable::GetBler(double esNoDb) const
         return 1.0;
     }
 
-    uint16_t i = 1;
-
-    while ((i < n) && (esNoDb > m_esNoDb[i]))
-    {
-        i++;
-    }
+    uint32_t i = FindRow(esNoDb);
 
     NS_LOG_DEBUG(this << " i=" << i << " esno[i]=" << m_esNoDb[i] << " bler[i]=" << m_bler[i]);
 
@@ -124,7 +127,7 @@ SatLookUpTable::GetBler(double esNoDb) const
         double esno = esNoDb;
         double esno0 = m_esNoDb[i - 1];
         double esno1 = m_esNoDb[i];
-        double bler = SatUtils::Interpolate(esno, esno0, esno1, m_bler[i - 1], m_bler[i]);
+        double bler = m_bler[i - 1] + m_slope[i] * (esno - esno0);
         NS_LOG_INFO(this << " Interpolate: " << esno << " to BLER = " << bler << "(sinr0: " << esno0
                          << ", sinr1: " << esno1 << ", bler0: " << m_bler[i - 1]
                          << ", bler1: " << m_bler[i] << ")");
@@ -158,25 +161,25 @@ SatLookUpTable::GetEsNoDb(double blerTarget) const
         NS_FATAL_ERROR("The BLER target is set to be too high!");
     }
 
-    double sinr = 0.0;
-    // Go through the list from end to beginning
-    for (uint32_t i = 0; i < n; ++i)
+    // BLER is decreasing, find the first entry lower or equal to the target
+    uint32_t i =
+        std::lower_bound(m_bler.begin(), m_bler.end(), blerTarget, std::greater<double>()) -
+        m_bler.begin();
+
+    if (i == 0)
     {
-        if (blerTarget >= m_bler[i])
-        {
-            sinr = SatUtils::Interpolate(blerTarget,
-                                         m_bler[i - 1],
-                                         m_bler[i],
-                                         m_esNoDb[i - 1],
-                                         m_esNoDb[i]);
-            NS_LOG_INFO(this << " Interpolate: " << blerTarget << " to SINR = " << sinr
-                             << "(bler0: " << m_bler[i - 1] << ", bler1: " << m_bler[i]
-                             << ", sinr0: " << m_esNoDb[i - 1] << ", sinr1: " << m_esNoDb[i]
-                             << ")");
-            return sinr;
-        }
+        // The requested BLER is the highest BLER entry
+        return m_esNoDb[0];
     }
 
+    double sinr = SatUtils::Interpolate(blerTarget,
+                                        m_bler[i - 1],
+                                        m_bler[i],
+                                        m_esNoDb[i - 1],
+                                        m_esNoDb[i]);
+    NS_LOG_INFO(this << " Interpolate: " << blerTarget << " to SINR = " << sinr
+                     << "(bler0: " << m_bler[i - 1] << ", bler1: " << m_bler[i]
+                     << ", sinr0: " << m_esNoDb[i - 1] << ", sinr1: " << m_esNoDb[i] << ")");
     return sinr;
 } // end of double SatLookUpTable::GetSinr (double bler) const
 
@@ -185,64 +188,198 @@ SatLookUpTable::Load(std::string linkResultPath)
 {
     NS_LOG_FUNCTION(this << linkResultPath);
 
+    SatTableBundle::Columns_t columns;
+    bool fromBundle = Singleton<SatTableBundle>::Get()->GetColumns(linkResultPath, columns);
+
+    if (!fromBundle)
+    {
+        SatTableBundle::TextColumns_t text;
+        ReadTextColumns(linkResultPath, text);
+        SatTableBundle::TakeColumns(text, columns);
+    }
+
+    // at least contains one row
+    if (columns.size() != 2 || columns[0].empty())
+    {
+        NS_FATAL_ERROR("Error reading data from file " << linkResultPath << ".");
+    }
+
+    // the text file has been checked while read
+    if (fromBundle)
+    {
+        CheckSorted(linkResultPath, columns[0].begin(), columns[1].begin(), columns[0].size());
+    }
+
+    m_esNoDb.swap(columns[0]);
+    m_bler.swap(columns[1]);
+
+    // SINR and BLER have same size
+    NS_ASSERT(m_esNoDb.size() == m_bler.size());
+
+    BuildIndex();
+
+} // end of void Load (std::string linkResultPath)
+
+void
+SatLookUpTable::ReadTextColumns(std::string linkResultPath, SatTableBundle::TextColumns_t& columns)
+{
+    NS_LOG_FUNCTION(linkResultPath);
+
     // READ FROM THE SPECIFIED INPUT FILE
 
-    m_ifs = new std::ifstream(linkResultPath.c_str(), std::ifstream::in);
+    std::ifstream ifs(linkResultPath.c_str(), std::ifstream::in);
 
-    if (!m_ifs->is_open())
+    if (!ifs.is_open())
     {
         // script might be launched by test.py, try a different base path
-        delete m_ifs;
         linkResultPath = "../../" + linkResultPath;
-        m_ifs = new std::ifstream(linkResultPath.c_str(), std::ifstream::in);
+        ifs.open(linkResultPath.c_str(), std::ifstream::in);
 
-        if (!m_ifs->is_open())
+        if (!ifs.is_open())
         {
             NS_FATAL_ERROR("The file " << linkResultPath << " is not found.");
         }
     }
 
-    double lastEsNoDb = -100.0; // very low value
-    double lastBler = 1.0;      // maximum value
+    columns.assign(2, std::vector<double>());
 
     double esNoDb, bler;
-    *m_ifs >> esNoDb >> bler;
+    ifs >> esNoDb >> bler;
 
-    while (m_ifs->good())
+    while (ifs.good())
     {
-        NS_LOG_DEBUG(this << " sinrDb=" << esNoDb << ", bler=" << bler);
+        NS_LOG_DEBUG(" sinrDb=" << esNoDb << ", bler=" << bler);
 
-        // SANITY CHECK PART I
-        if ((esNoDb <= lastEsNoDb) || (bler > lastBler))
+        // record the values
+        columns[0].push_back(esNoDb);
+        columns[1].push_back(bler);
+
+        // get next row
+        ifs >> esNoDb >> bler;
+    }
+
+    ifs.close();
+
+    CheckSorted(linkResultPath, columns[0].data(), columns[1].data(), columns[0].size());
+
+} // end of void ReadTextColumns (std::string linkResultPath, TextColumns_t& columns)
+
+void
+SatLookUpTable::CheckSorted(std::string linkResultPath,
+                            const double* esNoDb,
+                            const double* bler,
+                            std::size_t rows)
+{
+    double lastEsNoDb = -100.0; // very low value
+    double lastBler = 1.0;      // maximum value
+
+    for (std::size_t i = 0; i < rows; i++)
+    {
+        // SANITY CHECK PART I, written to also reject NaN values of a corrupted bundle
+        if (!(esNoDb[i] > lastEsNoDb) || !(bler[i] <= lastBler))
         {
             NS_FATAL_ERROR("The file " << linkResultPath << " is not properly sorted.");
         }
 
-        // record the values
-        m_esNoDb.push_back(esNoDb);
-        m_bler.push_back(bler);
-        lastEsNoDb = esNoDb;
-        lastBler = bler;
+        lastEsNoDb = esNoDb[i];
+        lastBler = bler[i];
+    }
+}
 
-        // get next row
-        *m_ifs >> esNoDb >> bler;
+void
+SatLookUpTable::BuildIndex()
+{
+    NS_LOG_FUNCTION(this);
+
+    // upper bound of the grid size, for tables with very close rows
+    const uint32_t maxGridCells = 65536;
+
+    uint32_t n = m_esNoDb.size();
+
+    // same computation as SatUtils::Interpolate, so that results do not change
+    m_slope.assign(n, 0.0);
+    for (uint32_t i = 1; i < n; i++)
+    {
+        m_slope[i] = (m_bler[i] - m_bler[i - 1]) / (m_esNoDb[i] - m_esNoDb[i - 1]);
     }
 
-    m_ifs->close();
-    delete m_ifs;
-    m_ifs = 0;
+    m_gridRow.clear();
+    m_gridInvStepDb = 0.0;
 
-    // SANITY CHECK PART II
+    if (n < 2)
+    {
+        return;
+    }
 
-    // at least contains one row
-    if (m_esNoDb.empty())
+    // a grid step not larger than the smallest row spacing puts at most
+    // one row boundary in each grid cell
+    double rangeDb = m_esNoDb[n - 1] - m_esNoDb[0];
+    double minSpacingDb = rangeDb;
+    for (uint32_t i = 1; i < n; i++)
     {
-        NS_FATAL_ERROR("Error reading data from file " << linkResultPath << ".");
+        minSpacingDb = std::min(minSpacingDb, m_esNoDb[i] - m_esNoDb[i - 1]);
     }
 
-    // SINR and BLER have same size
-    NS_ASSERT(m_esNoDb.size() == m_bler.size());
+    // tables with duplicate or unordered rows are searched exactly
+    if (!(rangeDb > 0.0) || !(minSpacingDb > 0.0))
+    {
+        NS_LOG_INFO(this << " No uniform grid for " << n << " rows spanning " << rangeDb
+                         << " dB with minimum spacing " << minSpacingDb << " dB");
+        return;
+    }
 
-} // end of void Load (std::string linkResultPath)
+    double gridCells = std::ceil(rangeDb / minSpacingDb);
+    uint32_t cells = gridCells < maxGridCells ? static_cast<uint32_t>(gridCells) : maxGridCells;
+    m_gridInvStepDb = cells / rangeDb;
+    m_gridRow.resize(cells + 1);
+
+    uint32_t row = 1;
+    for (uint32_t k = 0; k <= cells; k++)
+    {
+        double gridPointDb = m_esNoDb[0] + k * rangeDb / cells;
+        while (row < n && m_esNoDb[row] < gridPointDb)
+        {
+            row++;
+        }
+        m_gridRow[k] = row;
+    }
+
+    NS_LOG_INFO(this << " Uniform grid of " << cells << " cells for " << n << " rows");
+}
+
+uint32_t
+SatLookUpTable::FindRow(double esNoDb) const
+{
+    uint32_t n = m_esNoDb.size();
+
+    if (m_lookUpMode == LUT_UNIFORM_GRID && !m_gridRow.empty())
+    {
+        double position = (esNoDb - m_esNoDb[0]) * m_gridInvStepDb;
+        std::size_t cell = m_gridRow.size() - 1;
+        if (!(position > 0.0))
+        {
+            cell = 0;
+        }
+        else if (position < cell)
+        {
+            cell = static_cast<std::size_t>(position);
+        }
+
+        // the grid row is exact at the cell start, step over the row boundary
+        // inside the cell and any rounding of the cell index
+        uint32_t i = m_gridRow[cell];
+        while (i > 1 && m_esNoDb[i - 1] >= esNoDb)
+        {
+            i--;
+        }
+        while (i < n && m_esNoDb[i] < esNoDb)
+        {
+            i++;
+        }
+        return i;
+    }
+
+    return std::lower_bound(m_esNoDb.begin() + 1, m_esNoDb.end(), esNoDb) - m_esNoDb.begin();
+}
 
 } // end of namespace ns3
@@ -22,9 +22,10 @@
 #ifndef SATELLITE_LOOK_UP_TABLE_H
 #define SATELLITE_LOOK_UP_TABLE_H
 
+#include "satellite-table-bundle.h"
+
 #include <ns3/object.h>
 
-#include <fstream>
 #include <vector>
 
 namespace ns3
@@ -34,10 +35,25 @@ namespace ns3
  * \ingroup satellite
  *
  * \brief Loads a link result file and provide query service for BLER.
+ *
+ * BLER is linearly interpolated between the rows of the file. The row
+ * bracketing a given Es/No is found either by binary search, or by a
+ * uniform Es/No grid built at load time which maps each grid cell to the
+ * rows it covers, giving constant time lookups. Both modes use the same
+ * precomputed slopes and return the same values.
  */
 class SatLookUpTable : public Object
 {
   public:
+    /**
+     * \brief Row lookup mode
+     */
+    enum LookUpMode
+    {
+        LUT_BINARY_SEARCH,
+        LUT_UNIFORM_GRID
+    };
+
     /**
      * Constructor with initialization parameters.
      * \param linkResultPath
@@ -69,18 +85,70 @@ class SatLookUpTable : public Object
      */
     double GetEsNoDb(double blerTarget) const;
 
+    /**
+     * \brief Parse a link results text file
+     * \param linkResultPath Path to a link results file.
+     * \param columns Es/No in dB and BLER columns
+     */
+    static void ReadTextColumns(std::string linkResultPath, SatTableBundle::TextColumns_t& columns);
+
   private:
     virtual void DoDispose();
 
     /**
-     * \brief Load the link results
+     * \brief Check that the Es/No increases and the BLER does not increase
+     * from row to row, whether the table comes from a text file or a bundle
+     * \param linkResultPath Path to the link results file, for the error message
+     * \param esNoDb Es/No column
+     * \param bler BLER column
+     * \param rows Number of rows
+     */
+    static void CheckSorted(std::string linkResultPath,
+                            const double* esNoDb,
+                            const double* bler,
+                            std::size_t rows);
+
+    /**
+     * \brief Load the link results, from the table bundle if it holds an up to
+     * date copy of the file
      * \param linkResultsPath Path to a link results file.
      */
     void Load(std::string linkResultPath);
 
-    std::vector<double> m_esNoDb;
-    std::vector<double> m_bler;
-    std::ifstream* m_ifs;
+    /**
+     * \brief Precompute the interpolation slopes and the uniform Es/No grid
+     */
+    void BuildIndex();
+
+    /**
+     * \brief Find the first row (from 1) whose Es/No is greater or equal to the given one
+     * \param esNoDb Es/No in dB, within the table range
+     * \return Row index, or the number of rows if there is none
+     */
+    uint32_t FindRow(double esNoDb) const;
+
+    SatTableBundle::Column m_esNoDb;
+    SatTableBundle::Column m_bler;
+
+    /**
+     * \brief Slope of the BLER between row i-1 and row i, stored at index i
+     */
+    std::vector<double> m_slope;
+
+    /**
+     * \brief First row (from 1) whose Es/No is greater or equal to each grid point
+     */
+    std::vector<uint32_t> m_gridRow;
+
+    /**
+     * \brief Inverse of the grid step, in 1/dB
+     */
+    double m_gridInvStepDb;
+
+    /**
+     * \brief Row lookup mode
+     */
+    LookUpMode m_lookUpMode;
 };
 
 } // end of namespace ns3
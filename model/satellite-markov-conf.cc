@@ -20,6 +20,8 @@
 
 #include "satellite-markov-conf.h"
 
+#include "satellite-markov-fading-series.h"
+
 #include <ns3/log.h>
 
 #include <map>
@@ -88,7 +90,28 @@ SatMarkovConf::GetTypeId(void)
                           "Defines whether the fading value should be in decibels or not.",
                           BooleanValue(false),
                           MakeBooleanAccessor(&SatMarkovConf::m_useDecibels),
-                          MakeBooleanChecker());
+                          MakeBooleanChecker())
+            .AddAttribute("UseFadingSeries",
+                          "Replay fading time series generated once for all the links, instead "
+                          "of evaluating the faders of each link.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&SatMarkovConf::m_useFadingSeries),
+                          MakeBooleanChecker())
+            .AddAttribute("FadingSeriesCount",
+                          "Number of fading time series per elevation set and state.",
+                          UintegerValue(8),
+                          MakeUintegerAccessor(&SatMarkovConf::m_fadingSeriesCount),
+                          MakeUintegerChecker<uint32_t>(1))
+            .AddAttribute("FadingSeriesDuration",
+                          "Duration of a fading time series, repeated after it.",
+                          TimeValue(Seconds(10.0)),
+                          MakeTimeAccessor(&SatMarkovConf::m_fadingSeriesDuration),
+                          MakeTimeChecker())
+            .AddAttribute("FadingSeriesSamplingInterval",
+                          "Interval between two samples of a fading time series.",
+                          TimeValue(MilliSeconds(1)),
+                          MakeTimeAccessor(&SatMarkovConf::m_fadingSeriesSamplingInterval),
+                          MakeTimeChecker());
     return tid;
 }
 
@@ -100,7 +123,12 @@ SatMarkovConf::SatMarkovConf()
       m_useDecibels(false),
       m_looConf(NULL),
       m_rayleighConf(NULL),
-      m_faderType(SatMarkovConf::LOO_FADER)
+      m_faderType(SatMarkovConf::LOO_FADER),
+      m_useFadingSeries(false),
+      m_fadingSeriesCount(8),
+      m_fadingSeriesDuration(Seconds(10.0)),
+      m_fadingSeriesSamplingInterval(MilliSeconds(1)),
+      m_fadingSeries(NULL)
 {
     NS_LOG_FUNCTION(this);
 
@@ -163,6 +191,7 @@ SatMarkovConf::Reset()
 
     m_looConf = NULL;
     m_rayleighConf = NULL;
+    m_fadingSeries = NULL;
 
     m_initialProbabilities.clear();
     m_markovElevations.clear();
@@ -317,4 +346,20 @@ SatMarkovConf::AreDecibelsUsed()
     return m_useDecibels;
 }
 
+Ptr<SatMarkovFadingSeries>
+SatMarkovConf::GetFadingSeries()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_useFadingSeries && !m_fadingSeries)
+    {
+        m_fadingSeries = Create<SatMarkovFadingSeries>(this,
+                                                       m_fadingSeriesCount,
+                                                       m_fadingSeriesDuration,
+                                                       m_fadingSeriesSamplingInterval);
+    }
+
+    return m_fadingSeries;
+}
+
 } // namespace ns3
@@ -34,6 +34,8 @@
 namespace ns3
 {
 
+class SatMarkovFadingSeries;
+
 /**
  * \ingroup satellite
  *
@@ -148,6 +150,13 @@ class SatMarkovConf : public Object
      */
     bool AreDecibelsUsed();
 
+    /**
+     * \brief Function for getting the fading time series shared by the Markov
+     * containers, generated on the first call
+     * \return fading time series, 0 if the series are not used
+     */
+    Ptr<SatMarkovFadingSeries> GetFadingSeries();
+
     /**
      *  \brief Do needed dispose actions.
      */
@@ -209,6 +218,31 @@ class SatMarkovConf : public Object
      */
     SatMarkovConf::MarkovFaderType_t m_faderType;
 
+    /**
+     * \brief Replay pregenerated fading time series instead of evaluating the faders
+     */
+    bool m_useFadingSeries;
+
+    /**
+     * \brief Number of fading time series per parameter set and state
+     */
+    uint32_t m_fadingSeriesCount;
+
+    /**
+     * \brief Duration of a fading time series
+     */
+    Time m_fadingSeriesDuration;
+
+    /**
+     * \brief Interval between two samples of a fading time series
+     */
+    Time m_fadingSeriesSamplingInterval;
+
+    /**
+     * \brief Fading time series, 0 until generated
+     */
+    Ptr<SatMarkovFadingSeries> m_fadingSeries;
+
     /**
      * \brief Clear used variables
      */
@@ -23,6 +23,9 @@
 #include "satellite-utils.h"
 
 #include <ns3/log.h>
+#include <ns3/random-variable-stream.h>
+
+#include <cmath>
 
 namespace ns3
 {
@@ -49,6 +52,9 @@ SatMarkovContainer::SatMarkovContainer()
       m_markovConf(NULL),
       m_fader_up(NULL),
       m_fader_down(NULL),
+      m_fadingSeries(NULL),
+      m_fadingSeriesIndex(0),
+      m_fadingSeriesOffset(0.0),
       m_numOfStates(),
       m_numOfSets(),
       m_currentSet(),
@@ -76,6 +82,9 @@ SatMarkovContainer::SatMarkovContainer(Ptr<SatMarkovConf> markovConf,
       m_markovConf(markovConf),
       m_fader_up(NULL),
       m_fader_down(NULL),
+      m_fadingSeries(markovConf->GetFadingSeries()),
+      m_fadingSeriesIndex(0),
+      m_fadingSeriesOffset(0.0),
       m_numOfStates(markovConf->GetStateCount()),
       m_numOfSets(markovConf->GetNumOfSets()),
       m_currentState(markovConf->GetInitialState()),
@@ -102,8 +111,18 @@ SatMarkovContainer::SatMarkovContainer(Ptr<SatMarkovConf> markovConf,
     UpdateProbabilities(m_currentSet);
     m_markovModel->DoTransition();
 
-    /// create faders
-    CreateFaders(m_markovConf->GetFaderType());
+    if (m_fadingSeries)
+    {
+        /// pick the replayed fading time series
+        Ptr<UniformRandomVariable> uniform = CreateObject<UniformRandomVariable>();
+        m_fadingSeriesIndex = uniform->GetInteger(0, m_fadingSeries->GetSeriesCount() - 1);
+        m_fadingSeriesOffset = uniform->GetValue(0.0, m_fadingSeries->GetDuration().GetSeconds());
+    }
+    else
+    {
+        /// create faders
+        CreateFaders(m_markovConf->GetFaderType());
+    }
 
     /// initialize fading values
     CalculateFading(SatEnums::RETURN_USER_CH);
@@ -140,6 +159,7 @@ SatMarkovContainer::Reset()
     m_markovConf = NULL;
     m_fader_up = NULL;
     m_fader_down = NULL;
+    m_fadingSeries = NULL;
     m_markovModel = NULL;
 
     m_currentElevation.Nullify();
@@ -331,15 +351,22 @@ SatMarkovContainer::CalculateFading(SatEnums::ChannelType_t channelType)
     {
     case SatEnums::RETURN_USER_CH:
     case SatEnums::FORWARD_FEEDER_CH: {
-        m_fader_up->UpdateParameters(m_currentSet, m_currentState);
-
-        if (m_useDecibels)
+        if (m_fadingSeries)
         {
-            m_latestCalculatedFadingValue_up = m_fader_down->GetChannelGainDb();
+            m_latestCalculatedFadingValue_up = ReadFadingSeries();
         }
         else
         {
-            m_latestCalculatedFadingValue_up = m_fader_down->GetChannelGain();
+            m_fader_up->UpdateParameters(m_currentSet, m_currentState);
+
+            if (m_useDecibels)
+            {
+                m_latestCalculatedFadingValue_up = m_fader_down->GetChannelGainDb();
+            }
+            else
+            {
+                m_latestCalculatedFadingValue_up = m_fader_down->GetChannelGain();
+            }
         }
 
         NS_LOG_INFO("Calculated feeder fading value " << m_latestCalculatedFadingValue_up);
@@ -351,15 +378,22 @@ SatMarkovContainer::CalculateFading(SatEnums::ChannelType_t channelType)
     }
     case SatEnums::FORWARD_USER_CH:
     case SatEnums::RETURN_FEEDER_CH: {
-        m_fader_down->UpdateParameters(m_currentSet, m_currentState);
-
-        if (m_useDecibels)
+        if (m_fadingSeries)
         {
-            m_latestCalculatedFadingValue_down = m_fader_down->GetChannelGainDb();
+            m_latestCalculatedFadingValue_down = ReadFadingSeries();
         }
         else
         {
-            m_latestCalculatedFadingValue_down = m_fader_down->GetChannelGain();
+            m_fader_down->UpdateParameters(m_currentSet, m_currentState);
+
+            if (m_useDecibels)
+            {
+                m_latestCalculatedFadingValue_down = m_fader_down->GetChannelGainDb();
+            }
+            else
+            {
+                m_latestCalculatedFadingValue_down = m_fader_down->GetChannelGain();
+            }
         }
 
         NS_LOG_INFO("Calculated return fading value " << m_latestCalculatedFadingValue_down);
@@ -376,6 +410,20 @@ SatMarkovContainer::CalculateFading(SatEnums::ChannelType_t channelType)
     return fadingValue;
 }
 
+double
+SatMarkovContainer::ReadFadingSeries()
+{
+    NS_LOG_FUNCTION(this);
+
+    // both channels replay the same series, as they read the same fader
+    double gain = m_fadingSeries->GetChannelGain(m_currentSet,
+                                                 m_currentState,
+                                                 m_fadingSeriesIndex,
+                                                 Now().GetSeconds() + m_fadingSeriesOffset);
+
+    return m_useDecibels ? SatUtils::LinearToDb(gain) : gain;
+}
+
 void
 SatMarkovContainer::LockToSetAndState(uint32_t newSet, uint32_t newState)
 {
@@ -24,6 +24,7 @@
 #include "satellite-base-fading.h"
 #include "satellite-loo-model.h"
 #include "satellite-markov-conf.h"
+#include "satellite-markov-fading-series.h"
 #include "satellite-markov-model.h"
 #include "satellite-rayleigh-model.h"
 
@@ -149,6 +150,21 @@ class SatMarkovContainer : public SatBaseFading
      */
     Ptr<SatBaseFader> m_fader_down;
 
+    /**
+     * \brief Fading time series replayed instead of the faders, 0 if not used
+     */
+    Ptr<SatMarkovFadingSeries> m_fadingSeries;
+
+    /**
+     * \brief Index of the replayed fading time series
+     */
+    uint32_t m_fadingSeriesIndex;
+
+    /**
+     * \brief Offset in seconds of the replayed fading time series
+     */
+    double m_fadingSeriesOffset;
+
     /**
      * \brief Number of states available
      */
@@ -256,6 +272,12 @@ class SatMarkovContainer : public SatBaseFading
      */
     double CalculateFading(SatEnums::ChannelType_t channelType);
 
+    /**
+     * \brief Function for reading the fading value from the fading time series
+     * \return fading value
+     */
+    double ReadFadingSeries();
+
     /**
      * \brief Function for calculating the elevation
      * \return elevation value
@@ -0,0 +1,130 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+#include "satellite-markov-fading-series.h"
+
+#include "satellite-loo-model.h"
+#include "satellite-markov-conf.h"
+#include "satellite-rayleigh-model.h"
+
+#include <ns3/log.h>
+
+#include <algorithm>
+
+NS_LOG_COMPONENT_DEFINE("SatMarkovFadingSeries");
+
+namespace ns3
+{
+
+SatMarkovFadingSeries::SatMarkovFadingSeries(Ptr<SatMarkovConf> markovConf,
+                                             uint32_t seriesCount,
+                                             Time duration,
+                                             Time samplingInterval)
+    : m_stateCount(markovConf->GetStateCount()),
+      m_seriesCount(seriesCount),
+      m_sampleCount(0),
+      m_samplingInterval(samplingInterval),
+      m_invSamplingInterval(0.0),
+      m_gains()
+{
+    NS_LOG_FUNCTION(this << seriesCount << duration << samplingInterval);
+
+    if (seriesCount == 0)
+    {
+        NS_FATAL_ERROR("SatMarkovFadingSeries::SatMarkovFadingSeries - No fading series");
+    }
+
+    if (!samplingInterval.IsStrictlyPositive() ||
+        duration.GetSeconds() < 2.0 * samplingInterval.GetSeconds())
+    {
+        NS_FATAL_ERROR("SatMarkovFadingSeries::SatMarkovFadingSeries - The duration "
+                       << duration << " does not hold two samples at interval "
+                       << samplingInterval);
+    }
+
+    m_sampleCount =
+        static_cast<uint32_t>(duration.GetSeconds() / samplingInterval.GetSeconds() + 0.5);
+    m_invSamplingInterval = 1.0 / samplingInterval.GetSeconds();
+
+    std::vector<double> times(m_sampleCount);
+    for (uint32_t i = 0; i < m_sampleCount; i++)
+    {
+        times[i] = i * samplingInterval.GetSeconds();
+    }
+
+    uint32_t setCount = markovConf->GetNumOfSets();
+    m_gains.resize((std::size_t)setCount * m_stateCount * m_seriesCount * m_sampleCount);
+
+    // each series is an independent realization of the faders of a set, the
+    // states of a set sharing the fader as in SatMarkovContainer
+    std::vector<double> gains;
+    for (uint32_t set = 0; set < setCount; set++)
+    {
+        for (uint32_t series = 0; series < m_seriesCount; series++)
+        {
+            Ptr<SatBaseFader> fader;
+            switch (markovConf->GetFaderType())
+            {
+            case SatMarkovConf::LOO_FADER: {
+                fader = CreateObject<SatLooModel>(markovConf->GetLooConf(), m_stateCount, set, 0);
+                break;
+            }
+            case SatMarkovConf::RAYLEIGH_FADER: {
+                fader = CreateObject<SatRayleighModel>(markovConf->GetRayleighConf(), set, 0);
+                break;
+            }
+            default: {
+                NS_FATAL_ERROR("SatMarkovFadingSeries::SatMarkovFadingSeries - Invalid fader "
+                               "type");
+            }
+            }
+
+            for (uint32_t state = 0; state < m_stateCount; state++)
+            {
+                fader->UpdateParameters(set, state);
+                fader->GetChannelGains(times, gains);
+
+                float* samples =
+                    &m_gains[((std::size_t)(set * m_stateCount + state) * m_seriesCount + series) *
+                             m_sampleCount];
+                std::copy(gains.begin(), gains.end(), samples);
+            }
+
+            fader->Dispose();
+        }
+    }
+
+    NS_LOG_INFO("Generated " << setCount * m_stateCount * m_seriesCount << " fading series of "
+                             << m_sampleCount << " samples");
+}
+
+uint32_t
+SatMarkovFadingSeries::GetSeriesCount() const
+{
+    return m_seriesCount;
+}
+
+Time
+SatMarkovFadingSeries::GetDuration() const
+{
+    return Seconds(m_samplingInterval.GetSeconds() * m_sampleCount);
+}
+
+} // namespace ns3
@@ -0,0 +1,143 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+#ifndef SATELLITE_MARKOV_FADING_SERIES_H
+#define SATELLITE_MARKOV_FADING_SERIES_H
+
+#include <ns3/nstime.h>
+#include <ns3/ptr.h>
+#include <ns3/simple-ref-count.h>
+
+#include <cmath>
+#include <stdint.h>
+#include <vector>
+
+namespace ns3
+{
+
+class SatMarkovConf;
+
+/**
+ * \ingroup satellite
+ *
+ * \brief Fading time series pregenerated for a Markov configuration.
+ *
+ * For each parameter set (elevation) and state of the Markov configuration,
+ * a few independent realizations of the state fader are sampled at a fixed
+ * interval over a given duration, once for all the links using the
+ * configuration. A link replays one of the series, from its own random
+ * offset, the gain between two samples being linearly interpolated and the
+ * series being repeated after its duration. The memory cost is thus set by
+ * the number and the duration of the series, whatever the number of links.
+ *
+ * The gains are stored as returned by SatBaseFader::GetChannelGains, in
+ * linear format.
+ */
+class SatMarkovFadingSeries : public SimpleRefCount<SatMarkovFadingSeries>
+{
+  public:
+    /**
+     * \brief Constructor, generating the series
+     * \param markovConf Markov configuration
+     * \param seriesCount Number of series per parameter set and state
+     * \param duration Duration of a series
+     * \param samplingInterval Interval between two samples of a series
+     */
+    SatMarkovFadingSeries(Ptr<SatMarkovConf> markovConf,
+                          uint32_t seriesCount,
+                          Time duration,
+                          Time samplingInterval);
+
+    /**
+     * \brief Get the number of series per parameter set and state
+     * \return number of series
+     */
+    uint32_t GetSeriesCount() const;
+
+    /**
+     * \brief Get the duration of a series
+     * \return duration of a series
+     */
+    Time GetDuration() const;
+
+    /**
+     * \brief Get the channel gain of a series at a time
+     * \param set parameter set
+     * \param state state
+     * \param series index of the series, lower than GetSeriesCount
+     * \param timeInSeconds time in the series in seconds, from 0, repeated after the duration
+     * \return channel gain
+     */
+    inline double GetChannelGain(uint32_t set,
+                                 uint32_t state,
+                                 uint32_t series,
+                                 double timeInSeconds) const
+    {
+        double position = std::fmod(timeInSeconds * m_invSamplingInterval, m_sampleCount);
+        uint32_t index = static_cast<uint32_t>(position);
+        if (index >= m_sampleCount)
+        {
+            index = 0;
+            position = 0.0;
+        }
+        uint32_t next = (index + 1 == m_sampleCount) ? 0 : index + 1;
+
+        const float* samples =
+            &m_gains[((std::size_t)(set * m_stateCount + state) * m_seriesCount + series) *
+                     m_sampleCount];
+        return samples[index] + (position - index) * (samples[next] - samples[index]);
+    }
+
+  private:
+    /**
+     * \brief Number of states
+     */
+    uint32_t m_stateCount;
+
+    /**
+     * \brief Number of series per parameter set and state
+     */
+    uint32_t m_seriesCount;
+
+    /**
+     * \brief Number of samples of a series
+     */
+    uint32_t m_sampleCount;
+
+    /**
+     * \brief Interval between two samples of a series
+     */
+    Time m_samplingInterval;
+
+    /**
+     * \brief Inverse of the interval between two samples in seconds
+     */
+    double m_invSamplingInterval;
+
+    /**
+     * \brief Samples of the series, series by series, grouped by state then by
+     * parameter set
+     */
+    std::vector<float> m_gains;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_MARKOV_FADING_SERIES_H */
@@ -65,6 +65,7 @@ SatMobilityModel::GetInstanceTypeId(void) const
 
 SatMobilityModel::SatMobilityModel()
     : m_cartesianPositionOutdated(false),
+      m_courseChangeVersion(0),
       m_GetAsGeoCoordinates(true)
 {
 }
@@ -89,10 +90,23 @@ SatMobilityModel::SetGeoPosition(const GeoCoordinate& position)
 void
 SatMobilityModel::NotifyGeoCourseChange(void) const
 {
+    m_courseChangeVersion++;
     m_satCourseChangeTrace(this);
     NotifyCourseChange();
 }
 
+uint64_t
+SatMobilityModel::GetCourseChangeVersion(void) const
+{
+    return m_courseChangeVersion;
+}
+
+bool
+SatMobilityModel::IsPositionTimeDriven(void) const
+{
+    return false;
+}
+
 Vector
 SatMobilityModel::DoGetPosition(void) const
 {
@@ -69,6 +69,21 @@ class SatMobilityModel : public MobilityModel
 
     void NotifyGeoCourseChange(void) const;
 
+    /**
+     * \brief Get the course change version of this model. The version is
+     * incremented each time a course change is notified, so it may be used
+     * to detect whether the position has changed since it was last read.
+     * \return the course change version
+     */
+    uint64_t GetCourseChangeVersion(void) const;
+
+    /**
+     * \brief Tell whether the position of this model evolves with the simulation
+     * time without course change notifications, e.g. orbit propagation.
+     * \return true if the position is time driven, false otherwise
+     */
+    virtual bool IsPositionTimeDriven(void) const;
+
     /**
      * Callback signature for `SatCourseChange` trace source.
      *
@@ -130,6 +145,9 @@ class SatMobilityModel : public MobilityModel
     // flag to indicated if position in Cartesian format is out of date.
     mutable bool m_cartesianPositionOutdated;
 
+    // counter of notified course changes
+    mutable uint64_t m_courseChangeVersion;
+
     // this is the flag for indicating that when calling method DoSetPosition (defined by class
     // Mobility Model) is taking Vector filled by longitude (in x), latitude (in y) and altitude (in
     // z) this enables using ns-3 mobility helper without to convert geo coordinates first to
@@ -24,10 +24,14 @@
 #include "satellite-utils.h"
 
 #include <ns3/double.h>
+#include <ns3/enum.h>
 #include <ns3/fatal-error.h>
 #include <ns3/log.h>
+#include <ns3/singleton.h>
 
+#include <algorithm>
 #include <cmath>
+#include <fstream>
 
 NS_LOG_COMPONENT_DEFINE("SatMutualInformationTable");
 
@@ -37,7 +41,10 @@ namespace ns3
 NS_OBJECT_ENSURE_REGISTERED(SatMutualInformationTable);
 
 SatMutualInformationTable::SatMutualInformationTable(std::string mutualInformationPath)
-    : m_beta(1.0)
+    : m_gridInvStepDb(0.0),
+      m_inverseInvStep(0.0),
+      m_beta(1.0),
+      m_lookUpMode(MI_LINEAR_SCAN)
 {
     NS_LOG_FUNCTION(this << mutualInformationPath);
     Load(mutualInformationPath);
@@ -55,17 +62,9 @@ SatMutualInformationTable::DoDispose()
 
     m_snirDb.clear();
     m_symbolInformation.clear();
-
-    if (m_ifs != 0)
-    {
-        if (m_ifs->is_open())
-        {
-            m_ifs->close();
-        }
-
-        delete m_ifs;
-        m_ifs = 0;
-    }
+    m_gridSymbolInformation.clear();
+    m_gridSlope.clear();
+    m_inverseRow.clear();
 
     Object::DoDispose();
 }
@@ -73,13 +72,24 @@ SatMutualInformationTable::DoDispose()
 TypeId
 SatMutualInformationTable::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::SatMutualInformationTable")
-                            .SetParent<Object>()
-                            .AddAttribute("Beta",
-                                          "The adjusting factor for the MI function",
-                                          DoubleValue(1.0),
-                                          MakeDoubleAccessor(&SatMutualInformationTable::m_beta),
-                                          MakeDoubleChecker<double>());
+    static TypeId tid =
+        TypeId("ns3::SatMutualInformationTable")
+            .SetParent<Object>()
+            .AddAttribute("Beta",
+                          "The adjusting factor for the MI function",
+                          DoubleValue(1.0),
+                          MakeDoubleAccessor(&SatMutualInformationTable::m_beta),
+                          MakeDoubleChecker<double>())
+            .AddAttribute("LookUpMode",
+                          "Mode used to look up the symbol information and its inverse. "
+                          "The uniform grid resamples the table and approximates the symbol "
+                          "information near the rows.",
+                          EnumValue(SatMutualInformationTable::MI_LINEAR_SCAN),
+                          MakeEnumAccessor(&SatMutualInformationTable::m_lookUpMode),
+                          MakeEnumChecker(SatMutualInformationTable::MI_LINEAR_SCAN,
+                                          "LinearScan",
+                                          SatMutualInformationTable::MI_UNIFORM_GRID,
+                                          "UniformGrid"));
     return tid;
 }
 
@@ -87,6 +97,18 @@ double
 SatMutualInformationTable::GetNormalizedSymbolInformation(double snirDb) const
 {
     NS_LOG_FUNCTION(this << snirDb);
+
+    if (m_lookUpMode == MI_UNIFORM_GRID && !m_gridSlope.empty())
+    {
+        return GridSymbolInformation(snirDb);
+    }
+
+    return ScanSymbolInformation(snirDb);
+}
+
+double
+SatMutualInformationTable::ScanSymbolInformation(double snirDb) const
+{
     NS_LOG_INFO("SatMutualInformationTable::GetNormalizedSymbolInformation - SNIR dB=" << snirDb);
 
     uint16_t n = m_snirDb.size();
@@ -139,7 +161,7 @@ SatMutualInformationTable::GetNormalizedSymbolInformation(double snirDb) const
         return symbolInformation;
     }
 
-} // end of double SatMutualInformationTable::GetNormalizedSymbolInformation (double snirDb) const
+} // end of double SatMutualInformationTable::ScanSymbolInformation (double snirDb) const
 
 double
 SatMutualInformationTable::GetSnirDb(double symbolInformationTarget) const
@@ -176,91 +198,296 @@ SatMutualInformationTable::GetSnirDb(double symbolInformationTarget) const
         return m_snirDb[n - 1];
     }
 
-    double snir = 0.0;
-    // Go through the list from end to beginning
-    for (uint32_t i = 0; i < n; ++i)
+    uint32_t i = FindRow(symbolInformationTarget);
+
+    double snir = SatUtils::Interpolate(symbolInformationTarget,
+                                        m_symbolInformation[i - 1],
+                                        m_symbolInformation[i],
+                                        m_snirDb[i - 1],
+                                        m_snirDb[i]);
+    NS_LOG_INFO(this << " Interpolate: " << symbolInformationTarget << " to snir = " << snir
+                     << "(symbolInformation0: " << m_symbolInformation[i - 1]
+                     << ", symbolInformation1: " << m_symbolInformation[i] << ", snir0: "
+                     << m_snirDb[i - 1] << ", snir1: " << m_snirDb[i] << ")");
+    return snir;
+} // end of double SatMutualInformationTable::GetSnir (double symbolInformationTarget) const
+
+double
+SatMutualInformationTable::GetEffectiveSnir(const SatFragmentVector& gamma) const
+{
+    NS_LOG_FUNCTION(this);
+
+    double meanSymbolInformation = 0.0;
+
+    if (m_lookUpMode == MI_UNIFORM_GRID && !m_gridSlope.empty())
     {
-        if (symbolInformationTarget <= m_symbolInformation[i])
+        // the symbol information of a chunk of fragments is computed without
+        // data dependent branches, then weighted by the fragment durations
+        const std::size_t chunkSize = 64;
+        double symbolInformation[chunkSize];
+        const double* durations = gamma.GetDurations();
+        const double* values = gamma.GetValues();
+
+        for (std::size_t start = 0; start < gamma.GetSize(); start += chunkSize)
         {
-            snir = SatUtils::Interpolate(symbolInformationTarget,
-                                         m_symbolInformation[i - 1],
-                                         m_symbolInformation[i],
-                                         m_snirDb[i - 1],
-                                         m_snirDb[i]);
-            NS_LOG_INFO(this << " Interpolate: " << symbolInformationTarget << " to snir = " << snir
-                             << "(symbolInformation0: " << m_symbolInformation[i - 1]
-                             << ", symbolInformation1: " << m_symbolInformation[i] << ", snir0: "
-                             << m_snirDb[i - 1] << ", snir1: " << m_snirDb[i] << ")");
-            return snir;
+            std::size_t count = std::min(chunkSize, gamma.GetSize() - start);
+            for (std::size_t i = 0; i < count; i++)
+            {
+                symbolInformation[i] =
+                    GridSymbolInformation(SatUtils::LinearToDb(values[start + i] / m_beta));
+            }
+            meanSymbolInformation +=
+                SatFragmentVector::WeightedSum(durations + start, symbolInformation, count);
+        }
+    }
+    else
+    {
+        for (std::size_t i = 0; i < gamma.GetSize(); i++)
+        {
+            meanSymbolInformation +=
+                gamma.GetDuration(i) * GetNormalizedSymbolInformation(
+                                           SatUtils::LinearToDb(gamma.GetValue(i) / m_beta));
         }
     }
 
-    return snir;
-} // end of double SatMutualInformationTable::GetSnir (double symbolInformationTarget) const
+    return m_beta * SatUtils::DbToLinear(GetSnirDb(meanSymbolInformation));
+}
 
 void
 SatMutualInformationTable::Load(std::string mutualInformationPath)
 {
     NS_LOG_FUNCTION(this << mutualInformationPath);
 
+    SatTableBundle::Columns_t columns;
+    bool fromBundle = Singleton<SatTableBundle>::Get()->GetColumns(mutualInformationPath, columns);
+
+    if (!fromBundle)
+    {
+        SatTableBundle::TextColumns_t text;
+        ReadTextColumns(mutualInformationPath, text);
+        SatTableBundle::TakeColumns(text, columns);
+    }
+
+    // at least contains one row
+    if (columns.size() != 2 || columns[0].empty())
+    {
+        NS_FATAL_ERROR("Error reading data from file " << mutualInformationPath << ".");
+    }
+
+    // the text file has been checked while read
+    if (fromBundle)
+    {
+        CheckSorted(mutualInformationPath,
+                    columns[0].begin(),
+                    columns[1].begin(),
+                    columns[0].size());
+    }
+
+    m_snirDb.swap(columns[0]);
+    m_symbolInformation.swap(columns[1]);
+
+    // SNIR and BLER have same size
+    NS_ASSERT(m_snirDb.size() == m_symbolInformation.size());
+
+    BuildIndex();
+
+} // end of void Load (std::string mutualInformationPath)
+
+void
+SatMutualInformationTable::ReadTextColumns(std::string mutualInformationPath,
+                                           SatTableBundle::TextColumns_t& columns)
+{
+    NS_LOG_FUNCTION(mutualInformationPath);
+
     // READ FROM THE SPECIFIED INPUT FILE
 
-    m_ifs = new std::ifstream(mutualInformationPath.c_str(), std::ifstream::in);
+    std::ifstream ifs(mutualInformationPath.c_str(), std::ifstream::in);
 
-    if (!m_ifs->is_open())
+    if (!ifs.is_open())
     {
         // script might be launched by test.py, try a different base path
-        delete m_ifs;
         mutualInformationPath = "../../" + mutualInformationPath;
-        m_ifs = new std::ifstream(mutualInformationPath.c_str(), std::ifstream::in);
+        ifs.open(mutualInformationPath.c_str(), std::ifstream::in);
 
-        if (!m_ifs->is_open())
+        if (!ifs.is_open())
         {
             NS_FATAL_ERROR("The file " << mutualInformationPath << " is not found.");
         }
     }
 
-    double lastSnirDb = -100.0;         //-1.0e100; // very low value
-    double lastSymbolInformation = 0.0; // minimum value
+    columns.assign(2, std::vector<double>());
 
     double snirDb, symbolInformation;
-    *m_ifs >> snirDb >> symbolInformation;
+    ifs >> snirDb >> symbolInformation;
 
-    while (m_ifs->good())
+    while (ifs.good())
     {
-        NS_LOG_DEBUG(this << " snirDb=" << snirDb << ", symbolInformation=" << symbolInformation);
+        NS_LOG_DEBUG(" snirDb=" << snirDb << ", symbolInformation=" << symbolInformation);
+
+        // record the values
+        columns[0].push_back(snirDb);
+        columns[1].push_back(symbolInformation);
 
-        // SANITY CHECK PART I
-        if ((snirDb <= lastSnirDb) || (symbolInformation < lastSymbolInformation))
+        // get next row
+        ifs >> snirDb >> symbolInformation;
+    }
+
+    ifs.close();
+
+    CheckSorted(mutualInformationPath, columns[0].data(), columns[1].data(), columns[0].size());
+
+} // end of void ReadTextColumns (std::string mutualInformationPath, TextColumns_t& columns)
+
+void
+SatMutualInformationTable::CheckSorted(std::string mutualInformationPath,
+                                       const double* snirDb,
+                                       const double* symbolInformation,
+                                       std::size_t rows)
+{
+    double lastSnirDb = -100.0;         //-1.0e100; // very low value
+    double lastSymbolInformation = 0.0; // minimum value
+
+    for (std::size_t i = 0; i < rows; i++)
+    {
+        // SANITY CHECK PART I, written to also reject NaN values of a corrupted bundle
+        if (!(snirDb[i] > lastSnirDb) || !(symbolInformation[i] >= lastSymbolInformation))
         {
             NS_FATAL_ERROR("The file " << mutualInformationPath << " is not properly sorted.");
         }
 
-        // record the values
-        m_snirDb.push_back(snirDb);
-        m_symbolInformation.push_back(symbolInformation);
-        lastSnirDb = snirDb;
-        lastSymbolInformation = symbolInformation;
+        lastSnirDb = snirDb[i];
+        lastSymbolInformation = symbolInformation[i];
+    }
+}
 
-        // get next row
-        *m_ifs >> snirDb >> symbolInformation;
+void
+SatMutualInformationTable::BuildIndex()
+{
+    NS_LOG_FUNCTION(this);
+
+    // upper bound of the grid sizes, for tables with very close rows
+    const uint32_t maxGridCells = 65536;
+
+    // cells per smallest row spacing of the SNIR grid, bounding the
+    // resampling error near the rows
+    const double gridRefinement = 16.0;
+
+    uint32_t n = m_snirDb.size();
+
+    m_gridSymbolInformation.clear();
+    m_gridSlope.clear();
+    m_gridInvStepDb = 0.0;
+    m_inverseRow.clear();
+    m_inverseInvStep = 0.0;
+
+    if (n < 2)
+    {
+        return;
     }
 
-    m_ifs->close();
-    delete m_ifs;
-    m_ifs = 0;
+    // SNIR grid, resampling the rows, exact on each grid point
+    double rangeDb = m_snirDb[n - 1] - m_snirDb[0];
+    double minSpacingDb = rangeDb;
+    for (uint32_t i = 1; i < n; i++)
+    {
+        minSpacingDb = std::min(minSpacingDb, m_snirDb[i] - m_snirDb[i - 1]);
+    }
 
-    // SANITY CHECK PART II
+    // tables with duplicate or unordered rows are searched exactly
+    if (!(rangeDb > 0.0) || !(minSpacingDb > 0.0))
+    {
+        NS_LOG_INFO(this << " No uniform grid for " << n << " rows spanning " << rangeDb
+                         << " dB with minimum spacing " << minSpacingDb << " dB");
+        return;
+    }
 
-    // at least contains one row
-    if (m_snirDb.empty())
+    double gridCells = std::ceil(rangeDb / minSpacingDb) * gridRefinement;
+    uint32_t cells = gridCells < maxGridCells ? static_cast<uint32_t>(gridCells) : maxGridCells;
+    m_gridInvStepDb = cells / rangeDb;
+    m_gridSymbolInformation.resize(cells + 1);
+    for (uint32_t k = 0; k <= cells; k++)
     {
-        NS_FATAL_ERROR("Error reading data from file " << mutualInformationPath << ".");
+        m_gridSymbolInformation[k] = ScanSymbolInformation(m_snirDb[0] + k * rangeDb / cells);
     }
+    m_gridSymbolInformation[0] = m_symbolInformation[0];
+    m_gridSymbolInformation[cells] = m_symbolInformation[n - 1];
 
-    // SNIR and BLER have same size
-    NS_ASSERT(m_snirDb.size() == m_symbolInformation.size());
+    m_gridSlope.resize(cells);
+    for (uint32_t k = 0; k < cells; k++)
+    {
+        m_gridSlope[k] = m_gridSymbolInformation[k + 1] - m_gridSymbolInformation[k];
+    }
 
-} // end of void Load (std::string mutualInformationPath)
+    // symbol information grid, a step not larger than the smallest positive
+    // row spacing puts at most one row boundary in each cell
+    double range = m_symbolInformation[n - 1] - m_symbolInformation[0];
+    if (!(range > 0.0))
+    {
+        return;
+    }
+
+    double minSpacing = range;
+    for (uint32_t i = 1; i < n; i++)
+    {
+        double spacing = m_symbolInformation[i] - m_symbolInformation[i - 1];
+        if (spacing > 0.0)
+        {
+            minSpacing = std::min(minSpacing, spacing);
+        }
+    }
+
+    gridCells = std::ceil(range / minSpacing);
+    cells = gridCells < maxGridCells ? static_cast<uint32_t>(gridCells) : maxGridCells;
+    m_inverseInvStep = cells / range;
+    m_inverseRow.resize(cells + 1);
+
+    uint32_t row = 1;
+    for (uint32_t k = 0; k <= cells; k++)
+    {
+        double gridPoint = m_symbolInformation[0] + k * range / cells;
+        while (row < n - 1 && m_symbolInformation[row] < gridPoint)
+        {
+            row++;
+        }
+        m_inverseRow[k] = row;
+    }
+
+    NS_LOG_INFO(this << " Uniform grids of " << m_gridSlope.size() << " and " << cells
+                     << " cells for " << n << " rows");
+}
+
+uint32_t
+SatMutualInformationTable::FindRow(double symbolInformation) const
+{
+    uint32_t i = 1;
+
+    if (m_lookUpMode == MI_UNIFORM_GRID && !m_inverseRow.empty())
+    {
+        double position = (symbolInformation - m_symbolInformation[0]) * m_inverseInvStep;
+        std::size_t cell = m_inverseRow.size() - 1;
+        if (!(position > 0.0))
+        {
+            cell = 0;
+        }
+        else if (position < cell)
+        {
+            cell = static_cast<std::size_t>(position);
+        }
+
+        // the grid row is exact at the cell start, step over the row boundary
+        // inside the cell and any rounding of the cell index
+        i = m_inverseRow[cell];
+        while (i > 1 && m_symbolInformation[i - 1] >= symbolInformation)
+        {
+            i--;
+        }
+    }
+
+    while (m_symbolInformation[i] < symbolInformation)
+    {
+        i++;
+    }
+    return i;
+}
 
 } // end of namespace ns3
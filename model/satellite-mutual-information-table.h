@@ -22,9 +22,12 @@
 #ifndef SATELLITE_MUTUAL_INFORMATION_TABLE_H
 #define SATELLITE_MUTUAL_INFORMATION_TABLE_H
 
+#include "satellite-fragment-vector.h"
+#include "satellite-table-bundle.h"
+
 #include <ns3/object.h>
 
-#include <fstream>
+#include <algorithm>
 #include <vector>
 
 namespace ns3
@@ -34,10 +37,29 @@ namespace ns3
  * \ingroup satellite
  *
  * \brief Loads a mutual information file and provide query service.
+ *
+ * The normalized symbol information is linearly interpolated between the
+ * rows of the file, found by a linear scan by default. In the opt-in uniform
+ * grid mode, it is resampled at load time on a uniform SNIR grid several
+ * times finer than the smallest row spacing, so that a lookup is a
+ * branch-free interpolation between two grid points, approximating the
+ * symbol information near the rows. The inverse lookup keeps the rows of the
+ * file and finds the bracketing rows through a uniform grid over the symbol
+ * information, as the SNIR is very steep near saturation. Tables too small
+ * or too irregular for a grid are always searched exactly.
  */
 class SatMutualInformationTable : public Object
 {
   public:
+    /**
+     * \brief Lookup mode
+     */
+    enum LookUpMode
+    {
+        MI_LINEAR_SCAN,
+        MI_UNIFORM_GRID
+    };
+
     /**
      * Constructor with initialization parameters.
      * \param mutualInformationPath
@@ -69,6 +91,16 @@ class SatMutualInformationTable : public Object
      */
     double GetSnirDb(double symbolInformationTarget) const;
 
+    /**
+     * \brief Get the effective SNIR of a packet using the MIESM: the mean of
+     * the normalized symbol information over the fragments, mapped back to
+     * a SNIR.
+     * \param gamma SINR fragments of the packet in linear scale, durations
+     * being fractions of the packet duration
+     * \return Effective SNIR in linear scale
+     */
+    double GetEffectiveSnir(const SatFragmentVector& gamma) const;
+
     /**
      * \brief Get the value of beta
      */
@@ -77,23 +109,113 @@ class SatMutualInformationTable : public Object
         return m_beta;
     }
 
+    /**
+     * \brief Parse a mutual information text file
+     * \param mutualInformationPath Path to a mutual information file.
+     * \param columns SNIR in dB and normalized symbol information columns
+     */
+    static void ReadTextColumns(std::string mutualInformationPath,
+                                SatTableBundle::TextColumns_t& columns);
+
   private:
     virtual void DoDispose();
 
     /**
-     * \brief Load the mutual information
+     * \brief Check that the SNIR increases and the symbol information does not
+     * decrease from row to row, whether the table comes from a text file or a bundle
+     * \param mutualInformationPath Path to the mutual information file, for the
+     * error message
+     * \param snirDb SNIR column
+     * \param symbolInformation Normalized symbol information column
+     * \param rows Number of rows
+     */
+    static void CheckSorted(std::string mutualInformationPath,
+                            const double* snirDb,
+                            const double* symbolInformation,
+                            std::size_t rows);
+
+    /**
+     * \brief Load the mutual information, from the table bundle if it holds an
+     * up to date copy of the file
      * \param mutualInformationPath Path to a mutual information file.
      */
     void Load(std::string mutualInformationPath);
 
-    std::vector<double> m_snirDb;
-    std::vector<double> m_symbolInformation;
-    std::ifstream* m_ifs;
+    /**
+     * \brief Build the uniform SNIR grid and the symbol information index
+     */
+    void BuildIndex();
+
+    /**
+     * \brief Get the Normalized Symbol Information by a linear scan of the rows
+     * \param snirDb SNIR in logarithmic scale
+     * \return Normalized Symbol Information
+     */
+    double ScanSymbolInformation(double snirDb) const;
+
+    /**
+     * \brief Get the Normalized Symbol Information from the uniform SNIR grid
+     * \param snirDb SNIR in logarithmic scale
+     * \return Normalized Symbol Information
+     */
+    inline double GridSymbolInformation(double snirDb) const
+    {
+        double cells = m_gridSlope.size();
+        double position = std::min(std::max((snirDb - m_snirDb.front()) * m_gridInvStepDb, 0.0),
+                                   cells);
+        std::size_t cell = std::min(static_cast<std::size_t>(position), m_gridSlope.size() - 1);
+        double symbolInformation =
+            m_gridSymbolInformation[cell] + m_gridSlope[cell] * (position - cell);
+        symbolInformation = snirDb < m_snirDb.front() ? 0.0 : symbolInformation;
+        return snirDb > m_snirDb.back() ? 1.0 : symbolInformation;
+    }
+
+    /**
+     * \brief Find the first row (from 1) whose symbol information is greater
+     * or equal to the given one
+     * \param symbolInformation Symbol information, within the table range
+     * \return Row index
+     */
+    uint32_t FindRow(double symbolInformation) const;
+
+    SatTableBundle::Column m_snirDb;
+    SatTableBundle::Column m_symbolInformation;
+
+    /**
+     * \brief Normalized symbol information on each point of the uniform SNIR grid
+     */
+    std::vector<double> m_gridSymbolInformation;
+
+    /**
+     * \brief Symbol information increase over each cell of the uniform SNIR grid
+     */
+    std::vector<double> m_gridSlope;
+
+    /**
+     * \brief Inverse of the SNIR grid step, in 1/dB
+     */
+    double m_gridInvStepDb;
+
+    /**
+     * \brief First row (from 1) whose symbol information is greater or equal
+     * to each point of the symbol information grid
+     */
+    std::vector<uint32_t> m_inverseRow;
+
+    /**
+     * \brief Inverse of the symbol information grid step
+     */
+    double m_inverseInvStep;
 
     /**
      * \brief The adjusting factor beta.
      */
     double m_beta;
+
+    /**
+     * \brief Lookup mode
+     */
+    LookUpMode m_lookUpMode;
 };
 
 } // end of namespace ns3
@@ -49,7 +49,9 @@ SatPerFragmentInterference::GetInstanceTypeId(void) const
 
 SatPerFragmentInterference::SatPerFragmentInterference()
     : SatPerPacketInterference(),
+      m_eventChangeTimes(),
       m_ifPowerAtEventChangeW(),
+      m_ifPowerPerFragment(),
       m_maxFragmentsCount(1)
 {
     NS_LOG_FUNCTION(this);
@@ -58,7 +60,9 @@ SatPerFragmentInterference::SatPerFragmentInterference()
 SatPerFragmentInterference::SatPerFragmentInterference(SatEnums::ChannelType_t channelType,
                                                        double rxBandwidthHz)
     : SatPerPacketInterference(channelType, rxBandwidthHz),
+      m_eventChangeTimes(),
       m_ifPowerAtEventChangeW(),
+      m_ifPowerPerFragment(),
       m_maxFragmentsCount(1)
 {
     NS_LOG_FUNCTION(this);
@@ -69,19 +73,21 @@ SatPerFragmentInterference::~SatPerFragmentInterference()
     NS_LOG_FUNCTION(this);
 }
 
-std::vector<std::pair<double, double>>
+const SatFragmentVector&
 SatPerFragmentInterference::DoCalculate(Ptr<SatInterference::InterferenceChangeEvent> event)
 {
     NS_LOG_FUNCTION(this);
 
+    m_eventChangeTimes.clear();
     m_ifPowerAtEventChangeW.clear();
+    m_eventChangeTimes.reserve(m_maxFragmentsCount);
     m_ifPowerAtEventChangeW.reserve(m_maxFragmentsCount);
 
     // Use the per packet interference computation hooks to store
     // interferences at each event associated to the current packet
     SatPerPacketInterference::DoCalculate(event);
 
-    std::size_t fragmentsCount = m_ifPowerAtEventChangeW.size();
+    std::size_t fragmentsCount = m_eventChangeTimes.size();
     if (!fragmentsCount)
     {
         NS_FATAL_ERROR("Interference computation did not find a single fragment");
@@ -93,25 +99,23 @@ SatPerFragmentInterference::DoCalculate(Ptr<SatInterference::InterferenceChangeE
     }
 
     // Convert time ratio into durations
-    std::vector<std::pair<double, double>> ifPowerPerFragment;
-    ifPowerPerFragment.reserve(fragmentsCount);
+    m_ifPowerPerFragment.Clear();
+    m_ifPowerPerFragment.Reserve(fragmentsCount);
 
-    std::vector<std::pair<double, double>>::const_iterator iter = m_ifPowerAtEventChangeW.begin();
-    std::pair<double, double> eventChangeInPower = *iter;
-    for (++iter; iter != m_ifPowerAtEventChangeW.end(); ++iter)
+    for (std::size_t i = 1; i < fragmentsCount; i++)
     {
-        ifPowerPerFragment.emplace_back(iter->first - eventChangeInPower.first,
-                                        eventChangeInPower.second);
-        eventChangeInPower = *iter;
+        m_ifPowerPerFragment.Add(m_eventChangeTimes[i] - m_eventChangeTimes[i - 1],
+                                 m_ifPowerAtEventChangeW[i - 1]);
     }
 
     // Account for the last fragment duration
-    if (eventChangeInPower.first != 1.0)
+    double lastChangeTime = m_eventChangeTimes[fragmentsCount - 1];
+    if (lastChangeTime != 1.0)
     {
-        ifPowerPerFragment.emplace_back(1.0 - eventChangeInPower.first, eventChangeInPower.second);
+        m_ifPowerPerFragment.Add(1.0 - lastChangeTime, m_ifPowerAtEventChangeW[fragmentsCount - 1]);
     }
 
-    return ifPowerPerFragment;
+    return m_ifPowerPerFragment;
 }
 
 void
@@ -119,7 +123,8 @@ SatPerFragmentInterference::onOwnStartReached(double ifPowerW)
 {
     // Hook into per packet interference computation to store
     // interference level at the beginning of the packet
-    m_ifPowerAtEventChangeW.emplace_back(0.0, ifPowerW);
+    m_eventChangeTimes.push_back(0.0);
+    m_ifPowerAtEventChangeW.push_back(ifPowerW);
 }
 
 void
@@ -130,7 +135,8 @@ SatPerFragmentInterference::onInterferentEvent(long double timeRatio,
     // Hook into per packet interference computation to store
     // interference level at each event change
     ifPowerW += interferenceValue;
-    m_ifPowerAtEventChangeW.emplace_back(1.0 - timeRatio, ifPowerW);
+    m_eventChangeTimes.push_back(1.0 - timeRatio);
+    m_ifPowerAtEventChangeW.push_back(ifPowerW);
 }
 
 } // namespace ns3
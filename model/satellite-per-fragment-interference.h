@@ -69,8 +69,7 @@ class SatPerFragmentInterference : public SatPerPacketInterference
      *
      * \return Final calculated power value at end of receiving
      */
-    std::vector<std::pair<double, double>> DoCalculate(
-        Ptr<SatInterference::InterferenceChangeEvent> event);
+    const SatFragmentVector& DoCalculate(Ptr<SatInterference::InterferenceChangeEvent> event);
 
     /**
      * Helper function meant for subclasses to override.
@@ -99,7 +98,16 @@ class SatPerFragmentInterference : public SatPerPacketInterference
     void onInterferentEvent(long double timeRatio, double interferenceValue, double& ifPowerW);
 
   private:
-    std::vector<std::pair<double, double>> m_ifPowerAtEventChangeW;
+    /**
+     * \brief Interference power at each power change, as normalized change time and power
+     */
+    std::vector<double> m_eventChangeTimes;
+    std::vector<double> m_ifPowerAtEventChangeW;
+
+    /**
+     * \brief Calculated interference, reused between calculations
+     */
+    SatFragmentVector m_ifPowerPerFragment;
 
     uint32_t m_maxFragmentsCount;
 };
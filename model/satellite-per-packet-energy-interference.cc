@@ -0,0 +1,332 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+#include "satellite-per-packet-energy-interference.h"
+
+#include <ns3/log.h>
+#include <ns3/simulator.h>
+#include <ns3/singleton.h>
+
+#include <cmath>
+#include <limits>
+
+NS_LOG_COMPONENT_DEFINE("SatPerPacketEnergyInterference");
+
+namespace ns3
+{
+
+NS_OBJECT_ENSURE_REGISTERED(SatPerPacketEnergyInterference);
+
+TypeId
+SatPerPacketEnergyInterference::GetTypeId(void)
+{
+    static TypeId tid = TypeId("ns3::SatPerPacketEnergyInterference")
+                            .SetParent<SatInterference>()
+                            .AddConstructor<SatPerPacketEnergyInterference>();
+
+    return tid;
+}
+
+TypeId
+SatPerPacketEnergyInterference::GetInstanceTypeId(void) const
+{
+    NS_LOG_FUNCTION(this);
+
+    return GetTypeId();
+}
+
+SatPerPacketEnergyInterference::SatPerPacketEnergyInterference()
+    : m_currentPowerW(0.0),
+      m_energy(0.0),
+      m_lastUpdate(Seconds(0)),
+      m_rxCount(0),
+      m_nextEventId(0),
+      m_enableTraceOutput(false),
+      m_channelType(),
+      m_rxBandwidth_Hz()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+SatPerPacketEnergyInterference::SatPerPacketEnergyInterference(
+    SatEnums::ChannelType_t channelType,
+    double rxBandwidthHz)
+    : m_currentPowerW(0.0),
+      m_energy(0.0),
+      m_lastUpdate(Seconds(0)),
+      m_rxCount(0),
+      m_nextEventId(0),
+      m_enableTraceOutput(true),
+      m_channelType(channelType),
+      m_rxBandwidth_Hz(rxBandwidthHz)
+{
+    NS_LOG_FUNCTION(this << channelType << rxBandwidthHz);
+
+    if (m_rxBandwidth_Hz <= std::numeric_limits<double>::epsilon())
+    {
+        NS_FATAL_ERROR(
+            "SatPerPacketEnergyInterference::SatPerPacketEnergyInterference - Invalid value");
+    }
+}
+
+SatPerPacketEnergyInterference::~SatPerPacketEnergyInterference()
+{
+    NS_LOG_FUNCTION(this);
+
+    Reset();
+}
+
+void
+SatPerPacketEnergyInterference::Advance(Time time)
+{
+    NS_LOG_FUNCTION(this << time);
+
+    PendingChanges_t::iterator it = m_pendingChanges.begin();
+    while (it != m_pendingChanges.end() && it->first <= time)
+    {
+        m_energy += m_currentPowerW * (it->first - m_lastUpdate).GetTimeStep();
+        m_lastUpdate = it->first;
+        m_currentPowerW += it->second.second;
+
+        std::map<uint32_t, eventEnergy_s>::iterator eventIt =
+            m_eventEnergies.find(it->second.first);
+        if (eventIt != m_eventEnergies.end())
+        {
+            if (eventIt->second.m_receiving)
+            {
+                // keep the energy at the end of the event until the receiver has calculated it
+                eventIt->second.m_endEnergy = m_energy;
+                eventIt->second.m_ended = true;
+            }
+            else
+            {
+                m_eventEnergies.erase(eventIt);
+            }
+        }
+
+        NS_LOG_INFO("Change applied: Time= " << it->first << ", Id= " << it->second.first
+                                             << ", Power (W)= " << m_currentPowerW);
+
+        it = m_pendingChanges.erase(it);
+    }
+
+    if (time > m_lastUpdate)
+    {
+        m_energy += m_currentPowerW * (time - m_lastUpdate).GetTimeStep();
+        m_lastUpdate = time;
+    }
+
+    RebaseIfIdle();
+}
+
+void
+SatPerPacketEnergyInterference::RebaseIfIdle()
+{
+    if (m_pendingChanges.empty())
+    {
+        // every transmission has ended, so the remaining power is only
+        // rounding residue of the additions and removals
+        m_currentPowerW = 0.0;
+
+        if (m_eventEnergies.empty())
+        {
+            m_energy = 0.0;
+        }
+    }
+}
+
+long double
+SatPerPacketEnergyInterference::ExtrapolateEnergy(Time time) const
+{
+    long double energy = m_energy;
+    long double power = m_currentPowerW;
+    Time lastUpdate = m_lastUpdate;
+
+    for (PendingChanges_t::const_iterator it = m_pendingChanges.begin();
+         it != m_pendingChanges.end() && it->first < time;
+         it++)
+    {
+        energy += power * (it->first - lastUpdate).GetTimeStep();
+        power += it->second.second;
+        lastUpdate = it->first;
+    }
+
+    return energy + power * (time - lastUpdate).GetTimeStep();
+}
+
+Ptr<SatInterference::InterferenceChangeEvent>
+SatPerPacketEnergyInterference::DoAdd(Time duration, double power, Address rxAddress)
+{
+    NS_LOG_FUNCTION(this << duration << power << rxAddress);
+
+    Ptr<SatInterference::InterferenceChangeEvent> event;
+    event = Create<SatInterference::InterferenceChangeEvent>(m_nextEventId++,
+                                                             duration,
+                                                             power,
+                                                             rxAddress);
+    Time now = event->GetStartTime();
+
+    NS_LOG_INFO("Add change: Duration= " << duration << ", Power= " << power << ", Time: " << now);
+
+    Advance(now);
+
+    eventEnergy_s energy;
+    energy.m_startEnergy = m_energy;
+    energy.m_endEnergy = 0.0;
+    energy.m_ended = false;
+    energy.m_receiving = false;
+    m_eventEnergies.insert(std::make_pair(event->GetId(), energy));
+
+    m_currentPowerW += power;
+    m_pendingChanges.insert(
+        std::make_pair(event->GetEndTime(), std::make_pair(event->GetId(), -(long double)power)));
+
+    NS_LOG_INFO("Change count after addition: " << m_pendingChanges.size());
+
+    return event;
+}
+
+const SatFragmentVector&
+SatPerPacketEnergyInterference::DoCalculate(Ptr<SatInterference::InterferenceChangeEvent> event)
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_rxCount == 0)
+    {
+        NS_FATAL_ERROR("Receiving is not set on!!!");
+    }
+
+    Advance(Simulator::Now());
+
+    std::map<uint32_t, eventEnergy_s>::const_iterator it = m_eventEnergies.find(event->GetId());
+    if (it == m_eventEnergies.end())
+    {
+        NS_FATAL_ERROR("Interference event " << event->GetId() << " not known!!!");
+    }
+
+    long double endEnergy =
+        it->second.m_ended ? it->second.m_endEnergy : ExtrapolateEnergy(event->GetEndTime());
+    int64_t duration = event->GetDuration().GetTimeStep();
+    double ifPowerW = 0.0;
+
+    if (duration > 0)
+    {
+        long double meanPowerW = (endEnergy - it->second.m_startEnergy) / duration;
+        long double otherPowerW = meanPowerW - event->GetRxPower();
+
+        // anything below the resolution of the energy integral is rounding residue
+        // of removing the own power, not interference
+        long double resolution =
+            8 * std::numeric_limits<long double>::epsilon() * std::fabs(endEnergy) / duration;
+
+        if (otherPowerW > resolution)
+        {
+            ifPowerW = otherPowerW;
+        }
+    }
+
+    NS_LOG_INFO("Calculate: IfPower (W)= " << ifPowerW << ", Event ID= " << event->GetId()
+                                           << ", Duration= " << event->GetDuration()
+                                           << ", StartTime= " << event->GetStartTime()
+                                           << ", EndTime= " << event->GetEndTime());
+
+    if (m_enableTraceOutput)
+    {
+        std::vector<double> tempVector;
+        tempVector.push_back(Now().GetSeconds());
+        tempVector.push_back(ifPowerW / m_rxBandwidth_Hz);
+        Singleton<SatInterferenceOutputTraceContainer>::Get()->AddToContainer(
+            std::make_pair(event->GetSatEarthStationAddress(), m_channelType),
+            tempVector);
+    }
+
+    m_ifPowerPerPacket.Clear();
+    m_ifPowerPerPacket.Add(1.0, ifPowerW);
+
+    return m_ifPowerPerPacket;
+}
+
+void
+SatPerPacketEnergyInterference::DoReset(void)
+{
+    NS_LOG_FUNCTION(this);
+
+    m_pendingChanges.clear();
+    m_eventEnergies.clear();
+    m_currentPowerW = 0.0;
+    m_energy = 0.0;
+    m_rxCount = 0;
+}
+
+void
+SatPerPacketEnergyInterference::DoNotifyRxStart(
+    Ptr<SatInterference::InterferenceChangeEvent> event)
+{
+    NS_LOG_FUNCTION(this);
+
+    std::map<uint32_t, eventEnergy_s>::iterator it = m_eventEnergies.find(event->GetId());
+    if (it == m_eventEnergies.end())
+    {
+        NS_FATAL_ERROR("Interference event " << event->GetId() << " not known!!!");
+    }
+
+    NS_ASSERT(!it->second.m_receiving);
+    it->second.m_receiving = true;
+    m_rxCount++;
+}
+
+void
+SatPerPacketEnergyInterference::DoNotifyRxEnd(Ptr<SatInterference::InterferenceChangeEvent> event)
+{
+    NS_LOG_FUNCTION(this);
+
+    std::map<uint32_t, eventEnergy_s>::iterator it = m_eventEnergies.find(event->GetId());
+    if (it != m_eventEnergies.end() && it->second.m_receiving)
+    {
+        // a pending end change without bookkeeping only updates the power
+        m_eventEnergies.erase(it);
+        m_rxCount--;
+    }
+
+    RebaseIfIdle();
+}
+
+void
+SatPerPacketEnergyInterference::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+
+    SatInterference::DoDispose();
+}
+
+void
+SatPerPacketEnergyInterference::SetRxBandwidth(double rxBandwidth)
+{
+    NS_LOG_FUNCTION(this << rxBandwidth);
+
+    if (rxBandwidth <= std::numeric_limits<double>::epsilon())
+    {
+        NS_FATAL_ERROR("SatPerPacketEnergyInterference::SetRxBandwidth - Invalid value");
+    }
+
+    m_rxBandwidth_Hz = rxBandwidth;
+}
+
+} // namespace ns3
@@ -0,0 +1,236 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+#ifndef SATELLITE_PER_PACKET_ENERGY_INTERFERENCE_H
+#define SATELLITE_PER_PACKET_ENERGY_INTERFERENCE_H
+
+#include "satellite-enums.h"
+#include "satellite-interference-output-trace-container.h"
+#include "satellite-interference.h"
+
+#include <map>
+
+namespace ns3
+{
+
+/**
+ * \ingroup satellite
+ * \brief Packet by packet interference computed from the running energy
+ * of the channel.
+ *
+ * Produces the same values as SatPerPacketInterference: the interference
+ * of a packet is the mean power of all other transmissions over the packet
+ * duration. Instead of walking the list of power changes for each packet,
+ * the total received power is integrated over time as the simulation
+ * advances and the energy is sampled at the start and at the end of every
+ * packet. The interference is then (E(end) - E(start)) / duration minus the
+ * packet's own power.
+ *
+ * Adding an event, notifying receivers and calculating interference all run
+ * in logarithmic time in the number of concurrent transmissions.
+ */
+class SatPerPacketEnergyInterference : public SatInterference
+{
+  public:
+    /**
+     * Derived from Object
+     */
+    static TypeId GetTypeId(void);
+
+    /**
+     * Derived from Object
+     */
+    TypeId GetInstanceTypeId(void) const;
+
+    /**
+     * Default constructor, interference output trace is disabled.
+     */
+    SatPerPacketEnergyInterference();
+
+    /**
+     * Constructor enabling interference output trace.
+     *
+     * \param channelType Type of the channel, used in output trace
+     * \param rxBandwidthHz Receiver bandwidth in Hertz
+     */
+    SatPerPacketEnergyInterference(SatEnums::ChannelType_t channelType, double rxBandwidthHz);
+
+    /**
+     * Destructor
+     */
+    ~SatPerPacketEnergyInterference();
+
+    /**
+     * Dispose of this class instance
+     */
+    void DoDispose();
+
+    /**
+     * Set the receiver bandwidth used in output trace.
+     *
+     * \param rxBandwidth Receiver bandwidth in Hertz
+     */
+    void SetRxBandwidth(double rxBandwidth);
+
+  private:
+    /**
+     * \brief Energy bookkeeping of an interference event.
+     */
+    typedef struct
+    {
+        long double m_startEnergy;
+        long double m_endEnergy;
+        bool m_ended;
+        bool m_receiving;
+    } eventEnergy_s;
+
+    /**
+     * Pending power changes (end of transmissions) ordered by time,
+     * each storing the event ID and the power change.
+     */
+    typedef std::multimap<Time, std::pair<uint32_t, long double>> PendingChanges_t;
+
+    /**
+     * Adds interference power to interference object.
+     *
+     * \param rxDuration Duration of the receiving.
+     * \param rxPower Receiving power.
+     * \param rxAddress MAC address.
+     *
+     * \return the pointer to interference event as a reference of the addition
+     */
+    virtual Ptr<SatInterference::InterferenceChangeEvent> DoAdd(Time rxDuration,
+                                                                double rxPower,
+                                                                Address rxAddress);
+
+    /**
+     * Calculates interference power for the given reference
+     *
+     * \param event Reference event which for interference is calculated.
+     *
+     * \return Final calculated power value at end of receiving
+     */
+    virtual const SatFragmentVector& DoCalculate(
+        Ptr<SatInterference::InterferenceChangeEvent> event);
+
+    /**
+     * Resets current interference.
+     */
+    virtual void DoReset(void);
+
+    /**
+     * Notifies that RX is started by a receiver.
+     *
+     * \param event Interference reference event of receiver
+     */
+    virtual void DoNotifyRxStart(Ptr<SatInterference::InterferenceChangeEvent> event);
+
+    /**
+     * Notifies that RX is ended by a receiver.
+     *
+     * \param event Interference reference event of receiver
+     */
+    virtual void DoNotifyRxEnd(Ptr<SatInterference::InterferenceChangeEvent> event);
+
+    /**
+     * Integrate the channel power up to the given time, applying every
+     * pending power change scheduled at or before it.
+     *
+     * \param time Time to advance the energy integral to
+     */
+    void Advance(Time time);
+
+    /**
+     * Restart the energy integral from zero when the channel is idle, so
+     * that the integral never grows large enough to lose precision.
+     */
+    void RebaseIfIdle();
+
+    /**
+     * Extrapolate the energy integral up to a time in the future using the
+     * pending power changes known so far.
+     *
+     * \param time Time in the future
+     * \return Energy at the given time
+     */
+    long double ExtrapolateEnergy(Time time) const;
+
+    SatPerPacketEnergyInterference(const SatPerPacketEnergyInterference& o);
+    SatPerPacketEnergyInterference& operator=(const SatPerPacketEnergyInterference& o);
+
+    /**
+     * \brief pending power changes
+     */
+    PendingChanges_t m_pendingChanges;
+
+    /**
+     * \brief energy bookkeeping of events still transmitting or receiving
+     */
+    std::map<uint32_t, eventEnergy_s> m_eventEnergies;
+
+    /**
+     * \brief current total power on the channel
+     */
+    long double m_currentPowerW;
+
+    /**
+     * \brief integral of channel power over time (W * time step) up to m_lastUpdate
+     */
+    long double m_energy;
+
+    /**
+     * \brief time the energy integral was last advanced to
+     */
+    Time m_lastUpdate;
+
+    /**
+     * \brief number of events currently received
+     */
+    uint32_t m_rxCount;
+
+    /**
+     * \brief event id for Events
+     */
+    uint32_t m_nextEventId;
+
+    /**
+     * \brief flag to indicate whether interference output trace is written
+     */
+    bool m_enableTraceOutput;
+
+    /**
+     * \brief Channel type used in output trace
+     */
+    SatEnums::ChannelType_t m_channelType;
+
+    /**
+     * \brief RX Bandwidth in Hz
+     */
+    double m_rxBandwidth_Hz;
+
+    /**
+     * \brief Calculated interference, reused between calculations
+     */
+    SatFragmentVector m_ifPowerPerPacket;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_PER_PACKET_ENERGY_INTERFERENCE_H */
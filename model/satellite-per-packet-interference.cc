@@ -153,7 +153,7 @@ SatPerPacketInterference::DoAdd(Time duration, double power, Address rxAddress)
     return event;
 }
 
-std::vector<std::pair<double, double>>
+const SatFragmentVector&
 SatPerPacketInterference::DoCalculate(Ptr<SatInterference::InterferenceChangeEvent> event)
 {
     NS_LOG_FUNCTION(this);
@@ -231,10 +231,10 @@ SatPerPacketInterference::DoCalculate(Ptr<SatInterference::InterferenceChangeEve
             tempVector);
     }
 
-    std::vector<std::pair<double, double>> ifPowerPerFragment;
-    ifPowerPerFragment.emplace_back(1.0, ifPowerW);
+    m_ifPowerPerPacket.Clear();
+    m_ifPowerPerPacket.Add(1.0, ifPowerW);
 
-    return ifPowerPerFragment;
+    return m_ifPowerPerPacket;
 }
 
 void
@@ -91,7 +91,7 @@ class SatPerPacketInterference : public SatInterference
      *
      * \return Final calculated power value at end of receiving
      */
-    virtual std::vector<std::pair<double, double>> DoCalculate(
+    virtual const SatFragmentVector& DoCalculate(
         Ptr<SatInterference::InterferenceChangeEvent> event);
 
     /**
@@ -217,6 +217,11 @@ class SatPerPacketInterference : public SatInterference
      * \brief RX Bandwidth in Hz
      */
     double m_rxBandwidth_Hz;
+
+    /**
+     * \brief Calculated interference, reused between calculations
+     */
+    SatFragmentVector m_ifPowerPerPacket;
 };
 
 } // namespace ns3
@@ -92,21 +92,20 @@ SatPerfectInterferenceElimination::EliminateInterferences(
 
     double oldIfPower;
     double normalizedTime = 0.0;
-    std::vector<std::pair<double, double>> ifPowerPerFragment;
     if (isRegenerative)
     {
         oldIfPower = packetInterferedWith->GetInterferencePower();
-        ifPowerPerFragment = packetInterferedWith->GetInterferencePowerPerFragment();
+        m_ifPowerPerFragment = packetInterferedWith->GetInterferencePowerPerFragment();
     }
     else
     {
         oldIfPower = packetInterferedWith->GetInterferencePowerInSatellite();
-        ifPowerPerFragment = packetInterferedWith->GetInterferencePowerInSatellitePerFragment();
+        m_ifPowerPerFragment = packetInterferedWith->GetInterferencePowerInSatellitePerFragment();
     }
 
-    for (std::pair<double, double>& ifPower : ifPowerPerFragment)
+    for (std::size_t i = 0; i < m_ifPowerPerFragment.GetSize(); i++)
     {
-        normalizedTime += ifPower.first;
+        normalizedTime += m_ifPowerPerFragment.GetDuration(i);
         if (startTime >= normalizedTime)
         {
             continue;
@@ -116,30 +115,33 @@ SatPerfectInterferenceElimination::EliminateInterferences(
             break;
         }
 
-        ifPower.second -= (isRegenerative ? processedPacket->m_rxPower_W
-                                          : processedPacket->GetRxPowerInSatellite());
-        if (std::abs(ifPower.second) < std::numeric_limits<double>::epsilon())
+        double ifPower = m_ifPowerPerFragment.GetValue(i) -
+                         (isRegenerative ? processedPacket->m_rxPower_W
+                                         : processedPacket->GetRxPowerInSatellite());
+        if (std::abs(ifPower) < std::numeric_limits<double>::epsilon())
         {
-            ifPower.second = 0.0;
+            ifPower = 0.0;
         }
 
-        if (ifPower.second < 0)
+        if (ifPower < 0)
         {
-            NS_FATAL_ERROR("Negative interference " << ifPower.second);
+            NS_FATAL_ERROR("Negative interference " << ifPower);
         }
+
+        m_ifPowerPerFragment.SetValue(i, ifPower);
     }
 
     if (isRegenerative)
     {
-        packetInterferedWith->SetInterferencePower(ifPowerPerFragment);
+        packetInterferedWith->SetInterferencePower(m_ifPowerPerFragment);
     }
     else
     {
-        packetInterferedWith->SetInterferencePowerInSatellite(ifPowerPerFragment);
+        packetInterferedWith->SetInterferencePowerInSatellite(m_ifPowerPerFragment);
     }
 
     NS_LOG_INFO("Interfered packet ifPower went from "
-                << oldIfPower << " to " << SatUtils::ScalarProduct(ifPowerPerFragment));
+                << oldIfPower << " to " << m_ifPowerPerFragment.GetWeightedSum());
 }
 
 double
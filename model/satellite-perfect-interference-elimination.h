@@ -22,6 +22,7 @@
 #define SATELLITE_PERFECT_INTERFERENCE_ELIMINATION_H
 
 #include "satellite-enums.h"
+#include "satellite-fragment-vector.h"
 #include "satellite-interference-elimination.h"
 
 namespace ns3
@@ -87,6 +88,12 @@ class SatPerfectInterferenceElimination : public SatInterferenceElimination
      * \brief Calculate the residual power of interference for a given packet
      */
     double GetResidualPower(Ptr<SatSignalParameters> processedPacket, double EsNo);
+
+  private:
+    /**
+     * \brief Interference of the packet being processed, reused between SIC passes
+     */
+    SatFragmentVector m_ifPowerPerFragment;
 };
 
 } // namespace ns3
@@ -246,7 +246,8 @@ SatPhyRxCarrierConf::GetChannelEstimatorErrorContainer() const
 SatPhyRxCarrierConf::RandomAccessCollisionModel
 SatPhyRxCarrierConf::GetRandomAccessCollisionModel() const
 {
-    if (m_raIfModel == IF_PER_PACKET || m_raIfModel == IF_PER_FRAGMENT)
+    if (m_raIfModel == IF_PER_PACKET || m_raIfModel == IF_PER_FRAGMENT ||
+        m_raIfModel == IF_PER_PACKET_ENERGY)
     {
         return m_raCollisionModel;
     }
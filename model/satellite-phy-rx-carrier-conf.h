@@ -79,7 +79,8 @@ class SatPhyRxCarrierConf : public Object
         IF_PER_PACKET,
         IF_PER_FRAGMENT,
         IF_TRACE,
-        IF_CONSTANT
+        IF_CONSTANT,
+        IF_PER_PACKET_ENERGY
     };
 
     /**
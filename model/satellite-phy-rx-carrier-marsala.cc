@@ -67,13 +67,28 @@ SatPhyRxCarrierMarsala::PerformSicCycles(
 {
     NS_LOG_FUNCTION(this);
 
+    if (GetSicDecoder() == SIC_DECODER_PEELING)
+    {
+        // The graph of the frame is built once and shared by the SIC and MARSALA
+        BuildFrameGraph();
+        do
+        {
+            // Perform CRDSA SIC in its entirety, until no more packets can be decoded
+            PeelFrameGraph(combinedPacketsForFrame);
+        }
+        // Try to decode one more packet using MARSALA
+        while (PerformMarsala(combinedPacketsForFrame));
+        StoreFrameGraph();
+        return;
+    }
+
     do
     {
         // Perform CRDSA SIC in its entirety, until no more packets can be decoded
         SatPhyRxCarrierPerFrame::PerformSicCycles(combinedPacketsForFrame);
     }
     // Try to decode one more packet using MARSALA
-    while (PerformMarsala(combinedPacketsForFrame));
+    while (PerformSlotScanMarsala(combinedPacketsForFrame));
 }
 
 SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s
@@ -106,7 +121,7 @@ SatPhyRxCarrierMarsala::FindReplicaInSlot(
 }
 
 bool
-SatPhyRxCarrierMarsala::PerformMarsala(
+SatPhyRxCarrierMarsala::PerformSlotScanMarsala(
     std::vector<SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s>& combinedPacketsForFrame)
 {
     NS_LOG_FUNCTION(this);
@@ -217,7 +232,10 @@ SatPhyRxCarrierMarsala::PerformMarsala(
              * link SINR is already updated at the SatPhyRxCarrier::EndRxDataTransparent ()
              * method!
              */
-            m_linkSinrTrace(SatUtils::LinearToDb(cSinr), currentPacket->sourceAddress);
+            double cSinrDb = SatUtils::LinearToDb(cSinr);
+            Mac48Address sourceAddress = currentPacket->sourceAddress;
+            FireFrameTrace(
+                [this, cSinrDb, sourceAddress]() { m_linkSinrTrace(cSinrDb, sourceAddress); });
 
             NS_LOG_INFO("MARSALA correlation computation, Replicas: "
                         << replicasCount << " Interferents: "
@@ -230,9 +248,10 @@ SatPhyRxCarrierMarsala::PerformMarsala(
             {
                 correlations *= i;
             }
-            m_marsalaCorrelationRxTrace(correlations,
-                                        currentPacket->sourceAddress,
-                                        currentPacket->phyError);
+            bool phyError = currentPacket->phyError;
+            FireFrameTrace([this, correlations, sourceAddress, phyError]() {
+                m_marsalaCorrelationRxTrace(correlations, sourceAddress, phyError);
+            });
 
             NS_LOG_INFO("Packet error: " << currentPacket->phyError);
 
@@ -256,4 +275,151 @@ SatPhyRxCarrierMarsala::PerformMarsala(
     return false;
 }
 
+bool
+SatPhyRxCarrierMarsala::PerformMarsala(
+    std::vector<SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s>& combinedPacketsForFrame)
+{
+    NS_LOG_FUNCTION(this);
+
+    uint32_t nbSlots = 0;
+    for (uint32_t slotSize : m_frameSlotSize)
+    {
+        if (slotSize > 0)
+        {
+            ++nbSlots;
+        }
+    }
+    NS_LOG_INFO("Number of slots: " << nbSlots);
+
+    // Packets are evaluated in the order of the slots and of their reception, each evaluation
+    // drawing a random number and firing the correlation trace
+    for (uint32_t packetIndex = 0; packetIndex < m_framePackets.size(); ++packetIndex)
+    {
+        if (m_framePacketRemoved[packetIndex])
+        {
+            continue;
+        }
+
+        SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s& currentPacket = m_framePackets[packetIndex];
+        NS_LOG_INFO("Iterating packet in slot: " << currentPacket.ownSlotId);
+
+        // process the packet
+        uint32_t otherReplicasCount = currentPacket.slotIdsForOtherReplicas.size();
+        uint32_t replicasCount = 1 + otherReplicasCount;
+        uint32_t replicasCountSquared = replicasCount * replicasCount;
+        uint32_t packetsInSlotsCount = m_frameSlotSize[m_framePacketSlot[packetIndex]];
+
+        double replicasIfPower = currentPacket.rxParams->GetInterferencePower();
+        double replicasNoisePower = replicasCount * m_rxNoisePowerW;
+        double replicasAciIfPower = replicasCount * m_rxAciIfPowerW;
+        double replicasExtNoisePower = replicasCount * m_rxExtNoisePowerW;
+
+        double replicasIfPowerInSatellite =
+            currentPacket.rxParams->GetInterferencePowerInSatellite();
+        double replicasNoisePowerInSatellite = currentPacket.rxParams->GetRxNoisePowerInSatellite();
+        double replicasAciIfPowerInSatellite = currentPacket.rxParams->GetRxAciIfPowerInSatellite();
+        double replicasExtNoisePowerInSatellite =
+            currentPacket.rxParams->GetRxExtNoisePowerInSatellite();
+
+        // add informations from other replicas
+        for (uint32_t edge = m_frameReplicaBegin[packetIndex];
+             edge < m_frameReplicaBegin[packetIndex + 1];
+             ++edge)
+        {
+            uint32_t replicaIndex = m_frameReplicas[edge];
+            if (replicaIndex == NO_REPLICA || m_framePacketRemoved[replicaIndex])
+            {
+                NS_FATAL_ERROR("Could not find a replica of a packet in the given slot!");
+            }
+
+            const SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s& replica =
+                m_framePackets[replicaIndex];
+            NS_LOG_INFO("Processing replica in slot: " << replica.ownSlotId);
+
+            packetsInSlotsCount += m_frameSlotSize[m_framePacketSlot[replicaIndex]];
+            replicasIfPower += replica.rxParams->GetInterferencePower();
+            replicasIfPowerInSatellite += replica.rxParams->GetInterferencePowerInSatellite();
+            replicasNoisePowerInSatellite += replica.rxParams->GetRxNoisePowerInSatellite();
+            replicasAciIfPowerInSatellite += replica.rxParams->GetRxAciIfPowerInSatellite();
+            replicasExtNoisePowerInSatellite += replica.rxParams->GetRxExtNoisePowerInSatellite();
+        }
+
+        double sinr = CalculateSinr(replicasCountSquared * currentPacket.rxParams->m_rxPower_W,
+                                    replicasIfPower,
+                                    replicasNoisePower,
+                                    replicasAciIfPower,
+                                    replicasExtNoisePower,
+                                    m_additionalInterferenceCallback());
+
+        /// calculate composite SINR if transparent. Otherwise take only current sinr.
+        double cSinr;
+        if (GetLinkRegenerationMode() == SatEnums::TRANSPARENT)
+        {
+            double sinrSatellite = CalculateSinr(
+                replicasCountSquared * currentPacket.rxParams->GetRxPowerInSatellite(),
+                replicasIfPowerInSatellite,
+                replicasNoisePowerInSatellite,
+                replicasAciIfPowerInSatellite,
+                replicasExtNoisePowerInSatellite,
+                currentPacket.rxParams->GetAdditionalInterference());
+            cSinr = CalculateCompositeSinr(sinr, sinrSatellite);
+        }
+        else
+        {
+            cSinr = sinr;
+        }
+
+        const SatSignalParameters::PacketsInBurst_t& packets =
+            currentPacket.rxParams->m_packetsInBurst;
+        SatSignalParameters::PacketsInBurst_t::const_iterator i;
+        for (i = packets.begin(); i != packets.end(); i++)
+        {
+            SatUplinkInfoTag satUplinkInfoTag;
+            (*i)->RemovePacketTag(satUplinkInfoTag);
+            satUplinkInfoTag.SetSinr(sinr, m_additionalInterferenceCallback());
+            (*i)->AddPacketTag(satUplinkInfoTag);
+        }
+
+        /*
+         * Update link specific SINR trace for the RETURN_FEEDER link. The RETURN_USER
+         * link SINR is already updated at the SatPhyRxCarrier::EndRxDataTransparent ()
+         * method!
+         */
+        double cSinrDb = SatUtils::LinearToDb(cSinr);
+        Mac48Address sourceAddress = currentPacket.sourceAddress;
+        FireFrameTrace(
+            [this, cSinrDb, sourceAddress]() { m_linkSinrTrace(cSinrDb, sourceAddress); });
+
+        NS_LOG_INFO("MARSALA correlation computation, Replicas: "
+                    << replicasCount << " Interferents: "
+                    << (packetsInSlotsCount - replicasCount) << " Correlated SINR: " << cSinr);
+
+        currentPacket.phyError = CheckAgainstLinkResults(cSinr, currentPacket.rxParams);
+
+        uint32_t correlations = 1;
+        for (uint32_t i = nbSlots - otherReplicasCount; i < nbSlots; ++i)
+        {
+            correlations *= i;
+        }
+        bool phyError = currentPacket.phyError;
+        FireFrameTrace([this, correlations, sourceAddress, phyError]() {
+            m_marsalaCorrelationRxTrace(correlations, sourceAddress, phyError);
+        });
+
+        NS_LOG_INFO("Packet error: " << currentPacket.phyError);
+
+        if (!currentPacket.phyError)
+        {
+            NS_LOG_INFO("Packet successfully received, removing its interference and "
+                        "processing the replicas");
+
+            DecodeInFrameGraph(packetIndex, combinedPacketsForFrame);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
 } // namespace ns3
@@ -69,11 +69,13 @@ class SatPhyRxCarrierMarsala : public SatPhyRxCarrierPerFrame
 
   private:
     /**
-     * \brief Function for performing MARSALA corelation on remaining packets in the frame
+     * \brief Function for performing MARSALA corelation on remaining packets in the frame,
+     * searching the slots of each packet for its replicas. Used with the SlotScan decoder, it is
+     * the reference of the graph based PerformMarsala.
      * \param combinedPacketsForFrame  container to store packets as they are decoded and removed
      * from the frame \return Whether or not a packet was decoded
      */
-    bool PerformMarsala(
+    bool PerformSlotScanMarsala(
         std::vector<SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s>& combinedPacketsForFrame);
 
     /**
@@ -86,6 +88,16 @@ class SatPhyRxCarrierMarsala : public SatPhyRxCarrierPerFrame
         const std::list<SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s>& slotContent,
         const SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s& packet) const;
 
+    /**
+     * \brief Function for performing MARSALA corelation on remaining packets of the
+     * packet/slot graph of the frame. The replicas of each packet are found through the replica
+     * edges of the graph instead of searching their slots.
+     * \param combinedPacketsForFrame  container to store packets as they are decoded and removed
+     * from the frame \return Whether or not a packet was decoded
+     */
+    bool PerformMarsala(
+        std::vector<SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s>& combinedPacketsForFrame);
+
     /**
      * \brief `MarsalaCorrelationRx` trace source.
      *
@@ -22,13 +22,16 @@
 
 #include "satellite-phy-rx-carrier-per-frame.h"
 
+#include "satellite-frame-decoding-pool.h"
 #include "satellite-uplink-info-tag.h"
 
 #include <ns3/boolean.h>
+#include <ns3/enum.h>
 #include <ns3/log.h>
 #include <ns3/simulator.h>
 
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <ostream>
 #include <utility>
@@ -45,7 +48,9 @@ SatPhyRxCarrierPerFrame::SatPhyRxCarrierPerFrame(uint32_t carrierId,
                                                  Ptr<SatWaveformConf> waveformConf,
                                                  bool randomAccessEnabled)
     : SatPhyRxCarrierPerSlot(carrierId, carrierConf, waveformConf, randomAccessEnabled),
-      m_frameEndSchedulingInitialized(false)
+      m_frameEndSchedulingInitialized(false),
+      m_sicDecoder(SIC_DECODER_SLOT_SCAN),
+      m_deferFrameTraces(false)
 {
     NS_LOG_FUNCTION(this);
     NS_LOG_INFO("Constructor called with arguments " << carrierId << ", " << carrierConf << ", and "
@@ -95,6 +100,15 @@ SatPhyRxCarrierPerFrame::GetTypeId(void)
     static TypeId tid =
         TypeId("ns3::SatPhyRxCarrierPerFrame")
             .SetParent<SatPhyRxCarrierPerSlot>()
+            .AddAttribute("SicDecoder",
+                          "Decoder performing the SIC cycles of a frame, both decode the same "
+                          "packets",
+                          EnumValue(SatPhyRxCarrierPerFrame::SIC_DECODER_SLOT_SCAN),
+                          MakeEnumAccessor(&SatPhyRxCarrierPerFrame::m_sicDecoder),
+                          MakeEnumChecker(SatPhyRxCarrierPerFrame::SIC_DECODER_SLOT_SCAN,
+                                          "SlotScan",
+                                          SatPhyRxCarrierPerFrame::SIC_DECODER_PEELING,
+                                          "Peeling"))
             .AddTraceSource(
                 "CrdsaReplicaRx",
                 "Received a CRDSA packet replica through Random Access",
@@ -125,6 +139,10 @@ SatPhyRxCarrierPerFrame::DoDispose()
         iter->second.clear();
     }
     m_crdsaPacketContainer.clear();
+    m_submittedFrame.clear();
+    m_framePackets.clear();
+    m_frameResults.clear();
+    m_deferredFrameTraces.clear();
 }
 
 void
@@ -177,63 +195,120 @@ SatPhyRxCarrierPerFrame::DoFrameEnd()
 
         NS_LOG_INFO("Packets in container, will process the frame");
 
-        std::vector<SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s> results = ProcessFrame();
-
-        if (!m_crdsaPacketContainer.empty())
+        SatFrameDecodingPool* pool = Singleton<SatFrameDecodingPool>::Get();
+        if (pool->IsEnabled())
         {
-            NS_FATAL_ERROR("All CRDSA packets in the frame were not processed");
+            /// the frame is decoded along with the frames of the other carriers ending now and
+            /// delivered afterwards, the traces fired by the decoding wait for the delivery. The
+            /// shared link results are resolved beforehand on the simulation thread. The packets
+            /// of the frame are set apart, the packets received until the decoding belong to the
+            /// next frame.
+            m_deferFrameTraces = true;
+            ResolveLinkResultsErrorModel();
+            m_submittedFrame.swap(m_crdsaPacketContainer);
+            pool->Submit(this,
+                         SatFrameDecodingPool::frameOrder_t(GetNodeInfo()->GetNodeId(),
+                                                            GetBeamId(),
+                                                            GetCarrierId()));
+            return;
         }
 
-        /// sort the results based on CRDSA packet IDs to make sure the packets are processed in
-        /// correct order
-        std::sort(results.begin(), results.end(), CompareCrdsaPacketId);
+        DecodeFrame();
+    }
 
-        for (crdsaPacketRxParams_s& crdsaPacket : results)
-        {
-            NS_LOG_INFO("Sending a packet to the next layer, slot: "
-                        << crdsaPacket.ownSlotId << ", UT: " << crdsaPacket.sourceAddress
-                        << ", unique CRDSA packet ID: "
-                        << crdsaPacket.rxParams->m_txInfo.crdsaUniquePacketId
-                        << ", destination address: " << crdsaPacket.destAddress
-                        << ", error: " << crdsaPacket.phyError << ", SINR: " << crdsaPacket.cSinr);
+    DeliverFrame();
+}
 
-            for (Ptr<Packet>& packetInBurst : crdsaPacket.rxParams->m_packetsInBurst)
-            {
-                NS_LOG_INFO("Fragment (HL packet) UID: " << packetInBurst->GetUid());
-            }
+void
+SatPhyRxCarrierPerFrame::DecodeFrame()
+{
+    NS_LOG_FUNCTION(this);
+
+    /// a frame submitted to the pool is decoded in place of the packets received since its end,
+    /// no packet is received while the pool decodes
+    bool submitted = m_deferFrameTraces;
+    if (submitted)
+    {
+        m_submittedFrame.swap(m_crdsaPacketContainer);
+    }
+
+    m_frameResults = ProcessFrame();
+
+    if (!m_crdsaPacketContainer.empty())
+    {
+        NS_FATAL_ERROR("All CRDSA packets in the frame were not processed");
+    }
+
+    if (submitted)
+    {
+        m_submittedFrame.swap(m_crdsaPacketContainer);
+    }
 
-            /// uses composite sinr
-            m_linkBudgetTrace(crdsaPacket.rxParams,
-                              GetOwnAddress(),
-                              crdsaPacket.destAddress,
-                              crdsaPacket.ifPower,
-                              crdsaPacket.cSinr);
-            /// CRDSA trace
-            m_crdsaUniquePayloadRxTrace(
-                crdsaPacket.rxParams->m_packetsInBurst.size(), // number of packets
-                crdsaPacket.sourceAddress,                     // sender address
-                crdsaPacket.phyError                           // error flag
-            );
+    /// sort the results based on CRDSA packet IDs to make sure the packets are processed in
+    /// correct order
+    std::sort(m_frameResults.begin(), m_frameResults.end(), CompareCrdsaPacketId);
+}
+
+void
+SatPhyRxCarrierPerFrame::DeliverFrame()
+{
+    NS_LOG_FUNCTION(this);
 
-            // Update composite SINR trace for CRDSA packet after combination
-            m_sinrTrace(SatUtils::LinearToDb(crdsaPacket.cSinr), crdsaPacket.sourceAddress);
+    /// the packets received since the end of a frame decoded by the pool belong to the next frame
+    bool submitted = m_deferFrameTraces;
 
-            /// send packet upwards
-            m_rxCallback(crdsaPacket.rxParams, crdsaPacket.phyError);
+    for (std::function<void()>& trace : m_deferredFrameTraces)
+    {
+        trace();
+    }
+    m_deferredFrameTraces.clear();
+    m_deferFrameTraces = false;
 
-            crdsaPacket.rxParams = NULL;
+    for (crdsaPacketRxParams_s& crdsaPacket : m_frameResults)
+    {
+        NS_LOG_INFO("Sending a packet to the next layer, slot: "
+                    << crdsaPacket.ownSlotId << ", UT: " << crdsaPacket.sourceAddress
+                    << ", unique CRDSA packet ID: "
+                    << crdsaPacket.rxParams->m_txInfo.crdsaUniquePacketId
+                    << ", destination address: " << crdsaPacket.destAddress
+                    << ", error: " << crdsaPacket.phyError << ", SINR: " << crdsaPacket.cSinr);
+
+        for (Ptr<Packet>& packetInBurst : crdsaPacket.rxParams->m_packetsInBurst)
+        {
+            NS_LOG_INFO("Fragment (HL packet) UID: " << packetInBurst->GetUid());
         }
 
-        results.clear();
+        /// uses composite sinr
+        m_linkBudgetTrace(crdsaPacket.rxParams,
+                          GetOwnAddress(),
+                          crdsaPacket.destAddress,
+                          crdsaPacket.ifPower,
+                          crdsaPacket.cSinr);
+        /// CRDSA trace
+        m_crdsaUniquePayloadRxTrace(
+            crdsaPacket.rxParams->m_packetsInBurst.size(), // number of packets
+            crdsaPacket.sourceAddress,                     // sender address
+            crdsaPacket.phyError                           // error flag
+        );
+
+        // Update composite SINR trace for CRDSA packet after combination
+        m_sinrTrace(SatUtils::LinearToDb(crdsaPacket.cSinr), crdsaPacket.sourceAddress);
+
+        /// send packet upwards
+        m_rxCallback(crdsaPacket.rxParams, crdsaPacket.phyError);
+
+        crdsaPacket.rxParams = NULL;
     }
 
+    m_frameResults.clear();
+
     if (IsRandomAccessDynamicLoadControlEnabled())
     {
         MeasureRandomAccessLoad();
     }
     else
     {
-        if (!m_crdsaPacketContainer.empty())
+        if (!submitted && !m_crdsaPacketContainer.empty())
         {
             NS_FATAL_ERROR("CRDSA packets received by carrier which has random access disabled");
         }
@@ -482,6 +557,12 @@ void
 SatPhyRxCarrierPerFrame::PerformSicCycles(
     std::vector<SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s>& combinedPacketsForFrame)
 {
+    if (m_sicDecoder == SIC_DECODER_PEELING)
+    {
+        PerformPeelingSicCycles(combinedPacketsForFrame);
+        return;
+    }
+
     std::map<uint32_t, std::list<SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s>>::iterator iter;
     SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s processedPacket;
     bool nothingToProcess = true;
@@ -594,7 +675,7 @@ SatPhyRxCarrierPerFrame::ProcessReceivedCrdsaPacket(
 
     double sinr = CalculatePacketCompositeSinr(packet);
 
-    SatSignalParameters::PacketsInBurst_t packets = packet.rxParams->m_packetsInBurst;
+    const SatSignalParameters::PacketsInBurst_t& packets = packet.rxParams->m_packetsInBurst;
     SatSignalParameters::PacketsInBurst_t::const_iterator i;
     for (i = packets.begin(); i != packets.end(); i++)
     {
@@ -609,7 +690,9 @@ SatPhyRxCarrierPerFrame::ProcessReceivedCrdsaPacket(
      * link SINR is already updated at the SatPhyRxCarrierUplink::EndRxData ()
      * method!
      */
-    m_linkSinrTrace(SatUtils::LinearToDb(sinr), packet.sourceAddress);
+    double sinrDb = SatUtils::LinearToDb(sinr);
+    Mac48Address sourceAddress = packet.sourceAddress;
+    FireFrameTrace([this, sinrDb, sourceAddress]() { m_linkSinrTrace(sinrDb, sourceAddress); });
 
     if (GetRandomAccessCollisionModel() ==
         SatPhyRxCarrierConf::RA_COLLISION_ALWAYS_DROP_ALL_COLLIDING_PACKETS)
@@ -762,39 +845,276 @@ SatPhyRxCarrierPerFrame::EliminateInterference(
 
         for (iterList = iter->second.begin(); iterList != iter->second.end(); iterList++)
         {
-            /// release packets in this slot for re-processing
-            iterList->packetHasBeenProcessed = false;
+            EliminatePacketInterference(*iterList, processedPacket);
+        }
+    }
+}
+
+void
+SatPhyRxCarrierPerFrame::EliminatePacketInterference(
+    SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s& packet,
+    const SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s& processedPacket)
+{
+    /// release packets in this slot for re-processing
+    packet.packetHasBeenProcessed = false;
+
+    NS_LOG_INFO("BEFORE INTERFERENCE ELIMINATION, RX sat: "
+                << packet.rxParams->GetRxPowerInSatellite()
+                << " IF sat: " << packet.rxParams->GetInterferencePowerInSatellite()
+                << " RX gnd: " << packet.rxParams->m_rxPower_W
+                << " IF gnd: " << packet.rxParams->GetInterferencePower());
+
+    /// Reduce interference power for the colliding packets. Note, that the interference is
+    /// eliminated only from the user link interference power at the satellite! The
+    /// intra-beam interference is not handled in the return feeder link so that the
+    /// intra-beam interference is not taken into account twice!
+    /// TODO A more novel way to eliminate partially overlapping interference should be
+    /// considered! In addition, as the interference values are extremely small, the use of
+    /// long double (instead of double) should be considered to improve the accuracy.
+
+    if (packet.rxParams->GetInterferencePower() < 0)
+    {
+        NS_FATAL_ERROR("Negative interference");
+    }
+
+    GetInterferenceEliminationModel()->EliminateInterferences(packet.rxParams,
+                                                              processedPacket.rxParams,
+                                                              processedPacket.cSinr,
+                                                              m_linkRegenerationMode !=
+                                                                  SatEnums::TRANSPARENT);
+
+    NS_LOG_INFO("AFTER INTERFERENCE ELIMINATION, RX sat: "
+                << packet.rxParams->GetRxPowerInSatellite()
+                << " IF sat: " << packet.rxParams->GetInterferencePowerInSatellite()
+                << " RX gnd: " << packet.rxParams->m_rxPower_W
+                << " IF gnd: " << packet.rxParams->GetInterferencePower());
+}
+
+void
+SatPhyRxCarrierPerFrame::PerformPeelingSicCycles(
+    std::vector<SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s>& combinedPacketsForFrame)
+{
+    NS_LOG_FUNCTION(this);
+
+    BuildFrameGraph();
+    PeelFrameGraph(combinedPacketsForFrame);
+    StoreFrameGraph();
+}
+
+void
+SatPhyRxCarrierPerFrame::PeelFrameGraph(
+    std::vector<SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s>& combinedPacketsForFrame)
+{
+    NS_LOG_FUNCTION(this);
+
+    /// Scanning the slots always processes the first packet, by slot and reception order, which
+    /// has not been processed since the last interference elimination in its slot: the worklist
+    /// is a min-heap of the graph indices of these packets. Packets are indexed in that order, so
+    /// the sorted initial worklist is a valid heap.
+    m_frameWorklist.clear();
+    for (uint32_t packetIndex = 0; packetIndex < m_framePackets.size(); packetIndex++)
+    {
+        if (!m_framePacketRemoved[packetIndex] &&
+            !m_framePackets[packetIndex].packetHasBeenProcessed)
+        {
+            m_frameWorklist.push_back(packetIndex);
+        }
+    }
+
+    NS_LOG_INFO("Packets to process: " << m_frameWorklist.size());
+
+    while (!m_frameWorklist.empty())
+    {
+        std::pop_heap(m_frameWorklist.begin(), m_frameWorklist.end(), std::greater<uint32_t>());
+        uint32_t packetIndex = m_frameWorklist.back();
+        m_frameWorklist.pop_back();
+
+        /// replicas of the decoded packets are removed without leaving the worklist
+        if (m_framePacketRemoved[packetIndex])
+        {
+            continue;
+        }
+
+        crdsaPacketRxParams_s& packet = m_framePackets[packetIndex];
+
+        /// process the received packet
+        uint32_t slotIndex = m_framePacketSlot[packetIndex];
+        packet = ProcessReceivedCrdsaPacket(packet, m_frameSlotSize[slotIndex]);
+
+        NS_LOG_INFO("Packet error: " << packet.phyError);
+
+        if (!packet.phyError)
+        {
+            NS_LOG_INFO("Packet successfully received, processing the replicas");
+            DecodeInFrameGraph(packetIndex, combinedPacketsForFrame);
+        }
+    }
+}
+
+void
+SatPhyRxCarrierPerFrame::DecodeInFrameGraph(
+    uint32_t packetIndex,
+    std::vector<SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s>& combinedPacketsForFrame)
+{
+    NS_LOG_FUNCTION(this << packetIndex);
+
+    SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s processedPacket = m_framePackets[packetIndex];
+    RemoveFromFrameGraph(packetIndex);
+    EliminateInterferenceInFrameGraph(m_framePacketSlot[packetIndex], processedPacket);
+
+    /// find and remove replicas of the received packet
+    for (uint32_t edge = m_frameReplicaBegin[packetIndex];
+         edge < m_frameReplicaBegin[packetIndex + 1];
+         edge++)
+    {
+        uint32_t replicaIndex = m_frameReplicas[edge];
+        if (replicaIndex == NO_REPLICA || m_framePacketRemoved[replicaIndex])
+        {
+            NS_FATAL_ERROR("Replica not found");
+        }
+
+        SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s removedPacket = m_framePackets[replicaIndex];
+        RemoveFromFrameGraph(replicaIndex);
+
+        CalculatePacketCompositeSinr(removedPacket);
+        EliminateInterferenceInFrameGraph(m_framePacketSlot[replicaIndex], removedPacket);
+    }
+
+    /// save the received packet
+    combinedPacketsForFrame.push_back(processedPacket);
+}
+
+void
+SatPhyRxCarrierPerFrame::StoreFrameGraph()
+{
+    NS_LOG_FUNCTION(this);
+
+    /// store the packets left back in the container, empty slots are dropped as
+    /// EliminateInterference does
+    m_crdsaPacketContainer.clear();
+    for (uint32_t packetIndex = 0; packetIndex < m_framePackets.size(); packetIndex++)
+    {
+        if (!m_framePacketRemoved[packetIndex])
+        {
+            const crdsaPacketRxParams_s& packet = m_framePackets[packetIndex];
+            m_crdsaPacketContainer[packet.ownSlotId].push_back(packet);
+        }
+    }
+    m_framePackets.clear();
+}
+
+void
+SatPhyRxCarrierPerFrame::BuildFrameGraph()
+{
+    NS_LOG_FUNCTION(this);
+
+    m_framePackets.clear();
+    m_framePacketSlot.clear();
+    m_frameSlotBegin.clear();
+    m_frameSlotSize.clear();
+    m_frameReplicaBegin.clear();
+    m_frameReplicas.clear();
+    m_frameWorklist.clear();
+
+    std::map<uint32_t, std::list<SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s>>::iterator iter;
+    for (iter = m_crdsaPacketContainer.begin(); iter != m_crdsaPacketContainer.end(); ++iter)
+    {
+        uint32_t slotIndex = m_frameSlotBegin.size();
+        m_frameSlotBegin.push_back(m_framePackets.size());
+        m_frameSlotSize.push_back(iter->second.size());
+
+        for (const crdsaPacketRxParams_s& packet : iter->second)
+        {
+            m_framePackets.push_back(packet);
+            m_framePacketSlot.push_back(slotIndex);
+        }
+    }
+    m_frameSlotBegin.push_back(m_framePackets.size());
+    m_framePacketRemoved.assign(m_framePackets.size(), false);
+
+    /// Group the replicas of a transmission, having the same source and the same set of slots as
+    /// checked by IsReplica
+    typedef std::pair<Mac48Address, std::vector<uint16_t>> replicaKey_t;
+    std::map<replicaKey_t, std::vector<uint32_t>> replicaGroups;
+    std::vector<const std::vector<uint32_t>*> packetGroups(m_framePackets.size());
+
+    for (uint32_t packetIndex = 0; packetIndex < m_framePackets.size(); packetIndex++)
+    {
+        const crdsaPacketRxParams_s& packet = m_framePackets[packetIndex];
+
+        replicaKey_t key(packet.sourceAddress, packet.slotIdsForOtherReplicas);
+        key.second.push_back(packet.ownSlotId);
+        std::sort(key.second.begin(), key.second.end());
+        key.second.erase(std::unique(key.second.begin(), key.second.end()), key.second.end());
 
-            NS_LOG_INFO("BEFORE INTERFERENCE ELIMINATION, RX sat: "
-                        << iterList->rxParams->GetRxPowerInSatellite()
-                        << " IF sat: " << iterList->rxParams->GetInterferencePowerInSatellite()
-                        << " RX gnd: " << iterList->rxParams->m_rxPower_W
-                        << " IF gnd: " << iterList->rxParams->GetInterferencePower());
+        std::vector<uint32_t>& group = replicaGroups[key];
+        group.push_back(packetIndex);
+        packetGroups[packetIndex] = &group;
+    }
 
-            /// Reduce interference power for the colliding packets. Note, that the interference is
-            /// eliminated only from the user link interference power at the satellite! The
-            /// intra-beam interference is not handled in the return feeder link so that the
-            /// intra-beam interference is not taken into account twice!
-            /// TODO A more novel way to eliminate partially overlapping interference should be
-            /// considered! In addition, as the interference values are extremely small, the use of
-            /// long double (instead of double) should be considered to improve the accuracy.
+    /// Link each packet to its replicas
+    for (uint32_t packetIndex = 0; packetIndex < m_framePackets.size(); packetIndex++)
+    {
+        m_frameReplicaBegin.push_back(m_frameReplicas.size());
 
-            if (iterList->rxParams->GetInterferencePower() < 0)
+        for (uint16_t slotId : m_framePackets[packetIndex].slotIdsForOtherReplicas)
+        {
+            uint32_t replicaIndex = NO_REPLICA;
+            for (uint32_t otherIndex : *packetGroups[packetIndex])
             {
-                NS_FATAL_ERROR("Negative interference");
+                if (m_framePackets[otherIndex].ownSlotId == slotId)
+                {
+                    if (replicaIndex != NO_REPLICA)
+                    {
+                        NS_FATAL_ERROR("Found two replica of the same packet in the same slot");
+                    }
+                    replicaIndex = otherIndex;
+                }
             }
+            m_frameReplicas.push_back(replicaIndex);
+        }
+    }
+    m_frameReplicaBegin.push_back(m_frameReplicas.size());
+
+    NS_LOG_INFO("Frame graph built with " << m_framePackets.size() << " packets in "
+                                          << m_frameSlotSize.size() << " slots");
+}
+
+void
+SatPhyRxCarrierPerFrame::RemoveFromFrameGraph(uint32_t packetIndex)
+{
+    m_framePacketRemoved[packetIndex] = true;
+    m_frameSlotSize[m_framePacketSlot[packetIndex]]--;
+}
 
-            GetInterferenceEliminationModel()->EliminateInterferences(iterList->rxParams,
-                                                                      processedPacket.rxParams,
-                                                                      processedPacket.cSinr,
-                                                                      m_linkRegenerationMode !=
-                                                                          SatEnums::TRANSPARENT);
-
-            NS_LOG_INFO("AFTER INTERFERENCE ELIMINATION, RX sat: "
-                        << iterList->rxParams->GetRxPowerInSatellite()
-                        << " IF sat: " << iterList->rxParams->GetInterferencePowerInSatellite()
-                        << " RX gnd: " << iterList->rxParams->m_rxPower_W
-                        << " IF gnd: " << iterList->rxParams->GetInterferencePower());
+void
+SatPhyRxCarrierPerFrame::EliminateInterferenceInFrameGraph(
+    uint32_t slotIndex,
+    const SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s& processedPacket)
+{
+    NS_LOG_FUNCTION(this << slotIndex);
+
+    for (uint32_t packetIndex = m_frameSlotBegin[slotIndex];
+         packetIndex < m_frameSlotBegin[slotIndex + 1];
+         packetIndex++)
+    {
+        if (m_framePacketRemoved[packetIndex])
+        {
+            continue;
+        }
+
+        crdsaPacketRxParams_s& packet = m_framePackets[packetIndex];
+        bool wasProcessed = packet.packetHasBeenProcessed;
+
+        EliminatePacketInterference(packet, processedPacket);
+
+        /// packets not processed yet are already waiting
+        if (wasProcessed)
+        {
+            m_frameWorklist.push_back(packetIndex);
+            std::push_heap(m_frameWorklist.begin(),
+                           m_frameWorklist.end(),
+                           std::greater<uint32_t>());
         }
     }
 }
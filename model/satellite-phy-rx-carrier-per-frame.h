@@ -30,6 +30,10 @@
 
 #include <ns3/singleton.h>
 
+#include <functional>
+#include <limits>
+#include <vector>
+
 namespace ns3
 {
 
@@ -68,6 +72,15 @@ class SatPhyRxCarrierPerFrame : public SatPhyRxCarrierPerSlot
         bool phyError;
     } crdsaPacketRxParams_s;
 
+    /**
+     * \brief Decoder performing the SIC cycles of a frame
+     */
+    enum SicDecoder
+    {
+        SIC_DECODER_SLOT_SCAN,
+        SIC_DECODER_PEELING
+    };
+
     /**
      * Constructor.
      * \param carrierId ID of the carrier
@@ -105,6 +118,18 @@ class SatPhyRxCarrierPerFrame : public SatPhyRxCarrierPerSlot
      */
     void BeginEndScheduling();
 
+    /**
+     * \brief Decode the frame which just ended. Only uses the state of the carrier, the
+     * frame may be decoded by a worker thread of SatFrameDecodingPool.
+     */
+    void DecodeFrame();
+
+    /**
+     * \brief Deliver the decoded frame: fire the traces and pass the packets to the upper
+     * layer, then schedule the next frame end
+     */
+    void DeliverFrame();
+
     /**
      * \brief Method for querying the type of the carrier
      */
@@ -172,6 +197,133 @@ class SatPhyRxCarrierPerFrame : public SatPhyRxCarrierPerSlot
         return m_crdsaPacketContainer;
     }
 
+    /**
+     * \brief Fire a trace of the frame decoding, or keep it until the frame is delivered when
+     * the frame is decoded by SatFrameDecodingPool
+     * \param trace Trace to fire
+     */
+    template <typename T>
+    inline void FireFrameTrace(T trace)
+    {
+        if (m_deferFrameTraces)
+        {
+            m_deferredFrameTraces.push_back(trace);
+        }
+        else
+        {
+            trace();
+        }
+    }
+
+    /**
+     * \return Decoder performing the SIC cycles
+     */
+    inline SicDecoder GetSicDecoder() const
+    {
+        return m_sicDecoder;
+    }
+
+    /**
+     * \brief Perform the SIC cycles by peeling the packet/slot graph of the frame. The packets
+     * are processed in the same order as PerformSicCycles scanning the slots.
+     * \param combinedPacketsForFrame  container to store packets
+     * as they are decoded and removed from the frame
+     */
+    void PerformPeelingSicCycles(
+        std::vector<SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s>& combinedPacketsForFrame);
+
+    /**
+     * \brief Build the packet/slot graph from the CRDSA packet container
+     */
+    void BuildFrameGraph();
+
+    /**
+     * \brief Perform the SIC cycles on the packet/slot graph, processing the packets left which
+     * have not been processed since the last interference elimination in their slot
+     * \param combinedPacketsForFrame  container to store packets
+     * as they are decoded and removed from the frame
+     */
+    void PeelFrameGraph(
+        std::vector<SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s>& combinedPacketsForFrame);
+
+    /**
+     * \brief Remove a correctly received packet and its replicas from the packet/slot graph,
+     * eliminating their interference in their slots
+     * \param packetIndex Index of the packet in the graph
+     * \param combinedPacketsForFrame  container to store the received packet
+     */
+    void DecodeInFrameGraph(
+        uint32_t packetIndex,
+        std::vector<SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s>& combinedPacketsForFrame);
+
+    /**
+     * \brief Store the packets left in the packet/slot graph back in the CRDSA packet container
+     */
+    void StoreFrameGraph();
+
+    /**
+     * \brief Remove a packet from the packet/slot graph
+     * \param packetIndex Index of the packet in the graph
+     */
+    void RemoveFromFrameGraph(uint32_t packetIndex);
+
+    /**
+     * \brief Eliminate the interference of a correctly received packet from the packets left in
+     * a slot of the graph, queueing them for re-processing
+     * \param slotIndex Index of the slot in the graph
+     * \param processedPacket Correctly received processed packet
+     */
+    void EliminateInterferenceInFrameGraph(
+        uint32_t slotIndex,
+        const SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s& processedPacket);
+
+    /**
+     * \brief Packets of the graph, by slot and in reception order within a slot
+     */
+    std::vector<SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s> m_framePackets;
+
+    /**
+     * \brief Whether each packet of the graph has been removed from the frame
+     */
+    std::vector<bool> m_framePacketRemoved;
+
+    /**
+     * \brief Index of the slot of each packet of the graph
+     */
+    std::vector<uint32_t> m_framePacketSlot;
+
+    /**
+     * \brief Index of the first packet of each slot of the graph, followed by the number of
+     * packets
+     */
+    std::vector<uint32_t> m_frameSlotBegin;
+
+    /**
+     * \brief Number of packets left in each slot of the graph
+     */
+    std::vector<uint32_t> m_frameSlotSize;
+
+    /**
+     * \brief Index in m_frameReplicas of the replicas of each packet of the graph, followed by
+     * the number of replica edges
+     */
+    std::vector<uint32_t> m_frameReplicaBegin;
+
+    /**
+     * \brief Replicas of the packets of the graph, in the order of their slotIdsForOtherReplicas
+     */
+    std::vector<uint32_t> m_frameReplicas;
+
+    /**
+     * \brief Min-heap of the packets of the graph waiting to be processed
+     */
+    std::vector<uint32_t> m_frameWorklist;
+
+    /**
+     * \brief Replica edge to a packet which is not in the frame
+     */
+    static constexpr uint32_t NO_REPLICA = std::numeric_limits<uint32_t>::max();
+
   private:
     /**
      * \brief Function for storing the received CRDSA packets
@@ -248,6 +400,16 @@ class SatPhyRxCarrierPerFrame : public SatPhyRxCarrierPerSlot
         SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s packet,
         uint32_t numOfPacketsForThisSlot);
 
+    /**
+     * \brief Eliminate the interference of a correctly received packet from a packet of the
+     * same slot, and release the packet for re-processing
+     * \param packet Packet in the slot
+     * \param processedPacket Correctly received processed packet
+     */
+    void EliminatePacketInterference(
+        SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s& packet,
+        const SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s& processedPacket);
+
     /**
      * \brief CRDSA packet container
      */
@@ -258,6 +420,32 @@ class SatPhyRxCarrierPerFrame : public SatPhyRxCarrierPerSlot
      * \brief Has the frame end scheduling been initialized
      */
     bool m_frameEndSchedulingInitialized;
+
+    /**
+     * \brief Decoder performing the SIC cycles
+     */
+    SicDecoder m_sicDecoder;
+
+    /**
+     * \brief CRDSA packets of the frame submitted to SatFrameDecodingPool, set apart from the
+     * packets received until the frame is decoded
+     */
+    std::map<uint32_t, std::list<SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s>> m_submittedFrame;
+
+    /**
+     * \brief Decoded packets of the frame, waiting for their delivery
+     */
+    std::vector<SatPhyRxCarrierPerFrame::crdsaPacketRxParams_s> m_frameResults;
+
+    /**
+     * \brief Whether the traces of the frame decoding wait for the delivery of the frame
+     */
+    bool m_deferFrameTraces;
+
+    /**
+     * \brief Traces of the frame decoding waiting for the delivery of the frame
+     */
+    std::vector<std::function<void()>> m_deferredFrameTraces;
 };
 
 //////////////////////////////////////////////////////////
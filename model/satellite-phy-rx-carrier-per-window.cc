@@ -57,7 +57,11 @@ SatPhyRxCarrierPerWindow::SatPhyRxCarrierPerWindow(uint32_t carrierId,
       m_spreadingFactor(0),
       m_windowEndSchedulingInitialized(false),
       m_detectionThreshold(0.0),
-      m_sicEnabled(true)
+      m_sicEnabled(true),
+      m_windowLastPacket(0),
+      m_windowEndedPackets(0),
+      m_payloadBytesEnded(0),
+      m_maxPacketDuration(Seconds(0))
 {
     NS_LOG_FUNCTION(this);
     NS_LOG_INFO("Constructor called with arguments " << carrierId << ", " << carrierConf << ", and "
@@ -194,6 +198,8 @@ SatPhyRxCarrierPerWindow::ReceiveSlot(SatPhyRxCarrier::rxParams_s packetRxParams
     params.isInsideWindow = false;
     params.meanSinr = -1.0;
     params.preambleMeanSinr = -1.0;
+    params.payloadBytes =
+        GetWaveformConf()->GetWaveform(params.rxParams->m_txInfo.waveformId)->GetPayloadInBytes();
 
     // Calculate SINR, gamma and ifPowerPerFragment
     CalculatePacketInterferenceVectors(params);
@@ -238,16 +244,19 @@ SatPhyRxCarrierPerWindow::EliminatePreviousInterferences(
                 << packet.rxParams->m_txInfo.crdsaUniquePacketId << " from "
                 << packet.sourceAddress);
 
+    // Packets are stored when their reception ends, so the container is sorted by end time and
+    // the packets interfering with this packet are at its back
+    uint32_t first = m_essaPacketContainer.GetSize();
+    while (first > 0 && (m_essaPacketContainer[first - 1].arrivalTime +
+                         m_essaPacketContainer[first - 1].duration) > packet.arrivalTime)
+    {
+        first--;
+    }
+
     // Get which packets that have been decoded interfere with this packet
-    packetList_t::iterator packet_it;
-    for (packet_it = m_essaPacketContainer.begin(); packet_it != m_essaPacketContainer.end();
-         packet_it++)
+    for (uint32_t position = first; position < m_essaPacketContainer.GetSize(); position++)
     {
-        /// Check first if packet interferes with received packet
-        if ((packet_it->arrivalTime + packet_it->duration) <= packet.arrivalTime)
-        {
-            continue;
-        }
+        essaPacketRxParams_s* packet_it = &m_essaPacketContainer[position];
         /// Check if packet has been decoded
         if (!(packet_it->hasBeenDecoded))
         {
@@ -344,47 +353,52 @@ SatPhyRxCarrierPerWindow::CalculatePacketInterferenceVectors(
     }
 
     /// Calculate the gamma vector
-    packet.gamma.clear();
+    packet.gamma.Clear();
 
-    std::vector<std::pair<double, double>> interferencePowerPerFragment =
+    const SatFragmentVector& interferencePowerPerFragment =
         packet.rxParams->GetInterferencePowerPerFragment();
-    std::vector<std::pair<double, double>>::iterator interferencePower =
-        interferencePowerPerFragment.begin();
-    double normalizedTime = interferencePower->first, normalizedTimeInSatellite = 0.0;
+    std::size_t interferencePower = 0;
+    double normalizedTime = interferencePowerPerFragment.GetDuration(interferencePower),
+           normalizedTimeInSatellite = 0.0;
     /// Consider both the interference per fragment in the satellite, and the
     /// interference per fragment in the feeder. Since interference at the
     /// feeder does not consider intrabeam interference, the fragments
     /// will always be a subset of fragments in satellite (TODO: CHECK THIS).
-    /// TODO: optimize. Find a way to do this without creating copy.
     if (GetLinkRegenerationMode() == SatEnums::TRANSPARENT)
     {
-        std::vector<std::pair<double, double>> interferencePowerPerFragmentInSatellite =
+        const SatFragmentVector& interferencePowerPerFragmentInSatellite =
             packet.rxParams->GetInterferencePowerInSatellitePerFragment();
-        for (std::vector<std::pair<double, double>>::iterator interferencePowerInSatellite =
-                 interferencePowerPerFragmentInSatellite.begin();
-             interferencePowerInSatellite != interferencePowerPerFragmentInSatellite.end();
+        packet.gamma.Reserve(interferencePowerPerFragmentInSatellite.GetSize());
+        for (std::size_t interferencePowerInSatellite = 0;
+             interferencePowerInSatellite < interferencePowerPerFragmentInSatellite.GetSize();
              interferencePowerInSatellite++)
         {
-            normalizedTimeInSatellite += interferencePowerInSatellite->first;
+            normalizedTimeInSatellite +=
+                interferencePowerPerFragmentInSatellite.GetDuration(interferencePowerInSatellite);
             /// TODO: verify. Since Interference in feeder is a subset,
             /// fragments will never be smaller than those in satellite.
             if (normalizedTimeInSatellite > normalizedTime)
             {
                 interferencePower++;
-                normalizedTime += interferencePower->first;
+                normalizedTime += interferencePowerPerFragment.GetDuration(interferencePower);
             }
 
             /// For each iteration:
             /// gamma[k] = ( SNR^-1 + (C/Interference[k])^-1 )^-1
 
             /// Calculate composite C/I = (C_u/I_u^-1 + C_d/I_d^-1)^-1
-            double cI = (packet.rxParams->GetRxPowerInSatellite() * packet.rxParams->m_rxPower_W) /
-                        (interferencePowerInSatellite->second * packet.rxParams->m_rxPower_W +
-                         interferencePower->second * packet.rxParams->GetRxPowerInSatellite());
+            double cI =
+                (packet.rxParams->GetRxPowerInSatellite() * packet.rxParams->m_rxPower_W) /
+                (interferencePowerPerFragmentInSatellite.GetValue(interferencePowerInSatellite) *
+                     packet.rxParams->m_rxPower_W +
+                 interferencePowerPerFragment.GetValue(interferencePower) *
+                     packet.rxParams->GetRxPowerInSatellite());
 
             /// Calculate gamma[k]
             double gamma = 1 / (1 / cI + 1 / cSnr);
-            packet.gamma.emplace_back(interferencePowerInSatellite->first, gamma);
+            packet.gamma.Add(
+                interferencePowerPerFragmentInSatellite.GetDuration(interferencePowerInSatellite),
+                gamma);
         }
     }
     else
@@ -394,37 +408,37 @@ SatPhyRxCarrierPerWindow::CalculatePacketInterferenceVectors(
 
         /// Calculate composite C/I = (C_u/I_u^-1 + C_d/I_d^-1)^-1
         double cI = (packet.rxParams->m_rxPower_W) /
-                    (packet.rxParams->m_rxPower_W + interferencePower->second);
+                    (packet.rxParams->m_rxPower_W +
+                     interferencePowerPerFragment.GetValue(interferencePower));
 
         /// Calculate gamma[k]
         double gamma = 1 / (1 / cI + 1 / cSnr);
-        packet.gamma.emplace_back(1, gamma);
+        packet.gamma.Add(1, gamma);
     }
 
     /// Calculate the gamma vector for the preamble
-    std::vector<std::pair<double, double>> gammaPreamble;
+    m_gammaPreamble.Clear();
     Ptr<SatWaveform> wf = GetWaveformConf()->GetWaveform(packet.rxParams->m_txInfo.waveformId);
     normalizedTime = 0.0;
     double normalizedPreambleTime =
         wf->GetPreambleLengthInSymbols() /
         wf->GetBurstLengthInSymbols(); // This asumes that preamble and burst have the same symbol
                                        // rate
-    for (std::vector<std::pair<double, double>>::iterator it = packet.gamma.begin();
-         it != packet.gamma.end();
-         it++)
+    for (std::size_t i = 0; i < packet.gamma.GetSize(); i++)
     {
-        if (normalizedTime + it->first > normalizedPreambleTime)
+        if (normalizedTime + packet.gamma.GetDuration(i) > normalizedPreambleTime)
         {
-            gammaPreamble.emplace_back(1.0 - normalizedTime, it->second);
+            m_gammaPreamble.Add(1.0 - normalizedTime, packet.gamma.GetValue(i));
             break;
         }
-        gammaPreamble.emplace_back(it->first / normalizedPreambleTime, it->second);
-        normalizedTime += it->first;
+        m_gammaPreamble.Add(packet.gamma.GetDuration(i) / normalizedPreambleTime,
+                            packet.gamma.GetValue(i));
+        normalizedTime += packet.gamma.GetDuration(i);
     }
 
     /// Calculate the mean SNIR
-    packet.meanSinr = SatUtils::ScalarProduct(packet.gamma);
-    packet.preambleMeanSinr = SatUtils::ScalarProduct(gammaPreamble);
+    packet.meanSinr = packet.gamma.GetWeightedSum();
+    packet.preambleMeanSinr = m_gammaPreamble.GetWeightedSum();
 
     packet.hasBeenUpdated = true;
 }
@@ -456,8 +470,10 @@ SatPhyRxCarrierPerWindow::ProcessWindow(Time startTime, Time endTime)
     CleanOldPackets(startTime);
 
     /// Get packets in window
-    std::pair<packetList_t::iterator, packetList_t::iterator> windowBounds =
-        GetWindowBounds(startTime, endTime);
+    windowBounds_t windowBounds = GetWindowBounds(startTime, endTime);
+
+    /// Queue packets to decode
+    BuildDecodingHeap(startTime, endTime, windowBounds);
 
     uint32_t i = 0;
     while (i < m_windowSicIterations)
@@ -465,12 +481,13 @@ SatPhyRxCarrierPerWindow::ProcessWindow(Time startTime, Time endTime)
         while (true)
         {
             /// Select packet to decode (block 2)
-            packetList_t::iterator packet_it = GetHighestSnirPacket(windowBounds);
-            if (packet_it == windowBounds.second)
+            if (m_decodingHeap.empty())
             {
                 NS_LOG_INFO("SatPhyRxCarrierPerWindow::DoWindowEnd - No more packets to decode");
                 break;
             }
+            uint32_t position = PopHighestSnirPacket();
+            essaPacketRxParams_s* packet_it = &m_essaPacketContainer[position];
             packet_it->hasBeenTreatedInWindow = true;
 
             NS_LOG_INFO("SatPhyRxCarrierPerWindow::DoWindowEnd - Process packet "
@@ -491,7 +508,7 @@ SatPhyRxCarrierPerWindow::ProcessWindow(Time startTime, Time endTime)
             {
                 packet_it->hasBeenDecoded = true;
                 /// SIC (block 4)
-                DoSic(packet_it, windowBounds);
+                DoSic(position);
                 /// REMOVE
                 NS_LOG_WARN("received " << packet_it->sourceAddress << " "
                                         << packet_it->rxParams->m_txInfo.crdsaUniquePacketId << " "
@@ -510,9 +527,9 @@ SatPhyRxCarrierPerWindow::ProcessWindow(Time startTime, Time endTime)
         i++;
     }
     /// send treated packets upward
-    for (packetList_t::iterator packet_it = windowBounds.first; packet_it != windowBounds.second;
-         packet_it++)
+    for (uint32_t position = windowBounds.first; position < windowBounds.second; position++)
     {
+        essaPacketRxParams_s* packet_it = &m_essaPacketContainer[position];
         /// consider only packets that have been treated this window
         if (!packet_it->isInsideWindow || !packet_it->hasBeenTreatedInWindow)
         {
@@ -531,37 +548,53 @@ SatPhyRxCarrierPerWindow::ProcessWindow(Time startTime, Time endTime)
 }
 
 void
-SatPhyRxCarrierPerWindow::DoSic(
-    packetList_t::iterator processedPacket,
-    std::pair<packetList_t::iterator, packetList_t::iterator> windowBounds)
+SatPhyRxCarrierPerWindow::DoSic(uint32_t processedPosition)
 {
-    NS_LOG_FUNCTION(this);
+    NS_LOG_FUNCTION(this << processedPosition);
 
     if (!m_sicEnabled)
     {
         return;
     }
 
+    essaPacketRxParams_s* processedPacket = &m_essaPacketContainer[processedPosition];
+    Time processedStart = processedPacket->arrivalTime;
+    Time processedEnd = processedPacket->arrivalTime + processedPacket->duration;
+
     NS_LOG_INFO("SatPhyRxCarrierPerWindow::DoSic - eliminate interference from packet "
                 << processedPacket->rxParams->m_txInfo.crdsaUniquePacketId << " from "
                 << processedPacket->sourceAddress);
 
+    /// Window packets are sorted by end time, binary search past the previous packets
+    uint32_t first = 0;
+    uint32_t count = m_windowLastPacket;
+    while (count > 0)
+    {
+        uint32_t half = count / 2;
+        const essaPacketRxParams_s& packet = m_essaPacketContainer[first + half];
+        if (packet.arrivalTime + packet.duration <= processedStart)
+        {
+            first += half + 1;
+            count -= half + 1;
+        }
+        else
+        {
+            count = half;
+        }
+    }
+
     /// Update SIC on interfering packets
-    for (packetList_t::iterator packet_it = windowBounds.first; packet_it != windowBounds.second;
-         packet_it++)
+    for (uint32_t position = first; position < m_windowLastPacket; position++)
     {
+        essaPacketRxParams_s* packet_it = &m_essaPacketContainer[position];
+
         /// Stop iterating for packets arriving after the processed packet
-        if (packet_it->arrivalTime >= processedPacket->arrivalTime + processedPacket->duration)
+        if (packet_it->arrivalTime >= processedEnd)
         {
             break;
         }
-        /// Except previous packets
-        if (packet_it->arrivalTime + packet_it->duration <= processedPacket->arrivalTime)
-        {
-            continue;
-        }
         /// Except already processed packets, and the packet being currently processed
-        if (packet_it == processedPacket || packet_it->hasBeenDecoded)
+        if (position == processedPosition || packet_it->hasBeenDecoded)
         {
             continue;
         }
@@ -581,6 +614,12 @@ SatPhyRxCarrierPerWindow::DoSic(
             normalizedTimes.second);
 
         CalculatePacketInterferenceVectors(*packet_it);
+
+        /// Queue the packet again with its new SNIR
+        if (packet_it->isInsideWindow)
+        {
+            UpdateDecodingHeap(position);
+        }
     }
 }
 
@@ -618,10 +657,11 @@ SatPhyRxCarrierPerWindow::GetNormalizedPacketInterferenceTime(
     double normalizedTime = 0.0;
     double exactStartTime = (startTimeA == 0.0) ? 0.0 : -1.0;
     double exactEndTime = -1.0;
-    auto ifPowerPerFragment = packet.rxParams->GetInterferencePowerInSatellitePerFragment();
-    for (std::pair<double, double>& ifPower : ifPowerPerFragment)
+    const SatFragmentVector& ifPowerPerFragment =
+        packet.rxParams->GetInterferencePowerInSatellitePerFragment();
+    for (std::size_t i = 0; i < ifPowerPerFragment.GetSize(); i++)
     {
-        normalizedTime += ifPower.first;
+        normalizedTime += ifPowerPerFragment.GetDuration(i);
         if ((exactStartTime < 0) && (normalizedTime == startTimeA || normalizedTime == startTimeB))
         {
             exactStartTime = normalizedTime;
@@ -658,19 +698,7 @@ SatPhyRxCarrierPerWindow::GetEffectiveSnir(
         mutualInformationTable =
             (GetLinkResults()->GetObject<SatLinkResultsLora>())->GetMutualInformationTable();
     }
-    double beta = mutualInformationTable->GetBeta();
-
-    double meanMutualInformation = 0.0;
-    for (std::vector<std::pair<double, double>>::const_iterator it = packet.gamma.begin();
-         it != packet.gamma.end();
-         it++)
-    {
-        meanMutualInformation += it->first * mutualInformationTable->GetNormalizedSymbolInformation(
-                                                 SatUtils::LinearToDb(it->second / beta));
-    }
-
-    double effectiveSnir =
-        beta * SatUtils::DbToLinear(mutualInformationTable->GetSnirDb(meanMutualInformation));
+    double effectiveSnir = mutualInformationTable->GetEffectiveSnir(packet.gamma);
 
     NS_LOG_INFO("SatPhyRxCarrierPerWindow::GetEffectiveSnir - Packet "
                 << packet.rxParams->m_txInfo.crdsaUniquePacketId << " from " << packet.sourceAddress
@@ -685,113 +713,249 @@ SatPhyRxCarrierPerWindow::CleanOldPackets(const Time windowStartTime)
     NS_LOG_FUNCTION(this);
     NS_LOG_INFO("SatPhyRxCarrierPerWindow::CleanOldPackets");
 
-    packetList_t::iterator it = m_essaPacketContainer.begin();
-    while (it != m_essaPacketContainer.end())
+    while (!m_essaPacketContainer.IsEmpty())
     {
-        /// Check first if packet is not entirely in window (not an old packet)
-        Time offset = it->arrivalTime - windowStartTime;
+        essaPacketRxParams_s& packet = m_essaPacketContainer.Front();
+
+        /// Packets are sorted by end time, stop at the first packet not previous to window
+        Time offset = packet.arrivalTime + packet.duration - windowStartTime;
         if (offset.IsStrictlyPositive())
         {
             break;
         }
-        /// Check if packet is previous to window
-        offset = it->arrivalTime + it->duration - windowStartTime;
-        if (!offset.IsStrictlyPositive())
+
+        // Only trace packets that arrived after first Window
+        if (packet.arrivalTime >= m_firstWindow)
         {
-            // Only trace packets that arrived after first Window
-            if (it->arrivalTime >= m_firstWindow)
+            if (packet.hasBeenDecoded)
             {
-                if (!(it->hasBeenDecoded))
-                {
-                }
-                else
-                {
-                    m_daRxTrace(1,                 // number of packets
-                                it->sourceAddress, // sender address
-                                it->failedSic      // error flag
-                    );
-                }
-                // Trace if the packet has been decoded or not
-                m_essaRxCollisionTrace(1,                      // number of packets
-                                       it->sourceAddress,      // sender address
-                                       !(it->hasBeenDecoded)); // error flag
+                m_daRxTrace(1,                    // number of packets
+                            packet.sourceAddress, // sender address
+                            packet.failedSic      // error flag
+                );
             }
-            // Delete element from list
-            NS_LOG_INFO("SatPhyRxCarrierPerWindow::CleanOldPackets - Remove packet "
-                        << it->rxParams->m_txInfo.crdsaUniquePacketId << " from "
-                        << it->sourceAddress);
-            it->rxParams = NULL;
-            m_essaPacketContainer.erase(it++);
+            // Trace if the packet has been decoded or not
+            m_essaRxCollisionTrace(1,                         // number of packets
+                                   packet.sourceAddress,      // sender address
+                                   !(packet.hasBeenDecoded)); // error flag
         }
-        else
+
+        // Keep the window cursors on the same packets
+        if (m_windowEndedPackets > 0)
+        {
+            m_windowEndedPackets--;
+            m_payloadBytesEnded -= packet.payloadBytes;
+        }
+        if (m_windowLastPacket > 0)
         {
-            ++it;
+            m_windowLastPacket--;
         }
+
+        // Delete element from container
+        NS_LOG_INFO("SatPhyRxCarrierPerWindow::CleanOldPackets - Remove packet "
+                    << packet.rxParams->m_txInfo.crdsaUniquePacketId << " from "
+                    << packet.sourceAddress);
+        m_essaPacketContainer.PopFront();
     }
 }
 
-std::pair<SatPhyRxCarrierPerWindow::packetList_t::iterator,
-          SatPhyRxCarrierPerWindow::packetList_t::iterator>
+SatPhyRxCarrierPerWindow::windowBounds_t
 SatPhyRxCarrierPerWindow::GetWindowBounds(Time startTime, Time endTime)
 {
     NS_LOG_FUNCTION(this);
     NS_LOG_INFO("SatPhyRxCarrierPerWindow::GetWindowBounds");
 
-    packetList_t::iterator last;
-    m_payloadBytesInWindow = 0;
+    /// Windows end later and later, and packets are appended at the back of the container: the
+    /// cursors only move forward
+    while (m_windowEndedPackets < m_essaPacketContainer.GetSize())
+    {
+        const essaPacketRxParams_s& packet = m_essaPacketContainer[m_windowEndedPackets];
+        if (packet.arrivalTime + packet.duration > endTime)
+        {
+            break;
+        }
+        m_payloadBytesEnded += packet.payloadBytes;
+        m_windowEndedPackets++;
+    }
+
+    /// Last packet is the first packet arriving after the window end
+    while (m_windowLastPacket < m_essaPacketContainer.GetSize() &&
+           m_essaPacketContainer[m_windowLastPacket].arrivalTime <= endTime)
+    {
+        m_windowLastPacket++;
+    }
 
-    for (last = m_essaPacketContainer.begin(); last != m_essaPacketContainer.end(); last++)
+    /// A packet is inside the window if it ends before the window end and does not start before
+    /// the window start. After CleanOldPackets, all packets end after the window start, so the
+    /// ones starting before it end within the longest packet duration from the window start.
+    m_payloadBytesInWindow = m_payloadBytesEnded;
+    for (uint32_t position = 0; position < m_windowEndedPackets; position++)
     {
-        /// By default, we consider packet is not inside window
-        last->isInsideWindow = false;
-        /// Check first if packet is not after window
-        if (last->arrivalTime > endTime)
+        const essaPacketRxParams_s& packet = m_essaPacketContainer[position];
+        if (packet.arrivalTime + packet.duration >= startTime + m_maxPacketDuration)
         {
             break;
         }
+        if (packet.arrivalTime < startTime)
+        {
+            m_payloadBytesInWindow -= packet.payloadBytes;
+        }
+    }
+
+    /// First packet will always be the first of the container, since previous packets were
+    /// deleted in CleanOldPackets
+    return std::make_pair(0, m_windowLastPacket);
+}
+
+void
+SatPhyRxCarrierPerWindow::BuildDecodingHeap(Time startTime,
+                                            Time endTime,
+                                            windowBounds_t windowBounds)
+{
+    NS_LOG_FUNCTION(this << startTime << endTime);
+
+    m_decodingHeap.clear();
+    m_decodingHeapIndex.clear();
+
+    for (uint32_t position = windowBounds.first; position < windowBounds.second; position++)
+    {
+        essaPacketRxParams_s* it = &m_essaPacketContainer[position];
+
         /// Check if whole packet is inside window
-        if ((last->arrivalTime >= startTime) && (last->arrivalTime + last->duration <= endTime))
+        it->isInsideWindow = (it->arrivalTime >= startTime) &&
+                             (it->arrivalTime + it->duration <= endTime);
+        if (it->isInsideWindow)
         {
-            last->isInsideWindow = true;
-            last->hasBeenTreatedInWindow = false;
-            /// update number of bytes in the window
-            m_payloadBytesInWindow += GetWaveformConf()
-                                          ->GetWaveform(last->rxParams->m_txInfo.waveformId)
-                                          ->GetPayloadInBytes();
+            it->hasBeenTreatedInWindow = false;
+
+            NS_LOG_INFO("SatPhyRxCarrierPerWindow::BuildDecodingHeap - Packet "
+                        << it->rxParams->m_txInfo.crdsaUniquePacketId << " from "
+                        << it->sourceAddress << " is inside the window");
         }
 
-        NS_LOG_INFO("SatPhyRxCarrierPerWindow::GetWindowBounds - Packet "
-                    << last->rxParams->m_txInfo.crdsaUniquePacketId << " from "
-                    << last->sourceAddress << " is inside the window");
+        if (IsDecodingCandidate(*it))
+        {
+            m_decodingHeapIndex.push_back(m_decodingHeap.size());
+            m_decodingHeap.push_back(position);
+        }
+        else
+        {
+            m_decodingHeapIndex.push_back(NOT_QUEUED);
+        }
     }
 
-    /// First packet will always be the first of the list, since previous packets were deleted in
-    /// CleanOldPackets
-    return std::make_pair(m_essaPacketContainer.begin(), last);
+    /// Heapify bottom-up
+    for (uint32_t heapIndex = m_decodingHeap.size() / 2; heapIndex > 0; heapIndex--)
+    {
+        SiftDecodingHeapDown(heapIndex - 1);
+    }
 }
 
-SatPhyRxCarrierPerWindow::packetList_t::iterator
-SatPhyRxCarrierPerWindow::GetHighestSnirPacket(
-    const std::pair<SatPhyRxCarrierPerWindow::packetList_t::iterator,
-                    SatPhyRxCarrierPerWindow::packetList_t::iterator> windowBounds)
+bool
+SatPhyRxCarrierPerWindow::IsDecodingCandidate(
+    const SatPhyRxCarrierPerWindow::essaPacketRxParams_s& packet) const
 {
-    NS_LOG_FUNCTION(this);
-    NS_LOG_INFO("SatPhyRxCarrierPerWindow::GetHighestSnirPacket");
+    return !packet.hasBeenDecoded && packet.hasBeenUpdated && packet.isInsideWindow;
+}
+
+bool
+SatPhyRxCarrierPerWindow::HasDecodingPriority(uint32_t position, uint32_t otherPosition) const
+{
+    double sinr = m_essaPacketContainer[position].meanSinr;
+    double otherSinr = m_essaPacketContainer[otherPosition].meanSinr;
+
+    /// Same selection as a scan of the window keeping the first packet with the highest SNIR
+    return sinr > otherSinr || (sinr == otherSinr && position < otherPosition);
+}
 
-    SatPhyRxCarrierPerWindow::packetList_t::iterator it, max = windowBounds.second;
-    for (it = windowBounds.first; it != windowBounds.second; it++)
+void
+SatPhyRxCarrierPerWindow::SiftDecodingHeapUp(uint32_t heapIndex)
+{
+    uint32_t position = m_decodingHeap[heapIndex];
+
+    while (heapIndex > 0)
     {
-        if (it->hasBeenDecoded || !(it->hasBeenUpdated) || !(it->isInsideWindow))
+        uint32_t parent = (heapIndex - 1) / 2;
+        if (!HasDecodingPriority(position, m_decodingHeap[parent]))
         {
-            continue;
+            break;
+        }
+        m_decodingHeap[heapIndex] = m_decodingHeap[parent];
+        m_decodingHeapIndex[m_decodingHeap[heapIndex]] = heapIndex;
+        heapIndex = parent;
+    }
+
+    m_decodingHeap[heapIndex] = position;
+    m_decodingHeapIndex[position] = heapIndex;
+}
+
+void
+SatPhyRxCarrierPerWindow::SiftDecodingHeapDown(uint32_t heapIndex)
+{
+    uint32_t position = m_decodingHeap[heapIndex];
+    uint32_t size = m_decodingHeap.size();
+
+    while (2 * heapIndex + 1 < size)
+    {
+        uint32_t child = 2 * heapIndex + 1;
+        if (child + 1 < size &&
+            HasDecodingPriority(m_decodingHeap[child + 1], m_decodingHeap[child]))
+        {
+            child++;
         }
-        /// Check if bigger SINR
-        if ((max == windowBounds.second) || (it->meanSinr > max->meanSinr))
+        if (!HasDecodingPriority(m_decodingHeap[child], position))
         {
-            max = it;
+            break;
         }
+        m_decodingHeap[heapIndex] = m_decodingHeap[child];
+        m_decodingHeapIndex[m_decodingHeap[heapIndex]] = heapIndex;
+        heapIndex = child;
+    }
+
+    m_decodingHeap[heapIndex] = position;
+    m_decodingHeapIndex[position] = heapIndex;
+}
+
+void
+SatPhyRxCarrierPerWindow::UpdateDecodingHeap(uint32_t position)
+{
+    NS_LOG_FUNCTION(this << position);
+
+    if (!IsDecodingCandidate(m_essaPacketContainer[position]))
+    {
+        return;
     }
-    return max;
+
+    uint32_t heapIndex = m_decodingHeapIndex[position];
+    if (heapIndex == NOT_QUEUED)
+    {
+        heapIndex = m_decodingHeap.size();
+        m_decodingHeap.push_back(position);
+    }
+
+    /// The SNIR may have moved either way with residual interferences
+    SiftDecodingHeapUp(heapIndex);
+    SiftDecodingHeapDown(m_decodingHeapIndex[position]);
+}
+
+uint32_t
+SatPhyRxCarrierPerWindow::PopHighestSnirPacket()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(!m_decodingHeap.empty());
+
+    uint32_t position = m_decodingHeap.front();
+    m_decodingHeapIndex[position] = NOT_QUEUED;
+
+    uint32_t last = m_decodingHeap.back();
+    m_decodingHeap.pop_back();
+    if (!m_decodingHeap.empty())
+    {
+        m_decodingHeap.front() = last;
+        SiftDecodingHeapDown(0);
+    }
+
+    return position;
 }
 
 bool
@@ -815,8 +979,13 @@ SatPhyRxCarrierPerWindow::AddEssaPacket(
                 << " Arrival Time: " << essaPacketParams.arrivalTime.GetSeconds()
                 << " Duration: " << essaPacketParams.duration.GetSeconds());
 
-    /// Insert received packet in packets container
-    m_essaPacketContainer.push_back(essaPacketParams);
+    /// Insert received packet in packets container, in order of end of reception
+    NS_ASSERT(m_essaPacketContainer.IsEmpty() ||
+              m_essaPacketContainer.Back().arrivalTime + m_essaPacketContainer.Back().duration <=
+                  essaPacketParams.arrivalTime + essaPacketParams.duration);
+    m_essaPacketContainer.PushBack(essaPacketParams);
+
+    m_maxPacketDuration = std::max(m_maxPacketDuration, essaPacketParams.duration);
 }
 
 void
@@ -22,12 +22,17 @@
 #define SATELLITE_PHY_RX_CARRIER_PER_WINDOW_H
 
 #include "satellite-crdsa-replica-tag.h"
+#include "satellite-fragment-vector.h"
 #include "satellite-phy-rx-carrier-per-slot.h"
 #include "satellite-phy-rx-carrier.h"
+#include "satellite-ring-buffer.h"
 #include "satellite-rtn-link-time.h"
 
 #include <ns3/singleton.h>
 
+#include <limits>
+#include <vector>
+
 namespace ns3
 {
 
@@ -64,9 +69,10 @@ class SatPhyRxCarrierPerWindow : public SatPhyRxCarrierPerSlot
         bool isInsideWindow;
         double meanSinr;
         double preambleMeanSinr;
-        std::vector<std::pair<double, double>> gamma;
+        SatFragmentVector gamma;
         Time arrivalTime;
         Time duration;
+        uint32_t payloadBytes;
     } essaPacketRxParams_s;
 
     /**
@@ -157,7 +163,16 @@ class SatPhyRxCarrierPerWindow : public SatPhyRxCarrierPerSlot
     virtual void DoDispose();
 
   private:
-    typedef std::list<SatPhyRxCarrierPerWindow::essaPacketRxParams_s> packetList_t;
+    /**
+     * \brief Packets ordered by end of reception, hence stored when received
+     */
+    typedef SatRingBuffer<SatPhyRxCarrierPerWindow::essaPacketRxParams_s> packetContainer_t;
+
+    /**
+     * \brief Positions of the first packet of a window and of the first packet after it
+     */
+    typedef std::pair<uint32_t, uint32_t> windowBounds_t;
+
     /**
      * \brief Function for storing the received E-SSA packets
      */
@@ -196,9 +211,9 @@ class SatPhyRxCarrierPerWindow : public SatPhyRxCarrierPerSlot
 
     /**
      * \brief Perform SIC for a given decoded packet
+     * \param processedPosition Position of the decoded packet in the window
      */
-    void DoSic(packetList_t::iterator processedPacket,
-               std::pair<packetList_t::iterator, packetList_t::iterator> windowBounds);
+    void DoSic(uint32_t processedPosition);
 
     /**
      * \brief Get the effective SNIR of the packet using the Mutual Information function
@@ -206,11 +221,44 @@ class SatPhyRxCarrierPerWindow : public SatPhyRxCarrierPerSlot
     double GetEffectiveSnir(const SatPhyRxCarrierPerWindow::essaPacketRxParams_s& packet);
 
     /**
-     * \brief Get the packet with the highst SNIR on the list
-     * \return True if a packet is returned, False otherwise
+     * \brief Index the packets of the window and queue the ones waiting to be decoded
+     */
+    void BuildDecodingHeap(Time startTime, Time endTime, windowBounds_t windowBounds);
+
+    /**
+     * \brief Check if a packet of the window is waiting to be decoded
+     */
+    bool IsDecodingCandidate(const SatPhyRxCarrierPerWindow::essaPacketRxParams_s& packet) const;
+
+    /**
+     * \brief Check if a packet is decoded before another one: highest SNIR first, then first
+     * received packet first
+     * \param position Position in the window of the first packet
+     * \param otherPosition Position in the window of the other packet
+     */
+    bool HasDecodingPriority(uint32_t position, uint32_t otherPosition) const;
+
+    /**
+     * \brief Restore the heap order by moving an entry towards the root
+     */
+    void SiftDecodingHeapUp(uint32_t heapIndex);
+
+    /**
+     * \brief Restore the heap order by moving an entry towards the leaves
+     */
+    void SiftDecodingHeapDown(uint32_t heapIndex);
+
+    /**
+     * \brief Queue a packet whose SNIR has been updated, or move it in the queue
+     * \param position Position of the packet in the window
+     */
+    void UpdateDecodingHeap(uint32_t position);
+
+    /**
+     * \brief Remove the packet with the highest SNIR from the decoding heap
+     * \return Position of the packet in the window
      */
-    packetList_t::iterator GetHighestSnirPacket(
-        const std::pair<packetList_t::iterator, packetList_t::iterator> windowBounds);
+    uint32_t PopHighestSnirPacket();
 
     /**
      * \brief Get the normalized start and end time between two interfering packets
@@ -220,11 +268,10 @@ class SatPhyRxCarrierPerWindow : public SatPhyRxCarrierPerSlot
         const SatPhyRxCarrierPerWindow::essaPacketRxParams_s& interferingPacket);
 
     /**
-     * \brief Get a pair of iterators, pointing to the first element in the window, and to the first
-     * after the window
+     * \brief Advance the window cursors and update the number of payload bytes in the window
+     * \return Positions of the first packet in the window, and of the first packet after it
      */
-    std::pair<packetList_t::iterator, packetList_t::iterator> GetWindowBounds(Time startTime,
-                                                                              Time endTime);
+    windowBounds_t GetWindowBounds(Time startTime, Time endTime);
 
     /**
      * \brief Function for processing a window
@@ -281,7 +328,7 @@ class SatPhyRxCarrierPerWindow : public SatPhyRxCarrierPerSlot
     /**
      * \brief ESSA packet container
      */
-    packetList_t m_essaPacketContainer;
+    packetContainer_t m_essaPacketContainer;
 
     /**
      * \brief The number of payload bytes in the window
@@ -292,6 +339,48 @@ class SatPhyRxCarrierPerWindow : public SatPhyRxCarrierPerSlot
      * \brief Enable Sic
      */
     uint32_t m_sicEnabled;
+
+    /**
+     * \brief Gamma vector of the preamble, reused between packets
+     */
+    SatFragmentVector m_gammaPreamble;
+
+    /**
+     * \brief Number of packets, from the front of the container, arriving before the end of the
+     * last window: the last window ends before this position
+     */
+    uint32_t m_windowLastPacket;
+
+    /**
+     * \brief Number of packets, from the front of the container, ending before the end of the
+     * last window
+     */
+    uint32_t m_windowEndedPackets;
+
+    /**
+     * \brief Payload bytes of the packets ending before the end of the last window
+     */
+    uint32_t m_payloadBytesEnded;
+
+    /**
+     * \brief Longest duration of the packets received, bounds the packets overlapping a time
+     */
+    Time m_maxPacketDuration;
+
+    /**
+     * \brief Indexed max-heap of the window positions of the packets waiting to be decoded
+     */
+    std::vector<uint32_t> m_decodingHeap;
+
+    /**
+     * \brief Index in m_decodingHeap of each window packet, NOT_QUEUED when not queued
+     */
+    std::vector<uint32_t> m_decodingHeapIndex;
+
+    /**
+     * \brief Heap index of the packets not waiting to be decoded
+     */
+    static constexpr uint32_t NOT_QUEUED = std::numeric_limits<uint32_t>::max();
 };
 
 //////////////////////////////////////////////////////////
@@ -29,6 +29,7 @@
 #include "satellite-crdsa-replica-tag.h"
 #include "satellite-mac-tag.h"
 #include "satellite-per-fragment-interference.h"
+#include "satellite-per-packet-energy-interference.h"
 #include "satellite-per-packet-interference.h"
 #include "satellite-perfect-interference-elimination.h"
 #include "satellite-phy.h"
@@ -95,6 +96,13 @@ SatPhyRxCarrier::SatPhyRxCarrier(uint32_t carrierId,
     {
         NS_LOG_INFO(this << " link results in use in carrier: " << carrierId);
         m_linkResults = carrierConf->GetLinkResults();
+
+        // link results are normally initialized by the helpers, otherwise
+        // they are resolved on the first received packet
+        if (m_linkResults != nullptr && m_linkResults->IsInitialized())
+        {
+            m_linkResultsErrorModel.Resolve(m_linkResults, m_channelType, m_linkRegenerationMode);
+        }
     }
 
     m_rxTemperatureK = carrierConf->GetRxTemperatureK();
@@ -161,6 +169,20 @@ SatPhyRxCarrier::DoCreateInterferenceModel(Ptr<SatPhyRxCarrierConf> carrierConf,
         }
         break;
     }
+    case SatPhyRxCarrierConf::IF_PER_PACKET_ENERGY: {
+        NS_LOG_INFO(this << " Per packet energy interference model created for carrier: "
+                         << carrierId);
+        if (carrierConf->IsIntfOutputTraceEnabled())
+        {
+            m_satInterference =
+                CreateObject<SatPerPacketEnergyInterference>(GetChannelType(), rxBandwidthHz);
+        }
+        else
+        {
+            m_satInterference = CreateObject<SatPerPacketEnergyInterference>();
+        }
+        break;
+    }
     case SatPhyRxCarrierConf::IF_TRACE: {
         NS_LOG_INFO(this << " Traced interference model created for carrier: " << carrierId);
         m_satInterference = CreateObject<SatTracedInterference>(GetChannelType(), rxBandwidthHz);
@@ -422,6 +444,9 @@ SatPhyRxCarrier::StartRx(Ptr<SatSignalParameters> rxParams)
 
             GetInterferenceModel()->NotifyRxStart(rxParamsStruct.interferenceEvent);
 
+            // The packets may be shared with the other receivers of the transmission
+            rxParams->AcquirePackets();
+
             key = m_rxPacketCounter;
             m_rxPacketCounter++;
 
@@ -518,102 +543,32 @@ bool
 SatPhyRxCarrier::CheckAgainstLinkResultsErrorModelAvi(double cSinr,
                                                       Ptr<SatSignalParameters> rxParams)
 {
-    bool error = false;
-
-    switch (GetChannelType())
-    {
-    case SatEnums::FORWARD_FEEDER_CH:
-    case SatEnums::FORWARD_USER_CH: {
-        /**
-         * In forward link the link results are in Es/No format, thus here we need
-         * to convert the SINR into Es/No:
-         *
-         * C/No = C/N * fs
-         * Es/No = C/N * B/fs = (C/No / fs) * B/fs
-         * Es/No = (C*Ts)/No = C/No * (1/fs) = C/N
-         *
-         * where
-         * C/No = carrier to noise density
-         * C/N = signal to noise ratio (= SINR in the simulator)
-         * Es/No = energy per symbol per noise density
-         * B = channel bandwidth in Hz
-         * fs = symbol rate in baud
-         */
-
-        double ber = (GetLinkResults()->GetObject<SatLinkResultsFwd>())
-                         ->GetBler(rxParams->m_txInfo.modCod,
-                                   rxParams->m_txInfo.frameType,
-                                   SatUtils::LinearToDb(cSinr));
-        double r = GetUniformRandomValue(0, 1);
-
-        if (r < ber)
-        {
-            error = true;
-        }
+    /**
+     * In forward link the link results are in Es/No format, in return link they
+     * are in Eb/No format. See SatCarrierErrorModel for the SINR conversions.
+     */
+    ResolveLinkResultsErrorModel();
 
-        NS_LOG_INFO("FORWARD cSinr (dB): " << SatUtils::LinearToDb(cSinr) << " esNo (dB): "
-                                           << SatUtils::LinearToDb(cSinr) << " rand: " << r
-                                           << " ber: " << ber << " error: " << error);
-        break;
-    }
+    double ber = m_linkResultsErrorModel.GetBler(cSinr,
+                                                 rxParams->m_txInfo.modCod,
+                                                 rxParams->m_txInfo.waveformId,
+                                                 rxParams->m_txInfo.frameType);
+    double r = GetUniformRandomValue(0, 1);
+    bool error = (r < ber);
 
-    case SatEnums::RETURN_FEEDER_CH:
-    case SatEnums::RETURN_USER_CH: {
-        /**
-         * In return link the link results are in Eb/No format, thus here we need
-         * to convert the SINR into Eb/No:
-         * Eb/No = C/N * B/fb = (C/No / fs) * B/fb
-         * Eb/No = (Es/log2M)/No = (Es/No)*(1/log2M)  = C/N * (1/log2M) = C/No * (1/fs) * (1/log2M)
-         *
-         * where
-         * C/No = carrier to noise density
-         * C/N = signal to noise ratio (= SINR in the simulator)
-         * Es/No = energy per symbol per noise density
-         * Eb/No = energy per bit per noise density
-         * B = channel bandwidth in Hz
-         * fs = symbol rate in baud
-         * fb = channel bitrate (after FEC) in bps (i.e. burst payloadInBits / burstDurationInSec)
-         */
-
-        double ebNo = cSinr / (SatUtils::GetCodingRate(rxParams->m_txInfo.modCod) *
-                               SatUtils::GetModulatedBits(rxParams->m_txInfo.modCod));
-
-        double ber;
-        if ((m_linkRegenerationMode == SatEnums::REGENERATION_LINK ||
-             m_linkRegenerationMode == SatEnums::REGENERATION_NETWORK) &&
-            GetChannelType() == SatEnums::RETURN_FEEDER_CH)
-        {
-            ber = (GetLinkResults()->GetObject<SatLinkResultsFwd>())
-                      ->GetBler(rxParams->m_txInfo.modCod,
-                                rxParams->m_txInfo.frameType,
-                                SatUtils::LinearToDb(cSinr));
-        }
-        else
-        {
-            ber = (GetLinkResults()->GetObject<SatLinkResultsRtn>())
-                      ->GetBler(rxParams->m_txInfo.waveformId, SatUtils::LinearToDb(ebNo));
-        }
-        double r = GetUniformRandomValue(0, 1);
+    NS_LOG_INFO("cSinr (dB): " << SatUtils::LinearToDb(cSinr) << " rand: " << r << " ber: " << ber
+                               << " error: " << error);
 
-        if (r < ber)
-        {
-            error = true;
-        }
+    return error;
+}
 
-        NS_LOG_INFO("RETURN cSinr (dB): "
-                    << SatUtils::LinearToDb(cSinr) << " ebNo (dB): " << SatUtils::LinearToDb(ebNo)
-                    << " modulated bits: " << SatUtils::GetModulatedBits(rxParams->m_txInfo.modCod)
-                    << " rand: " << r << " ber: " << ber << " error: " << error);
-        break;
-    }
-    case SatEnums::UNKNOWN_CH:
-    default: {
-        NS_FATAL_ERROR(
-            "SatPhyRxCarrier::CheckAgainstLinkResultsErrorModelAvi - Invalid channel type!");
-        break;
-    }
+void
+SatPhyRxCarrier::ResolveLinkResultsErrorModel()
+{
+    if (m_errorModel == SatPhyRxCarrierConf::EM_AVI && !m_linkResultsErrorModel.IsResolved())
+    {
+        m_linkResultsErrorModel.Resolve(GetLinkResults(), m_channelType, m_linkRegenerationMode);
     }
-    return error;
 }
 
 void
@@ -23,6 +23,7 @@
 #ifndef SATELLITE_PHY_RX_CARRIER_H
 #define SATELLITE_PHY_RX_CARRIER_H
 
+#include "satellite-carrier-error-model.h"
 #include "satellite-enums.h"
 #include "satellite-interference-elimination.h"
 #include "satellite-interference.h"
@@ -446,6 +447,13 @@ class SatPhyRxCarrier : public Object
      */
     bool CheckAgainstLinkResults(double cSinr, Ptr<SatSignalParameters> rxParams);
 
+    /**
+     * \brief Resolve the link results error model if not resolved yet. Called
+     * by the simulation thread before a frame is decoded by a worker thread,
+     * as resolving copies the link results shared between the carriers.
+     */
+    void ResolveLinkResultsErrorModel();
+
     /**
      * \brief Function for ending the packet reception from the SatChannel
      * \param key Key for Rx params map
@@ -713,6 +721,7 @@ class SatPhyRxCarrier : public Object
     Ptr<SatNodeInfo> m_nodeInfo;                  //< NodeInfo of the node where carrier is attached
     SatEnums::ChannelType_t m_channelType;        //< Channel type
     Ptr<SatLinkResults> m_linkResults;            //< Link results from the carrier configuration
+    SatCarrierErrorModel m_linkResultsErrorModel; //< Link results resolved for this carrier
     Ptr<SatWaveformConf> m_waveformConf;          //< Waveform configuration
     Ptr<UniformRandomVariable> m_uniformVariable; //< Uniform helper random variable
     SatPhyRxCarrierConf::ErrorModel m_errorModel; //< Error model
@@ -50,6 +50,7 @@ NS_OBJECT_ENSURE_REGISTERED(SatPhyRx);
 SatPhyRx::SatPhyRx()
     : m_beamId(),
       m_maxAntennaGain(),
+      m_antennaConfVersion(0),
       m_antennaLoss(),
       m_defaultFadingValue()
 {
@@ -69,6 +70,9 @@ SatPhyRx::DoDispose()
     m_device = 0;
     m_fadingContainer = 0;
     m_rxCarriers.clear();
+    m_addressingChangedCallback.Nullify();
+    m_rxPowerInputTraceHandle = SatInputTraceHandle();
+    m_rxCnoInputTraceHandle = SatInputTraceHandle();
     Object::DoDispose();
 }
 
@@ -109,6 +113,7 @@ SatPhyRx::SetMaxAntennaGain_Db(double gain_Db)
     NS_LOG_FUNCTION(this << gain_Db);
 
     m_maxAntennaGain = SatUtils::DbWToW(gain_Db);
+    m_antennaConfVersion++;
 }
 
 double
@@ -134,6 +139,14 @@ SatPhyRx::GetAntennaGain(Ptr<MobilityModel> mobility)
     return gain_W;
 }
 
+uint64_t
+SatPhyRx::GetAntennaConfVersion() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return m_antennaConfVersion;
+}
+
 void
 SatPhyRx::SetDefaultFadingValue(double fadingValue)
 {
@@ -202,6 +215,11 @@ SatPhyRx::SetNodeInfo(const Ptr<SatNodeInfo> nodeInfo)
     {
         (*it)->SetNodeInfo(nodeInfo);
     }
+
+    if (!m_addressingChangedCallback.IsNull())
+    {
+        m_addressingChangedCallback();
+    }
 }
 
 void
@@ -231,6 +249,14 @@ SatPhyRx::SetReceiveCallback(SatPhyRx::ReceiveCallback cb)
     }
 }
 
+void
+SatPhyRx::SetAddressingChangedCallback(SatPhyRx::AddressingChangedCallback cb)
+{
+    NS_LOG_FUNCTION(this << &cb);
+
+    m_addressingChangedCallback = cb;
+}
+
 void
 SatPhyRx::SetCnoCallback(SatPhyRx::CnoCallback cb)
 {
@@ -283,6 +309,7 @@ SatPhyRx::SetAntennaGainPattern(Ptr<SatAntennaGainPattern> agp, Ptr<SatMobilityM
 
     m_antennaGainPattern = agp;
     m_satMobility = mobility;
+    m_antennaConfVersion++;
 }
 
 void
@@ -494,6 +521,11 @@ SatPhyRx::SetBeamId(uint32_t beamId)
     {
         (*it)->SetBeamId(beamId);
     }
+
+    if (!m_addressingChangedCallback.IsNull())
+    {
+        m_addressingChangedCallback();
+    }
 }
 
 uint32_t
@@ -519,6 +551,22 @@ SatPhyRx::GetRxTemperatureK(Ptr<SatSignalParameters> rxParams)
     return m_rxCarriers[cId]->GetRxTemperatureK();
 }
 
+SatInputTraceHandle&
+SatPhyRx::GetRxPowerInputTraceHandle()
+{
+    NS_LOG_FUNCTION(this);
+
+    return m_rxPowerInputTraceHandle;
+}
+
+SatInputTraceHandle&
+SatPhyRx::GetRxCnoInputTraceHandle()
+{
+    NS_LOG_FUNCTION(this);
+
+    return m_rxCnoInputTraceHandle;
+}
+
 void
 SatPhyRx::StartRx(Ptr<SatSignalParameters> rxParams)
 {
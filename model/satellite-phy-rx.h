@@ -26,6 +26,7 @@
 #include "satellite-antenna-gain-pattern.h"
 #include "satellite-base-fading.h"
 #include "satellite-frame-conf.h"
+#include "satellite-input-trace-handle.h"
 #include "satellite-mobility-model.h"
 #include "satellite-net-device.h"
 #include "satellite-signal-parameters.h"
@@ -101,6 +102,14 @@ class SatPhyRx : public Object
      */
     double GetAntennaGain(Ptr<MobilityModel> mobility);
 
+    /**
+     * \brief Get the antenna configuration version of this PHY. The version is
+     * incremented each time the antenna gain pattern or the maximum antenna
+     * gain is set, so it may be used to detect that antenna gains changed.
+     * \return the antenna configuration version
+     */
+    uint64_t GetAntennaConfVersion() const;
+
     /**
      * \brief Function for setting the default fading value
      * \param fadingValue default fading value
@@ -198,12 +207,24 @@ class SatPhyRx : public Object
     typedef Callback<void, uint32_t, uint32_t, uint32_t, uint8_t, double>
         AverageNormalizedOfferedLoadCallback;
 
+    /**
+     * Callback invoked when the beam id or the MAC address of this receiver
+     * changes, so that the channel it is attached to may update its receiver index.
+     */
+    typedef Callback<void> AddressingChangedCallback;
+
     /**
      * Set the upper layer receive callback
      * \param cb receive callback funtion pointer
      */
     void SetReceiveCallback(SatPhyRx::ReceiveCallback cb);
 
+    /**
+     * Set the callback notifying the attached SatChannel of beam id and MAC address changes
+     * \param cb addressing changed callback, or a null callback to detach
+     */
+    void SetAddressingChangedCallback(SatPhyRx::AddressingChangedCallback cb);
+
     /**
      * Set C/N0 receiver
      * \param cb receive callback funtion pointer
@@ -239,6 +260,18 @@ class SatPhyRx : public Object
      */
     double GetRxTemperatureK(Ptr<SatSignalParameters> rxParams);
 
+    /**
+     * \brief Get the handle to the Rx power input trace of the receptions of this PHY
+     * \return handle, resolved by the channel in Rx power input trace mode
+     */
+    SatInputTraceHandle& GetRxPowerInputTraceHandle();
+
+    /**
+     * \brief Get the handle to the Rx C/N0 input trace of the receptions of this PHY
+     * \return handle, resolved by the channel in Rx C/N0 input trace mode
+     */
+    SatInputTraceHandle& GetRxCnoInputTraceHandle();
+
   private:
     Ptr<MobilityModel> m_mobility;
     Ptr<NetDevice> m_device;
@@ -262,6 +295,11 @@ class SatPhyRx : public Object
      */
     double m_maxAntennaGain;
 
+    /**
+     * Antenna configuration version, incremented when antenna gains are configured
+     */
+    uint64_t m_antennaConfVersion;
+
     /**
      * Configured antenna loss in linear
      */
@@ -279,6 +317,21 @@ class SatPhyRx : public Object
      * \brief Default fading value
      */
     double m_defaultFadingValue;
+
+    /**
+     * \brief Callback notifying the attached channel of beam id or MAC address changes
+     */
+    AddressingChangedCallback m_addressingChangedCallback;
+
+    /**
+     * \brief Handle to the Rx power input trace of the receptions of this PHY
+     */
+    SatInputTraceHandle m_rxPowerInputTraceHandle;
+
+    /**
+     * \brief Handle to the Rx C/N0 input trace of the receptions of this PHY
+     */
+    SatInputTraceHandle m_rxCnoInputTraceHandle;
 };
 
 } // namespace ns3
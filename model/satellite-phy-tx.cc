@@ -46,6 +46,7 @@ NS_OBJECT_ENSURE_REGISTERED(SatPhyTx);
 
 SatPhyTx::SatPhyTx()
     : m_maxAntennaGain(),
+      m_antennaConfVersion(0),
       m_state(RECONFIGURING),
       m_beamId(),
       m_txMode(),
@@ -66,6 +67,8 @@ SatPhyTx::DoDispose()
     m_channel = 0;
     m_mobility = 0;
     m_fadingContainer = 0;
+    m_rxPowerInputTraceHandle = SatInputTraceHandle();
+    m_rxCnoInputTraceHandle = SatInputTraceHandle();
     Object::DoDispose();
 }
 
@@ -112,6 +115,7 @@ SatPhyTx::SetMaxAntennaGain_Db(double gain_db)
     NS_LOG_FUNCTION(this << gain_db);
 
     m_maxAntennaGain = SatUtils::DbToLinear(gain_db);
+    m_antennaConfVersion++;
 }
 
 double
@@ -137,6 +141,14 @@ SatPhyTx::GetAntennaGain(Ptr<MobilityModel> mobility)
     return gain_W;
 }
 
+uint64_t
+SatPhyTx::GetAntennaConfVersion() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return m_antennaConfVersion;
+}
+
 void
 SatPhyTx::SetDefaultFadingValue(double fadingValue)
 {
@@ -195,6 +207,7 @@ SatPhyTx::SetAntennaGainPattern(Ptr<SatAntennaGainPattern> agp, Ptr<SatMobilityM
 
     m_antennaGainPattern = agp;
     m_satMobility = mobility;
+    m_antennaConfVersion++;
 }
 
 void
@@ -323,4 +336,20 @@ SatPhyTx::CanTransmit(void) const
     return m_state != RECONFIGURING;
 }
 
+SatInputTraceHandle&
+SatPhyTx::GetRxPowerInputTraceHandle()
+{
+    NS_LOG_FUNCTION(this);
+
+    return m_rxPowerInputTraceHandle;
+}
+
+SatInputTraceHandle&
+SatPhyTx::GetRxCnoInputTraceHandle()
+{
+    NS_LOG_FUNCTION(this);
+
+    return m_rxCnoInputTraceHandle;
+}
+
 } // namespace ns3
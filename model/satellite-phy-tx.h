@@ -25,6 +25,7 @@
 
 #include "satellite-antenna-gain-pattern.h"
 #include "satellite-base-fading.h"
+#include "satellite-input-trace-handle.h"
 #include "satellite-mobility-model.h"
 #include "satellite-net-device.h"
 #include "satellite-signal-parameters.h"
@@ -115,6 +116,14 @@ class SatPhyTx : public Object
      */
     double GetAntennaGain(Ptr<MobilityModel> mobility);
 
+    /**
+     * \brief Get the antenna configuration version of this PHY. The version is
+     * incremented each time the antenna gain pattern or the maximum antenna
+     * gain is set, so it may be used to detect that antenna gains changed.
+     * \return the antenna configuration version
+     */
+    uint64_t GetAntennaConfVersion() const;
+
     /**
      * \brief Function for setting the default fading value
      * \param fadingValue default fading value
@@ -163,6 +172,18 @@ class SatPhyTx : public Object
      */
     bool CanTransmit(void) const;
 
+    /**
+     * \brief Get the handle to the Rx power input trace of the transmissions of this PHY
+     * \return handle, resolved by the channel in Rx power input trace mode
+     */
+    SatInputTraceHandle& GetRxPowerInputTraceHandle();
+
+    /**
+     * \brief Get the handle to the Rx C/N0 input trace of the transmissions of this PHY
+     * \return handle, resolved by the channel in Rx C/N0 input trace mode
+     */
+    SatInputTraceHandle& GetRxCnoInputTraceHandle();
+
   protected:
     virtual void EndTx();
 
@@ -187,6 +208,11 @@ class SatPhyTx : public Object
      */
     double m_maxAntennaGain;
 
+    /**
+     * Antenna configuration version, incremented when antenna gains are configured
+     */
+    uint64_t m_antennaConfVersion;
+
     State m_state;
     uint32_t m_satId;
     uint32_t m_beamId;
@@ -201,6 +227,16 @@ class SatPhyTx : public Object
      * \brief Default fading value
      */
     double m_defaultFadingValue;
+
+    /**
+     * \brief Handle to the Rx power input trace of the transmissions of this PHY
+     */
+    SatInputTraceHandle m_rxPowerInputTraceHandle;
+
+    /**
+     * \brief Handle to the Rx C/N0 input trace of the transmissions of this PHY
+     */
+    SatInputTraceHandle m_rxCnoInputTraceHandle;
 };
 
 } // namespace ns3
@@ -49,6 +49,7 @@ SatPositionInputTraceContainer::GetInstanceTypeId(void) const
 }
 
 SatPositionInputTraceContainer::SatPositionInputTraceContainer()
+    : m_generation(0)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -75,6 +76,9 @@ SatPositionInputTraceContainer::Reset()
 {
     NS_LOG_FUNCTION(this);
 
+    // the traces held so far are resolved again
+    m_generation++;
+
     if (!m_container.empty())
     {
         m_container.clear();
@@ -122,7 +126,24 @@ SatPositionInputTraceContainer::GetPosition(const std::string& key,
 {
     NS_LOG_FUNCTION(this);
 
-    std::vector<double> row = FindNode(key)->InterpolateBetweenClosestTimeSamples();
+    return GetPosition(FindNode(key), refEllipsoid);
+}
+
+Ptr<SatInputFileStreamTimeDoubleContainer>
+SatPositionInputTraceContainer::GetTrace(const std::string& key)
+{
+    NS_LOG_FUNCTION(this << key);
+
+    return FindNode(key);
+}
+
+GeoCoordinate
+SatPositionInputTraceContainer::GetPosition(Ptr<SatInputFileStreamTimeDoubleContainer> trace,
+                                            GeoCoordinate::ReferenceEllipsoid_t refEllipsoid)
+{
+    NS_LOG_FUNCTION(trace);
+
+    std::vector<double> row = trace->InterpolateBetweenClosestTimeSamples();
     return GeoCoordinate(row.at(SatBaseTraceContainer::POSITION_TRACE_DEFAULT_LATITUDE_INDEX),
                          row.at(SatBaseTraceContainer::POSITION_TRACE_DEFAULT_LONGITUDE_INDEX),
                          row.at(SatBaseTraceContainer::POSITION_TRACE_DEFAULT_ALTITUDE_INDEX),
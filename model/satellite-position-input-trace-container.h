@@ -79,11 +79,39 @@ class SatPositionInputTraceContainer : public SatBaseTraceContainer
     GeoCoordinate GetPosition(const std::string& key,
                               GeoCoordinate::ReferenceEllipsoid_t refEllipsoid);
 
+    /**
+     * \brief Function for getting the position trace of a file, to be held
+     * by the caller instead of looking the file name up on each position update,
+     * until the generation of the container changes
+     * \param key filename to read positions from
+     * \return position trace
+     */
+    Ptr<SatInputFileStreamTimeDoubleContainer> GetTrace(const std::string& key);
+
+    /**
+     * \brief Function for getting the position at the current time from a position trace
+     * \param trace position trace
+     * \param refEllipsoid reference ellipsoid of the position
+     * \return position
+     */
+    static GeoCoordinate GetPosition(Ptr<SatInputFileStreamTimeDoubleContainer> trace,
+                                     GeoCoordinate::ReferenceEllipsoid_t refEllipsoid);
+
     /**
      * \brief Function for resetting the variables
      */
     void Reset();
 
+    /**
+     * \brief Function for getting the generation of the container, increased
+     * each time the container is reset
+     * \return generation of the container
+     */
+    inline uint32_t GetGeneration() const
+    {
+        return m_generation;
+    }
+
   private:
     /**
      * \brief Function for adding the node to the map
@@ -103,6 +131,11 @@ class SatPositionInputTraceContainer : public SatBaseTraceContainer
      * \brief Map for containers
      */
     container_t m_container;
+
+    /**
+     * \brief Generation of the container, checked by the holders of the traces
+     */
+    uint32_t m_generation;
 };
 
 } // namespace ns3
@@ -87,7 +87,7 @@ SatRayleighModel::Reset()
     NS_LOG_FUNCTION(this);
 
     m_rayleighConf = NULL;
-    m_oscillators.clear();
+    m_oscillators.Clear();
     m_uniformVariable = NULL;
 }
 
@@ -100,6 +100,7 @@ SatRayleighModel::ConstructOscillators()
     double phi = m_uniformVariable->GetValue();
     /// Theta is common for all oscillators:
     double theta = m_uniformVariable->GetValue();
+    m_oscillators.Reserve(m_rayleighParameters[0][1]);
     for (uint32_t i = 0; i < m_rayleighParameters[0][1]; i++)
     {
         uint32_t n = i + 1;
@@ -114,7 +115,7 @@ SatRayleighModel::ConstructOscillators()
         std::complex<double> amplitude = std::complex<double>(std::cos(psi), std::sin(psi)) * 2.0 /
                                          std::sqrt(m_rayleighParameters[0][1]);
         /// 3. Construct oscillator:
-        m_oscillators.push_back(CreateObject<SatFadingOscillator>(amplitude, phi, omega));
+        m_oscillators.Add(amplitude, phi, omega);
     }
 }
 
@@ -125,12 +126,7 @@ SatRayleighModel::GetComplexGain()
 
     double timeInSeconds = Now().GetSeconds();
 
-    std::complex<double> sumAmplitude = std::complex<double>(0, 0);
-    for (uint32_t i = 0; i < m_oscillators.size(); i++)
-    {
-        sumAmplitude += m_oscillators[i]->GetComplexValueAt(timeInSeconds);
-    }
-    return sumAmplitude;
+    return m_oscillators.GetComplexSumAt(timeInSeconds);
 }
 
 double
@@ -158,6 +154,23 @@ SatRayleighModel::GetChannelGain()
     return tempChannelGain;
 }
 
+void
+SatRayleighModel::GetChannelGains(const std::vector<double>& timesInSeconds,
+                                  std::vector<double>& gains)
+{
+    NS_LOG_FUNCTION(this << timesInSeconds.size());
+
+    std::vector<std::complex<double>> complexGains;
+    m_oscillators.GetComplexSumsAt(timesInSeconds, complexGains);
+
+    gains.resize(timesInSeconds.size());
+    for (std::size_t i = 0; i < timesInSeconds.size(); i++)
+    {
+        gains[i] = ((std::pow(complexGains[i].real(), 2) + std::pow(complexGains[i].imag(), 2)) /
+                    2);
+    }
+}
+
 void
 SatRayleighModel::UpdateParameters(uint32_t newSet, uint32_t newState)
 {
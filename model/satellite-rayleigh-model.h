@@ -21,7 +21,7 @@
 #define SATELLITE_RAYLEIGH_MODEL_H
 
 #include "satellite-base-fader.h"
-#include "satellite-fading-oscillator.h"
+#include "satellite-fading-oscillator-bank.h"
 #include "satellite-rayleigh-conf.h"
 
 #include <ns3/random-variable-stream.h>
@@ -87,6 +87,13 @@ class SatRayleighModel : public SatBaseFader
      */
     double GetChannelGain();
 
+    /**
+     * \brief Function for returning the channel gains at many times
+     * \param timesInSeconds times in seconds
+     * \param gains channel gains, one per time
+     */
+    void GetChannelGains(const std::vector<double>& timesInSeconds, std::vector<double>& gains);
+
     /**
      * \brief Function for updating the parameter set and state
      * \param set parameter set
@@ -106,9 +113,9 @@ class SatRayleighModel : public SatBaseFader
     void Reset();
 
     /**
-     * \brief Vector of oscillators
+     * \brief Bank of oscillators
      */
-    std::vector<Ptr<SatFadingOscillator>> m_oscillators;
+    SatFadingOscillatorBank m_oscillators;
 
     /**
      * \brief Current parameter set
@@ -60,7 +60,9 @@ SatResidualInterferenceElimination::GetInstanceTypeId(void) const
 SatResidualInterferenceElimination::SatResidualInterferenceElimination()
     : SatInterferenceElimination(),
       m_waveformConf(0),
-      m_samplingError(0.99)
+      m_samplingError(0.99),
+      m_burstLengthsInSymbols(),
+      m_minWaveformId(0)
 {
     NS_LOG_FUNCTION(this);
 
@@ -71,9 +73,17 @@ SatResidualInterferenceElimination::SatResidualInterferenceElimination(
     Ptr<SatWaveformConf> waveformConf)
     : SatInterferenceElimination(),
       m_waveformConf(waveformConf),
-      m_samplingError(0.99)
+      m_samplingError(0.99),
+      m_burstLengthsInSymbols(),
+      m_minWaveformId(waveformConf->GetMinWfId())
 {
     NS_LOG_FUNCTION(this);
+
+    for (uint32_t wfId = m_minWaveformId; wfId <= waveformConf->GetMaxWfId(); wfId++)
+    {
+        m_burstLengthsInSymbols.push_back(
+            waveformConf->GetWaveform(wfId)->GetBurstLengthInSymbols());
+    }
 }
 
 SatResidualInterferenceElimination::~SatResidualInterferenceElimination()
@@ -118,24 +128,23 @@ SatResidualInterferenceElimination::EliminateInterferences(
     /// at every iteration of SIC.
     double residualPower = GetResidualPower(processedPacket, EsNo);
     double normalizedTime = 0.0;
-    std::vector<std::pair<double, double>> ifPowerPerFragment;
 
     if (isRegenerative)
     {
         oldIfPower = packetInterferedWith->GetInterferencePower();
         ifPowerToRemove = processedPacket->m_rxPower_W;
-        ifPowerPerFragment = packetInterferedWith->GetInterferencePowerPerFragment();
+        m_ifPowerPerFragment = packetInterferedWith->GetInterferencePowerPerFragment();
     }
     else
     {
         oldIfPower = packetInterferedWith->GetInterferencePowerInSatellite();
         ifPowerToRemove = processedPacket->GetRxPowerInSatellite();
-        ifPowerPerFragment = packetInterferedWith->GetInterferencePowerInSatellitePerFragment();
+        m_ifPowerPerFragment = packetInterferedWith->GetInterferencePowerInSatellitePerFragment();
     }
 
-    for (std::pair<double, double>& ifPower : ifPowerPerFragment)
+    for (std::size_t i = 0; i < m_ifPowerPerFragment.GetSize(); i++)
     {
-        normalizedTime += ifPower.first;
+        normalizedTime += m_ifPowerPerFragment.GetDuration(i);
         if (startTime >= normalizedTime)
         {
             continue;
@@ -145,30 +154,33 @@ SatResidualInterferenceElimination::EliminateInterferences(
             break;
         }
 
-        ifPower.second -= ifPowerToRemove;
-        ifPower.second += residualPower;
-        if (std::abs(ifPower.second) < 1.0e-30) // std::numeric_limits<double>::epsilon ())
+        double ifPower = m_ifPowerPerFragment.GetValue(i);
+        ifPower -= ifPowerToRemove;
+        ifPower += residualPower;
+        if (std::abs(ifPower) < 1.0e-30) // std::numeric_limits<double>::epsilon ())
         {
-            ifPower.second = 0.0;
+            ifPower = 0.0;
         }
 
-        if (ifPower.second < 0)
+        if (ifPower < 0)
         {
             NS_FATAL_ERROR("Negative interference");
         }
+
+        m_ifPowerPerFragment.SetValue(i, ifPower);
     }
 
     if (isRegenerative)
     {
-        packetInterferedWith->SetInterferencePower(ifPowerPerFragment);
+        packetInterferedWith->SetInterferencePower(m_ifPowerPerFragment);
     }
     else
     {
-        packetInterferedWith->SetInterferencePowerInSatellite(ifPowerPerFragment);
+        packetInterferedWith->SetInterferencePowerInSatellite(m_ifPowerPerFragment);
     }
 
     NS_LOG_INFO("Interfered packet ifPower went from "
-                << oldIfPower << " to " << SatUtils::ScalarProduct(ifPowerPerFragment));
+                << oldIfPower << " to " << m_ifPowerPerFragment.GetWeightedSum());
 }
 
 double
@@ -22,6 +22,7 @@
 #define SATELLITE_RESIDUAL_INTERFERENCE_ELIMINATION_H
 
 #include "satellite-enums.h"
+#include "satellite-fragment-vector.h"
 #include "satellite-interference-elimination.h"
 #include "satellite-wave-form-conf.h"
 
@@ -88,9 +89,18 @@ class SatResidualInterferenceElimination : public SatInterferenceElimination
                                 double startTime,
                                 double endTime);
 
+    /**
+     * \brief Get the burst length of a waveform, read from the lengths cached
+     * at construction so that no reference to a shared waveform is taken while
+     * the frame is decoded by a worker thread
+     * \param waveformId Waveform id
+     * \return Burst length in symbols
+     */
     inline uint32_t GetBurstLengthInSymbols(uint32_t waveformId) const
     {
-        return m_waveformConf->GetWaveform(waveformId)->GetBurstLengthInSymbols();
+        NS_ASSERT(waveformId >= m_minWaveformId &&
+                  waveformId - m_minWaveformId < m_burstLengthsInSymbols.size());
+        return m_burstLengthsInSymbols[waveformId - m_minWaveformId];
     }
 
     /**
@@ -101,6 +111,17 @@ class SatResidualInterferenceElimination : public SatInterferenceElimination
   private:
     Ptr<SatWaveformConf> m_waveformConf;
     double m_samplingError;
+
+    /**
+     * \brief Burst lengths in symbols of the waveforms, by waveform id from m_minWaveformId
+     */
+    std::vector<uint32_t> m_burstLengthsInSymbols;
+    uint32_t m_minWaveformId;
+
+    /**
+     * \brief Interference of the packet being processed, reused between SIC passes
+     */
+    SatFragmentVector m_ifPowerPerFragment;
 };
 
 } // namespace ns3
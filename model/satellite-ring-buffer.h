@@ -0,0 +1,167 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+#ifndef SATELLITE_RING_BUFFER_H
+#define SATELLITE_RING_BUFFER_H
+
+#include <ns3/assert.h>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup satellite
+ * \brief Contiguous FIFO of items, appended at the back and removed from the
+ * front, with constant time access by position.
+ *
+ * Items are stored in a single array used circularly, whose capacity is a
+ * power of two doubled when full. Position 0 is the oldest item. References
+ * to items stay valid until the next PushBack.
+ */
+template <typename T>
+class SatRingBuffer
+{
+  public:
+    /**
+     * Default constructor, empty buffer.
+     */
+    SatRingBuffer()
+        : m_items(),
+          m_head(0),
+          m_size(0)
+    {
+    }
+
+    /**
+     * \return Number of items in the buffer
+     */
+    inline std::size_t GetSize() const
+    {
+        return m_size;
+    }
+
+    /**
+     * \return Whether the buffer holds no item
+     */
+    inline bool IsEmpty() const
+    {
+        return m_size == 0;
+    }
+
+    /**
+     * \param position Position of the item, 0 being the oldest
+     * \return The item
+     */
+    inline T& operator[](std::size_t position)
+    {
+        NS_ASSERT(position < m_size);
+        return m_items[(m_head + position) & (m_items.size() - 1)];
+    }
+
+    /**
+     * \param position Position of the item, 0 being the oldest
+     * \return The item
+     */
+    inline const T& operator[](std::size_t position) const
+    {
+        NS_ASSERT(position < m_size);
+        return m_items[(m_head + position) & (m_items.size() - 1)];
+    }
+
+    /**
+     * \return The oldest item
+     */
+    inline T& Front()
+    {
+        return (*this)[0];
+    }
+
+    /**
+     * \return The newest item
+     */
+    inline T& Back()
+    {
+        return (*this)[m_size - 1];
+    }
+
+    /**
+     * Append an item after the newest one.
+     * \param item Item to append
+     */
+    void PushBack(const T& item)
+    {
+        if (m_size == m_items.size())
+        {
+            Grow();
+        }
+        m_items[(m_head + m_size) & (m_items.size() - 1)] = item;
+        m_size++;
+    }
+
+    /**
+     * Remove the oldest item. Its slot is reset to release the resources it
+     * may hold.
+     */
+    void PopFront()
+    {
+        NS_ASSERT(m_size > 0);
+        m_items[m_head] = T();
+        m_head = (m_head + 1) & (m_items.size() - 1);
+        m_size--;
+    }
+
+  private:
+    /**
+     * Double the capacity, moving the items at the start of the new array.
+     */
+    void Grow()
+    {
+        std::vector<T> items(m_items.empty() ? 16 : 2 * m_items.size());
+        for (std::size_t position = 0; position < m_size; position++)
+        {
+            items[position] = std::move((*this)[position]);
+        }
+        m_items.swap(items);
+        m_head = 0;
+    }
+
+    /**
+     * \brief Storage, its size is the capacity of the buffer
+     */
+    std::vector<T> m_items;
+
+    /**
+     * \brief Index in m_items of the oldest item
+     */
+    std::size_t m_head;
+
+    /**
+     * \brief Number of items in the buffer
+     */
+    std::size_t m_size;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_RING_BUFFER_H */
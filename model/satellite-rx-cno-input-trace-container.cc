@@ -51,6 +51,7 @@ SatRxCnoInputTraceContainer::GetInstanceTypeId(void) const
 }
 
 SatRxCnoInputTraceContainer::SatRxCnoInputTraceContainer()
+    : m_generation(0)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -77,6 +78,9 @@ SatRxCnoInputTraceContainer::Reset()
 {
     NS_LOG_FUNCTION(this);
 
+    // the handles resolved so far are resolved again
+    m_generation++;
+
     if (!m_container.empty())
     {
         m_container.clear();
@@ -163,7 +167,7 @@ SatRxCnoInputTraceContainer::GetRxCno(key_t key)
     if (iter == m_containerConstantCno.end())
     {
         // No manual value has been set, read it from file
-        return FindNode(key)->ProceedToNextClosestTimeSample().at(
+        return FindNode(key)->ProceedToNextClosestTimeSampleValue(
             SatBaseTraceContainer::RX_CNO_TRACE_DEFAULT_RX_POWER_DENSITY_INDEX);
     }
 
@@ -171,11 +175,39 @@ SatRxCnoInputTraceContainer::GetRxCno(key_t key)
     return iter->second;
 }
 
+SatInputTraceHandle
+SatRxCnoInputTraceContainer::GetHandle(key_t key)
+{
+    NS_LOG_FUNCTION(this);
+
+    containerConstantCno_t::iterator iter = m_containerConstantCno.find(key);
+    if (iter != m_containerConstantCno.end())
+    {
+        return SatInputTraceHandle(key.first, m_generation, iter->second);
+    }
+
+    Ptr<SatInputFileStreamTimeDoubleContainer> trace = FindNode(key);
+
+    if (trace == NULL)
+    {
+        NS_FATAL_ERROR("SatRxCnoInputTraceContainer::GetHandle - No trace for MAC "
+                       << key.first << " channel type " << key.second);
+    }
+
+    return SatInputTraceHandle(key.first,
+                               m_generation,
+                               trace,
+                               SatBaseTraceContainer::RX_CNO_TRACE_DEFAULT_RX_POWER_DENSITY_INDEX);
+}
+
 void
 SatRxCnoInputTraceContainer::SetRxCno(key_t key, double cno)
 {
     NS_LOG_FUNCTION(this << cno);
 
+    // the handles resolved so far are resolved again
+    m_generation++;
+
     containerConstantCno_t::iterator iter = m_containerConstantCno.find(key);
     if (iter != m_containerConstantCno.end())
     {
@@ -199,6 +231,9 @@ SatRxCnoInputTraceContainer::SetRxCnoFile(key_t key, std::string path)
 {
     NS_LOG_FUNCTION(this);
 
+    // the handles resolved so far are resolved again
+    m_generation++;
+
     container_t::iterator iter = m_container.find(key);
     if (iter != m_container.end())
     {
@@ -24,6 +24,7 @@
 
 #include "satellite-base-trace-container.h"
 #include "satellite-enums.h"
+#include "satellite-input-trace-handle.h"
 
 #include <ns3/mac48-address.h>
 #include <ns3/satellite-input-fstream-time-double-container.h>
@@ -90,6 +91,14 @@ class SatRxCnoInputTraceContainer : public SatBaseTraceContainer
      */
     double GetRxCno(key_t key);
 
+    /**
+     * \brief Function for getting a direct handle to the Rx C/N0, either the
+     * constant value set for the key or its input trace
+     * \param key key
+     * \return handle to the Rx C/N0, resolved for the address of the key
+     */
+    SatInputTraceHandle GetHandle(key_t key);
+
     /**
      * \brief Function for setting the Rx C/N0 with constant value
      * \param key key
@@ -109,6 +118,16 @@ class SatRxCnoInputTraceContainer : public SatBaseTraceContainer
      */
     void Reset();
 
+    /**
+     * \brief Function for getting the generation of the container, increased
+     * each time the container is reset or a C/N0 is set
+     * \return generation of the container
+     */
+    inline uint32_t GetGeneration() const
+    {
+        return m_generation;
+    }
+
     /**
      * \brief Function for adding the node to the map
      * \param key key
@@ -130,6 +149,11 @@ class SatRxCnoInputTraceContainer : public SatBaseTraceContainer
      */
     container_t m_container;
 
+    /**
+     * \brief Generation of the container, checked by the handles
+     */
+    uint32_t m_generation;
+
     /**
      * \brief Container to store the constant values of C/N0. Overrides the use of an input file for
      * them.
@@ -51,6 +51,7 @@ SatRxPowerInputTraceContainer::GetInstanceTypeId(void) const
 }
 
 SatRxPowerInputTraceContainer::SatRxPowerInputTraceContainer()
+    : m_generation(0)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -77,6 +78,9 @@ SatRxPowerInputTraceContainer::Reset()
 {
     NS_LOG_FUNCTION(this);
 
+    // the handles resolved so far are resolved again
+    m_generation++;
+
     if (!m_container.empty())
     {
         m_container.clear();
@@ -154,7 +158,27 @@ SatRxPowerInputTraceContainer::GetRxPowerDensity(key_t key)
 {
     NS_LOG_FUNCTION(this);
 
-    return FindNode(key)->ProceedToNextClosestTimeSample().at(
+    return FindNode(key)->ProceedToNextClosestTimeSampleValue(
+        SatBaseTraceContainer::RX_POWER_TRACE_DEFAULT_RX_POWER_DENSITY_INDEX);
+}
+
+SatInputTraceHandle
+SatRxPowerInputTraceContainer::GetHandle(key_t key)
+{
+    NS_LOG_FUNCTION(this);
+
+    Ptr<SatInputFileStreamTimeDoubleContainer> trace = FindNode(key);
+
+    if (trace == NULL)
+    {
+        NS_FATAL_ERROR("SatRxPowerInputTraceContainer::GetHandle - No trace for MAC "
+                       << key.first << " channel type " << key.second);
+    }
+
+    return SatInputTraceHandle(
+        key.first,
+        m_generation,
+        trace,
         SatBaseTraceContainer::RX_POWER_TRACE_DEFAULT_RX_POWER_DENSITY_INDEX);
 }
 
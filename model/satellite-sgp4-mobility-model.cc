@@ -181,6 +181,14 @@ SatSGP4MobilityModel::DoSetGeoPosition(const GeoCoordinate& position)
     NotifyGeoCourseChange();
 }
 
+bool
+SatSGP4MobilityModel::IsPositionTimeDriven(void) const
+{
+    NS_LOG_FUNCTION(this);
+
+    return true;
+}
+
 bool
 SatSGP4MobilityModel::IsInitialized() const
 {
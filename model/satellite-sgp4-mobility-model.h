@@ -83,6 +83,12 @@ class SatSGP4MobilityModel : public SatMobilityModel
      */
     void SetTleInfo(const std::string& tle);
 
+    /**
+     * @brief Position is propagated from the TLE as the simulation time advances.
+     * @return true
+     */
+    virtual bool IsPositionTimeDriven(void) const;
+
   private:
     /// row of a Matrix
     struct Row
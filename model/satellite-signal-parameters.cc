@@ -41,7 +41,8 @@ SatSignalParameters::SatSignalParameters()
       m_txPower_W(),
       m_rxPower_W(),
       m_phyTx(),
-      m_channelType()
+      m_channelType(),
+      m_packetsShared(false)
 {
     NS_LOG_FUNCTION(this);
     m_ifParams = CreateObject<SatInterferenceParameters>();
@@ -73,6 +74,7 @@ SatSignalParameters::SatSignalParameters(const SatSignalParameters& p)
     m_txInfo.packetType = p.m_txInfo.packetType;
     m_txInfo.crdsaUniquePacketId = p.m_txInfo.crdsaUniquePacketId;
     m_ifParams = p.m_ifParams;
+    m_packetsShared = false;
 }
 
 SatSignalParameters::~SatSignalParameters()
@@ -90,6 +92,40 @@ SatSignalParameters::Copy()
     return p;
 }
 
+Ptr<SatSignalParameters>
+SatSignalParameters::CopySharingPackets()
+{
+    NS_LOG_FUNCTION(this);
+
+    // Copy the parameters without the packets, which are then shared as such
+    PacketsInBurst_t packets;
+    packets.swap(m_packetsInBurst);
+
+    Ptr<SatSignalParameters> p(new SatSignalParameters(*this), false);
+
+    m_packetsInBurst.swap(packets);
+    p->m_packetsInBurst = m_packetsInBurst;
+    p->m_packetsShared = true;
+
+    return p;
+}
+
+void
+SatSignalParameters::AcquirePackets()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_packetsShared)
+    {
+        for (PacketsInBurst_t::iterator i = m_packetsInBurst.begin(); i != m_packetsInBurst.end();
+             i++)
+        {
+            *i = (*i)->Copy();
+        }
+        m_packetsShared = false;
+    }
+}
+
 TypeId
 SatSignalParameters::GetTypeId(void)
 {
@@ -24,6 +24,7 @@
 #define SATELLITE_SIGNAL_PARAMETERS_H
 
 #include "satellite-enums.h"
+#include "satellite-fragment-vector.h"
 #include "satellite-utils.h"
 
 #include <ns3/nstime.h>
@@ -85,26 +86,18 @@ class SatInterferenceParameters : public Object
     /**
      * Interference power (I) per packet fragment.
      *
-     * A pair p represent:
-     *  - p.first The percentage of time of the packet the interference is applicable
-     *  - p.second The value of the interference for the given amount of time
-     *
-     * As an example, the following values {(0.25, x), (0.5, y), (0.25, z)}
-     * represent the following interferences on the packet:
-     *
-     *  +---+-----+---+
-     *  | x |  y  | z |
-     *  +---+-----+---+
-     *  0   ¼     ¾   1
+     * Each fragment holds the percentage of time of the packet the
+     * interference is applicable and the value of the interference for
+     * the given amount of time. See SatFragmentVector for an example.
      */
-    std::vector<std::pair<double, double>> m_ifPowerPerFragment_W;
+    SatFragmentVector m_ifPowerPerFragment_W;
 
     /**
      * Interference power in the satellite (I) per packet fragment.
      *
      * See m_ifPowerPerFragment_W for full description
      */
-    std::vector<std::pair<double, double>> m_ifPowerInSatellitePerFragment_W;
+    SatFragmentVector m_ifPowerInSatellitePerFragment_W;
 
     bool m_sinrComputed;
 };
@@ -152,6 +145,21 @@ class SatSignalParameters : public Object
 
     Ptr<SatSignalParameters> Copy();
 
+    /**
+     * \brief Create a copy of these parameters which shares the packets of the burst
+     * with these parameters. Used when delivering one transmission to several receivers:
+     * the packets are copied only by the receivers accepting them, see AcquirePackets.
+     * \return the copy sharing the packets in burst
+     */
+    Ptr<SatSignalParameters> CopySharingPackets();
+
+    /**
+     * \brief Make the packets in burst owned by these parameters, i.e. copy the packets
+     * if they are shared with other receivers of the transmission. Must be called before
+     * the packets are modified or passed to the upper layers.
+     */
+    void AcquirePackets();
+
     /**
      * \brief Get the type ID
      * \return the object TypeId
@@ -222,10 +230,10 @@ class SatSignalParameters : public Object
      * \brief Set interference power based on packet fragment
      * \param ifPowerPerFragment
      */
-    inline void SetInterferencePower(std::vector<std::pair<double, double>> ifPowerPerFragment)
+    inline void SetInterferencePower(const SatFragmentVector& ifPowerPerFragment)
     {
         m_ifParams->m_ifPowerPerFragment_W = ifPowerPerFragment;
-        m_ifParams->m_ifPower_W = SatUtils::ScalarProduct(ifPowerPerFragment);
+        m_ifParams->m_ifPower_W = ifPowerPerFragment.GetWeightedSum();
     }
 
     /**
@@ -239,7 +247,7 @@ class SatSignalParameters : public Object
     /**
      * \brief Get interference power per packet fragment
      */
-    inline std::vector<std::pair<double, double>> GetInterferencePowerPerFragment()
+    inline const SatFragmentVector& GetInterferencePowerPerFragment()
     {
         return m_ifParams->m_ifPowerPerFragment_W;
     }
@@ -248,11 +256,10 @@ class SatSignalParameters : public Object
      * \brief Set interference power in satellite based on packet fragment
      * \param ifPowerPerFragment
      */
-    inline void SetInterferencePowerInSatellite(
-        std::vector<std::pair<double, double>> ifPowerPerFragment)
+    inline void SetInterferencePowerInSatellite(const SatFragmentVector& ifPowerPerFragment)
     {
         m_ifParams->m_ifPowerInSatellitePerFragment_W = ifPowerPerFragment;
-        m_ifParams->m_ifPowerInSatellite_W = SatUtils::ScalarProduct(ifPowerPerFragment);
+        m_ifParams->m_ifPowerInSatellite_W = ifPowerPerFragment.GetWeightedSum();
     }
 
     /**
@@ -266,7 +273,7 @@ class SatSignalParameters : public Object
     /**
      * \brief Get interference power in satellite per packet fragment
      */
-    inline std::vector<std::pair<double, double>> GetInterferencePowerInSatellitePerFragment()
+    inline const SatFragmentVector& GetInterferencePowerInSatellitePerFragment()
     {
         return m_ifParams->m_ifPowerInSatellitePerFragment_W;
     }
@@ -321,6 +328,11 @@ class SatSignalParameters : public Object
 
   private:
     Ptr<SatInterferenceParameters> m_ifParams;
+
+    /**
+     * Tells whether the packets in burst are shared with other receivers of the transmission
+     */
+    bool m_packetsShared;
 };
 
 } // namespace ns3
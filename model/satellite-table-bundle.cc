@@ -0,0 +1,535 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+#include "satellite-table-bundle.h"
+
+#include "../utils/satellite-env-variables.h"
+
+#include <ns3/boolean.h>
+#include <ns3/fatal-error.h>
+#include <ns3/hash.h>
+#include <ns3/log.h>
+#include <ns3/singleton.h>
+#include <ns3/string.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <limits.h>
+#include <set>
+#include <sstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+NS_LOG_COMPONENT_DEFINE("SatTableBundle");
+
+namespace ns3
+{
+
+/// Magic number at the start of a bundle file
+static const char BUNDLE_MAGIC[8] = {'S', 'N', 'S', '3', 'T', 'B', 'L', '\0'};
+
+/// Version of the bundle format, to be increased on any layout change
+static const uint32_t BUNDLE_VERSION = 2;
+
+/// Written in native byte order, detects bundles built on another architecture
+static const uint64_t BUNDLE_BYTE_ORDER = 0x0102030405060708ULL;
+
+SatTableBundle::Mapping::Mapping(void* address, uint64_t size)
+    : m_address(address),
+      m_size(size)
+{
+    NS_LOG_FUNCTION(this << address << size);
+}
+
+SatTableBundle::Mapping::~Mapping()
+{
+    NS_LOG_FUNCTION(this);
+
+    munmap(m_address, m_size);
+}
+
+const char*
+SatTableBundle::Mapping::GetAddress() const
+{
+    return static_cast<const char*>(m_address);
+}
+
+uint64_t
+SatTableBundle::Mapping::GetSize() const
+{
+    return m_size;
+}
+
+SatTableBundle::Column::Column()
+    : m_values(),
+      m_mapping(),
+      m_data(0),
+      m_size(0)
+{
+}
+
+SatTableBundle::Column::Column(std::vector<double>&& values)
+    : m_values(std::move(values)),
+      m_mapping(),
+      m_data(m_values.data()),
+      m_size(m_values.size())
+{
+}
+
+SatTableBundle::Column::Column(Ptr<const Mapping> mapping, const double* data, uint32_t size)
+    : m_values(),
+      m_mapping(mapping),
+      m_data(data),
+      m_size(size)
+{
+}
+
+SatTableBundle::Column::Column(const Column& other)
+    : m_values(other.m_values),
+      m_mapping(other.m_mapping),
+      m_data(other.m_data),
+      m_size(other.m_size)
+{
+    Rebind();
+}
+
+SatTableBundle::Column&
+SatTableBundle::Column::operator=(const Column& other)
+{
+    if (this != &other)
+    {
+        m_values = other.m_values;
+        m_mapping = other.m_mapping;
+        m_data = other.m_data;
+        m_size = other.m_size;
+        Rebind();
+    }
+
+    return *this;
+}
+
+void
+SatTableBundle::Column::swap(Column& other)
+{
+    m_values.swap(other.m_values);
+    std::swap(m_mapping, other.m_mapping);
+    std::swap(m_data, other.m_data);
+    std::swap(m_size, other.m_size);
+    Rebind();
+    other.Rebind();
+}
+
+void
+SatTableBundle::Column::clear()
+{
+    std::vector<double>().swap(m_values);
+    m_mapping = 0;
+    m_data = 0;
+    m_size = 0;
+}
+
+void
+SatTableBundle::Column::Rebind()
+{
+    if (!m_mapping)
+    {
+        m_data = m_values.data();
+    }
+}
+
+NS_OBJECT_ENSURE_REGISTERED(SatTableBundle);
+
+TypeId
+SatTableBundle::GetTypeId(void)
+{
+    static TypeId tid =
+        TypeId("ns3::SatTableBundle")
+            .SetParent<Object>()
+            .AddConstructor<SatTableBundle>()
+            .AddAttribute("Enabled",
+                          "Look up tables in the binary bundle before parsing text files.",
+                          BooleanValue(true),
+                          MakeBooleanAccessor(&SatTableBundle::m_enabled),
+                          MakeBooleanChecker())
+            .AddAttribute("FileName",
+                          "Path of the binary bundle, relative to the data folder unless absolute.",
+                          StringValue("tables.bin"),
+                          MakeStringAccessor(&SatTableBundle::m_fileName),
+                          MakeStringChecker());
+    return tid;
+}
+
+TypeId
+SatTableBundle::GetInstanceTypeId(void) const
+{
+    return GetTypeId();
+}
+
+SatTableBundle::SatTableBundle()
+    : m_enabled(true),
+      m_fileName("tables.bin"),
+      m_isOpen(false),
+      m_mapping()
+{
+    NS_LOG_FUNCTION(this);
+
+    // Attributes are needed already in construction phase:
+    // - ConstructSelf call in constructor
+    // - GetInstanceTypeId needs to be implemented
+    ObjectBase::ConstructSelf(AttributeConstructionList());
+}
+
+SatTableBundle::~SatTableBundle()
+{
+    NS_LOG_FUNCTION(this);
+
+    Reset();
+}
+
+void
+SatTableBundle::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+
+    Reset();
+
+    Object::DoDispose();
+}
+
+void
+SatTableBundle::Reset()
+{
+    NS_LOG_FUNCTION(this);
+
+    // tables loaded from the bundle keep their own reference to the mapping
+    m_entries.clear();
+    m_mapping = 0;
+    m_isOpen = false;
+}
+
+void
+SatTableBundle::Open()
+{
+    NS_LOG_FUNCTION(this);
+
+    m_isOpen = true;
+
+    if (!m_enabled || m_fileName.empty())
+    {
+        return;
+    }
+
+    std::string path = m_fileName;
+    if (path[0] != '/')
+    {
+        path = Singleton<SatEnvVariables>::Get()->LocateDataDirectory() + "/" + path;
+    }
+
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        NS_LOG_INFO("No table bundle at " << path << ", text files are used");
+        return;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (uint64_t)st.st_size < sizeof(header_s))
+    {
+        NS_LOG_WARN("Table bundle " << path << " is truncated, text files are used");
+        close(fd);
+        return;
+    }
+
+    // the mapping stays valid after the descriptor is closed
+    void* address = mmap(0, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (address == MAP_FAILED)
+    {
+        NS_LOG_WARN("Table bundle " << path << " cannot be mapped, text files are used");
+        return;
+    }
+
+    m_mapping = Create<Mapping>(address, st.st_size);
+    uint64_t mappingSize = m_mapping->GetSize();
+
+    const header_s* header = reinterpret_cast<const header_s*>(m_mapping->GetAddress());
+    if (std::memcmp(header->m_magic, BUNDLE_MAGIC, sizeof(BUNDLE_MAGIC)) != 0 ||
+        header->m_version != BUNDLE_VERSION || header->m_byteOrder != BUNDLE_BYTE_ORDER ||
+        mappingSize < sizeof(header_s) + (uint64_t)header->m_tableCount * sizeof(entry_s))
+    {
+        NS_LOG_WARN("Table bundle " << path << " has an unsupported format, text files are used");
+        Reset();
+        m_isOpen = true;
+        return;
+    }
+
+    const entry_s* entries = reinterpret_cast<const entry_s*>(header + 1);
+    for (uint32_t i = 0; i < header->m_tableCount; i++)
+    {
+        const entry_s* entry = entries + i;
+        uint64_t dataSize = (uint64_t)entry->m_rows * entry->m_columns * sizeof(double);
+
+        if (entry->m_name[sizeof(entry->m_name) - 1] != '\0' || entry->m_offset % sizeof(double) ||
+            entry->m_offset > mappingSize || dataSize > mappingSize - entry->m_offset)
+        {
+            NS_LOG_WARN("Table bundle " << path << " is corrupted, text files are used");
+            Reset();
+            m_isOpen = true;
+            return;
+        }
+
+        m_entries.insert(std::make_pair(std::string(entry->m_name), entry));
+    }
+
+    NS_LOG_INFO("Table bundle " << path << " mapped with " << m_entries.size() << " tables");
+}
+
+bool
+SatTableBundle::GetColumns(std::string sourcePath, Columns_t& columns)
+{
+    NS_LOG_FUNCTION(this << sourcePath);
+
+    if (!m_isOpen)
+    {
+        Open();
+    }
+
+    std::map<std::string, const entry_s*>::const_iterator it =
+        m_entries.find(GetTableName(sourcePath));
+    if (it == m_entries.end())
+    {
+        return false;
+    }
+
+    const entry_s* entry = it->second;
+
+    // script might be launched by test.py, try a different base path as the text loaders do
+    uint64_t size;
+    uint64_t hash;
+    if (GetSourceDigest(sourcePath, size, hash) ||
+        (sourcePath[0] != '/' && GetSourceDigest("../../" + sourcePath, size, hash)))
+    {
+        if (size != entry->m_sourceSize || hash != entry->m_sourceHash)
+        {
+            NS_LOG_INFO("Table " << it->first << " of the bundle is stale");
+            return false;
+        }
+    }
+
+    const double* data =
+        reinterpret_cast<const double*>(m_mapping->GetAddress() + entry->m_offset);
+
+    columns.clear();
+    columns.reserve(entry->m_columns);
+    for (uint32_t c = 0; c < entry->m_columns; c++)
+    {
+        columns.push_back(Column(m_mapping, data + (uint64_t)c * entry->m_rows, entry->m_rows));
+    }
+
+    return true;
+}
+
+void
+SatTableBundle::TakeColumns(TextColumns_t& text, Columns_t& columns)
+{
+    columns.clear();
+    columns.reserve(text.size());
+    for (std::vector<double>& values : text)
+    {
+        columns.push_back(Column(std::move(values)));
+    }
+
+    text.clear();
+}
+
+void
+SatTableBundle::Write(std::string bundlePath, const std::vector<sourceTable_s>& tables)
+{
+    NS_LOG_FUNCTION(bundlePath << tables.size());
+
+    header_s header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.m_magic, BUNDLE_MAGIC, sizeof(BUNDLE_MAGIC));
+    header.m_version = BUNDLE_VERSION;
+    header.m_tableCount = tables.size();
+    header.m_byteOrder = BUNDLE_BYTE_ORDER;
+
+    std::vector<entry_s> entries(tables.size());
+    std::set<std::string> names;
+    uint64_t offset = sizeof(header_s) + tables.size() * sizeof(entry_s);
+
+    for (uint32_t i = 0; i < tables.size(); i++)
+    {
+        const sourceTable_s& table = tables[i];
+        entry_s& entry = entries[i];
+        std::memset(&entry, 0, sizeof(entry));
+
+        std::string name = GetTableName(table.m_sourcePath);
+        if (name.size() >= sizeof(entry.m_name))
+        {
+            NS_FATAL_ERROR("SatTableBundle::Write - Table name " << name << " is too long");
+        }
+        if (!names.insert(name).second)
+        {
+            NS_FATAL_ERROR("SatTableBundle::Write - Table name " << name << " is not unique");
+        }
+
+        if (!GetSourceDigest(table.m_sourcePath, entry.m_sourceSize, entry.m_sourceHash))
+        {
+            NS_FATAL_ERROR("SatTableBundle::Write - The file " << table.m_sourcePath
+                                                                << " is not found.");
+        }
+
+        uint32_t rows = table.m_columns.empty() ? 0 : table.m_columns[0].size();
+        for (uint32_t c = 0; c < table.m_columns.size(); c++)
+        {
+            if (table.m_columns[c].size() != rows)
+            {
+                NS_FATAL_ERROR("SatTableBundle::Write - Columns of " << name
+                                                                     << " differ in length");
+            }
+        }
+
+        std::strncpy(entry.m_name, name.c_str(), sizeof(entry.m_name) - 1);
+        entry.m_rows = rows;
+        entry.m_columns = table.m_columns.size();
+        entry.m_offset = offset;
+        offset += (uint64_t)rows * entry.m_columns * sizeof(double);
+    }
+
+    // write aside and rename, running simulations keep their mapping of the previous bundle
+    std::string tmpPath = bundlePath + ".tmp";
+    std::ofstream ofs(tmpPath.c_str(), std::ofstream::out | std::ofstream::binary);
+
+    if (!ofs.is_open())
+    {
+        NS_FATAL_ERROR("SatTableBundle::Write - The file " << tmpPath << " cannot be created.");
+    }
+
+    ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if (!entries.empty())
+    {
+        ofs.write(reinterpret_cast<const char*>(&entries[0]), entries.size() * sizeof(entry_s));
+    }
+
+    for (const sourceTable_s& table : tables)
+    {
+        for (const std::vector<double>& column : table.m_columns)
+        {
+            if (!column.empty())
+            {
+                ofs.write(reinterpret_cast<const char*>(column.data()),
+                          column.size() * sizeof(double));
+            }
+        }
+    }
+
+    ofs.close();
+
+    if (ofs.fail() || std::rename(tmpPath.c_str(), bundlePath.c_str()) != 0)
+    {
+        NS_FATAL_ERROR("SatTableBundle::Write - The file " << bundlePath << " cannot be written.");
+    }
+}
+
+std::string
+SatTableBundle::GetTableName(std::string sourcePath)
+{
+    // the data folder is found relatively to the working directory, which differs
+    // between the bundle builder and the simulations
+    std::string path = NormalizePath(sourcePath);
+    std::string dataPath =
+        NormalizePath(Singleton<SatEnvVariables>::Get()->LocateDataDirectory()) + "/";
+
+    if (path.compare(0, dataPath.size(), dataPath) == 0)
+    {
+        return path.substr(dataPath.size());
+    }
+
+    return path;
+}
+
+std::string
+SatTableBundle::NormalizePath(std::string path)
+{
+    if (path.empty() || path[0] != '/')
+    {
+        char cwd[PATH_MAX];
+        if (getcwd(cwd, sizeof(cwd)) == 0)
+        {
+            NS_FATAL_ERROR("SatTableBundle::NormalizePath - Working directory not found.");
+        }
+        path = std::string(cwd) + "/" + path;
+    }
+
+    std::vector<std::string> components;
+    std::istringstream iss(path);
+    std::string component;
+
+    while (std::getline(iss, component, '/'))
+    {
+        if (component == "..")
+        {
+            if (!components.empty())
+            {
+                components.pop_back();
+            }
+        }
+        else if (!component.empty() && component != ".")
+        {
+            components.push_back(component);
+        }
+    }
+
+    std::string normalized;
+    for (const std::string& c : components)
+    {
+        normalized += "/" + c;
+    }
+
+    return normalized.empty() ? "/" : normalized;
+}
+
+bool
+SatTableBundle::GetSourceDigest(std::string path, uint64_t& size, uint64_t& hash)
+{
+    // the content is hashed, as an edit within the resolution of the modification
+    // time or keeping the size of the file is not seen otherwise
+    std::ifstream ifs(path.c_str(), std::ifstream::in | std::ifstream::binary);
+    if (!ifs.is_open())
+    {
+        return false;
+    }
+
+    std::ostringstream content;
+    content << ifs.rdbuf();
+
+    std::string source = content.str();
+    size = source.size();
+    hash = Hash64(source);
+    return true;
+}
+
+} // namespace ns3
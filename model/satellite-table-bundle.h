@@ -0,0 +1,362 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+#ifndef SATELLITE_TABLE_BUNDLE_H
+#define SATELLITE_TABLE_BUNDLE_H
+
+#include <ns3/object.h>
+#include <ns3/ptr.h>
+#include <ns3/simple-ref-count.h>
+
+#include <map>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup satellite
+ *
+ * \brief Read only bundle of the numerical tables found in the data folder.
+ *
+ * Link results, mutual information curves and waveform configurations are
+ * text files parsed value by value at startup. The bundle stores all of them
+ * as binary columns of doubles in a single versioned file, which is memory
+ * mapped on first use and shared read-only between the simulation processes
+ * of a campaign. It is built with the sat-build-table-bundle program.
+ *
+ * Tables are identified by the path of their text source, relative to the
+ * data folder or absolute for sources outside of it. The size and a hash of
+ * the content of each text file are recorded in the bundle: when the text
+ * file still exists but does not match, the entry is considered stale and
+ * the caller parses the text file as before. Likewise, a missing bundle or a
+ * bundle of another version or byte order is ignored.
+ *
+ * The columns returned by the bundle view the mapped doubles, which stay
+ * mapped as long as a table references them.
+ *
+ * The class is used through Singleton<SatTableBundle>.
+ */
+class SatTableBundle : public Object
+{
+  public:
+    /**
+     * \brief Mapped bundle file, unmapped when the last reference is released
+     */
+    class Mapping : public SimpleRefCount<Mapping>
+    {
+      public:
+        /**
+         * \brief Constructor
+         * \param address Address of the mapping
+         * \param size Size of the mapping in bytes
+         */
+        Mapping(void* address, uint64_t size);
+
+        /**
+         * \brief Destructor, unmaps the file
+         */
+        ~Mapping();
+
+        /**
+         * \brief Get the start of the mapping
+         * \return Address of the first byte of the file
+         */
+        const char* GetAddress() const;
+
+        /**
+         * \brief Get the size of the mapping
+         * \return Size of the file in bytes
+         */
+        uint64_t GetSize() const;
+
+      private:
+        void* m_address;
+        uint64_t m_size;
+    };
+
+    /**
+     * \brief Read only column of a table, either owning the values parsed
+     * from a text file or viewing the values of a mapped bundle.
+     *
+     * The accessors follow the standard containers, so that the tables index
+     * a column as they would a std::vector.
+     */
+    class Column
+    {
+      public:
+        /**
+         * \brief Constructor of an empty column
+         */
+        Column();
+
+        /**
+         * \brief Constructor of a column owning its values
+         * \param values Values of the column, moved into the column
+         */
+        explicit Column(std::vector<double>&& values);
+
+        /**
+         * \brief Constructor of a column viewing a mapped bundle
+         * \param mapping Mapping kept alive by the column
+         * \param data First value of the column in the mapping
+         * \param size Number of values
+         */
+        Column(Ptr<const Mapping> mapping, const double* data, uint32_t size);
+
+        /**
+         * \brief Copy constructor
+         * \param other Column to copy
+         */
+        Column(const Column& other);
+
+        /**
+         * \brief Copy assignment
+         * \param other Column to copy
+         * \return this column
+         */
+        Column& operator=(const Column& other);
+
+        /**
+         * \brief Exchange the contents of two columns
+         * \param other Column to exchange with
+         */
+        void swap(Column& other);
+
+        /**
+         * \brief Release the values
+         */
+        void clear();
+
+        // read only accessors of the standard containers
+
+        inline std::size_t size() const
+        {
+            return m_size;
+        }
+
+        inline bool empty() const
+        {
+            return m_size == 0;
+        }
+
+        inline const double* begin() const
+        {
+            return m_data;
+        }
+
+        inline const double* end() const
+        {
+            return m_data + m_size;
+        }
+
+        inline const double& front() const
+        {
+            return m_data[0];
+        }
+
+        inline const double& back() const
+        {
+            return m_data[m_size - 1];
+        }
+
+        inline const double& operator[](std::size_t i) const
+        {
+            return m_data[i];
+        }
+
+      private:
+        /**
+         * \brief Point the view at the owned values unless a mapping is viewed
+         */
+        void Rebind();
+
+        std::vector<double> m_values;
+        Ptr<const Mapping> m_mapping;
+        const double* m_data;
+        uint32_t m_size;
+    };
+
+    /**
+     * \brief Columns of a table, all of the same length
+     */
+    typedef std::vector<Column> Columns_t;
+
+    /**
+     * \brief Columns of a table parsed from a text file
+     */
+    typedef std::vector<std::vector<double>> TextColumns_t;
+
+    /**
+     * \brief Table parsed from a text file, to be written in a bundle
+     */
+    typedef struct
+    {
+        std::string m_sourcePath;
+        TextColumns_t m_columns;
+    } sourceTable_s;
+
+    /**
+     * \brief NS-3 function for type id
+     * \return type id
+     */
+    static TypeId GetTypeId(void);
+
+    /**
+     * \brief Get the type ID of instance
+     * \return the object TypeId
+     */
+    virtual TypeId GetInstanceTypeId(void) const;
+
+    /**
+     * \brief Constructor
+     */
+    SatTableBundle();
+
+    /**
+     * \brief Destructor
+     */
+    ~SatTableBundle();
+
+    /**
+     * \brief Get the columns of the table built from a text file.
+     *
+     * The columns view the mapped bundle, the caller checks their content
+     * as it checks the content of the text file.
+     *
+     * \param sourcePath Path of the text file
+     * \param columns Columns of the table, filled if found
+     * \return true if an up to date table was found in the bundle, false
+     * if the text file needs to be parsed
+     */
+    bool GetColumns(std::string sourcePath, Columns_t& columns);
+
+    /**
+     * \brief Take the columns parsed from a text file.
+     *
+     * \param text Columns parsed from the text file, emptied
+     * \param columns Columns owning the parsed values
+     */
+    static void TakeColumns(TextColumns_t& text, Columns_t& columns);
+
+    /**
+     * \brief Release the mapped bundle. The bundle is mapped again, with the
+     * current attribute values, on the next look up.
+     */
+    void Reset();
+
+    /**
+     * \brief Write a bundle file.
+     *
+     * \param bundlePath Path of the bundle to write
+     * \param tables Tables to store in the bundle
+     */
+    static void Write(std::string bundlePath, const std::vector<sourceTable_s>& tables);
+
+    /**
+     * \brief Get the size and content hash of a text source, to detect a
+     * binary copy made stale by an edit of the source
+     * \param path Path of the file
+     * \param size Size of the file in bytes
+     * \param hash Hash of the content of the file
+     * \return true if the file exists
+     */
+    static bool GetSourceDigest(std::string path, uint64_t& size, uint64_t& hash);
+
+  private:
+    /**
+     * \brief Bundle file header
+     */
+    typedef struct
+    {
+        char m_magic[8];
+        uint32_t m_version;
+        uint32_t m_tableCount;
+        uint64_t m_byteOrder;
+    } header_s;
+
+    /**
+     * \brief Bundle directory entry, the columns of the table are stored
+     * one after the other at m_offset
+     */
+    typedef struct
+    {
+        char m_name[256];
+        uint64_t m_sourceSize;
+        uint64_t m_sourceHash;
+        uint32_t m_rows;
+        uint32_t m_columns;
+        uint64_t m_offset;
+    } entry_s;
+
+    virtual void DoDispose();
+
+    /**
+     * \brief Map the bundle file and index its directory
+     */
+    void Open();
+
+    /**
+     * \brief Get the name identifying the table of a text file
+     * \param sourcePath Path of the text file
+     * \return Path relative to the data folder, or absolute path of a file
+     * outside of the data folder
+     */
+    static std::string GetTableName(std::string sourcePath);
+
+    /**
+     * \brief Make a path absolute and remove its "." and ".." components,
+     * without resolving links so that the file does not need to exist
+     * \param path Path to normalize
+     * \return Normalized absolute path
+     */
+    static std::string NormalizePath(std::string path);
+
+    /**
+     * \brief Enable the use of the bundle
+     */
+    bool m_enabled;
+
+    /**
+     * \brief Path of the bundle, relative to the data folder unless absolute
+     */
+    std::string m_fileName;
+
+    /**
+     * \brief Whether the bundle has been looked for since the last reset
+     */
+    bool m_isOpen;
+
+    /**
+     * \brief Mapped bundle file, 0 if not mapped
+     */
+    Ptr<Mapping> m_mapping;
+
+    /**
+     * \brief Directory entries of the mapped bundle by table name
+     */
+    std::map<std::string, const entry_s*> m_entries;
+};
+
+} // namespace ns3
+
+#endif /* SATELLITE_TABLE_BUNDLE_H */
@@ -93,19 +93,27 @@ SatTracedInterference::DoAdd(Time duration, double power, Address rxAddress)
     return event;
 }
 
-std::vector<std::pair<double, double>>
+const SatFragmentVector&
 SatTracedInterference::DoCalculate(Ptr<SatInterference::InterferenceChangeEvent> event)
 {
     NS_LOG_FUNCTION(this);
 
-    m_power = m_rxBandwidth_Hz *
-              Singleton<SatInterferenceInputTraceContainer>::Get()->GetInterferenceDensity(
-                  std::make_pair(event->GetSatEarthStationAddress(), m_channelType));
+    Address address = event->GetSatEarthStationAddress();
 
-    std::vector<std::pair<double, double>> powerPerFragment;
-    powerPerFragment.emplace_back(1.0, m_power);
+    SatInterferenceInputTraceContainer* container =
+        Singleton<SatInterferenceInputTraceContainer>::Get();
+    SatInputTraceHandle& handle = m_interferenceTraceHandles[address];
+    if (!handle.IsResolvedFor(address, container->GetGeneration()))
+    {
+        handle = container->GetHandle(std::make_pair(address, m_channelType));
+    }
+
+    m_power = m_rxBandwidth_Hz * handle.GetValue();
 
-    return powerPerFragment;
+    m_ifPowerPerPacket.Clear();
+    m_ifPowerPerPacket.Add(1.0, m_power);
+
+    return m_ifPowerPerPacket;
 }
 
 void
@@ -135,6 +143,8 @@ SatTracedInterference::DoDispose()
 {
     NS_LOG_FUNCTION(this);
 
+    m_interferenceTraceHandles.clear();
+
     SatInterference::DoDispose();
 }
 
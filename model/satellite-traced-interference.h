@@ -24,9 +24,12 @@
 #define SATELLITE_TRACED_INTERFERENCE_H
 
 #include "satellite-enums.h"
+#include "satellite-input-trace-handle.h"
 #include "satellite-interference-input-trace-container.h"
 #include "satellite-interference.h"
 
+#include <map>
+
 namespace ns3
 {
 
@@ -102,7 +105,7 @@ class SatTracedInterference : public SatInterference
      *
      * \return Final power value at end of receiving
      */
-    virtual std::vector<std::pair<double, double>> DoCalculate(
+    virtual const SatFragmentVector& DoCalculate(
         Ptr<SatInterference::InterferenceChangeEvent> event);
 
     /**
@@ -156,6 +159,18 @@ class SatTracedInterference : public SatInterference
      * \brief RX Bandwidth in Hz
      */
     double m_rxBandwidth_Hz;
+
+    /**
+     * \brief Calculated interference, reused between calculations
+     */
+    SatFragmentVector m_ifPowerPerPacket;
+
+    /**
+     * \brief Handles to the interference density traces, by earth station
+     * address. The return user link receives from every UT of the beam, each
+     * handle is resolved again only when the container is reset or changed.
+     */
+    std::map<Address, SatInputTraceHandle> m_interferenceTraceHandles;
 };
 
 } // namespace ns3
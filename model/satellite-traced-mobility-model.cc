@@ -70,6 +70,7 @@ void
 SatTracedMobilityModel::DoDispose()
 {
     m_antennaGainPatterns = NULL;
+    m_positionTrace = NULL;
 
     Object::DoDispose();
 }
@@ -84,6 +85,8 @@ SatTracedMobilityModel::SatTracedMobilityModel(uint32_t satId,
                                                Ptr<SatAntennaGainPatternContainer> agp)
     : m_satId(satId),
       m_traceFilename(filename),
+      m_positionTrace(Singleton<SatPositionInputTraceContainer>::Get()->GetTrace(filename)),
+      m_positionTraceGeneration(Singleton<SatPositionInputTraceContainer>::Get()->GetGeneration()),
       m_updateInterval(MilliSeconds(1)),
       m_refEllipsoid(GeoCoordinate::SPHERE),
       m_geoPosition(0.0, 0.0, 0.0),
@@ -137,9 +140,16 @@ SatTracedMobilityModel::UpdateGeoPositionFromFile(void)
 {
     NS_LOG_FUNCTION(this);
 
+    // the trace is resolved again after a reset of the container
+    SatPositionInputTraceContainer* container = Singleton<SatPositionInputTraceContainer>::Get();
+    if (m_positionTraceGeneration != container->GetGeneration())
+    {
+        m_positionTrace = container->GetTrace(m_traceFilename);
+        m_positionTraceGeneration = container->GetGeneration();
+    }
+
     GeoCoordinate newPosition =
-        Singleton<SatPositionInputTraceContainer>::Get()->GetPosition(m_traceFilename,
-                                                                      m_refEllipsoid);
+        SatPositionInputTraceContainer::GetPosition(m_positionTrace, m_refEllipsoid);
     DoSetGeoPosition(newPosition);
 
     Simulator::Schedule(m_updateInterval, &SatTracedMobilityModel::UpdateGeoPositionFromFile, this);
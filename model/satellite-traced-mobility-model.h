@@ -25,6 +25,7 @@
 #include "satellite-mobility-model.h"
 
 #include <ns3/nstime.h>
+#include <ns3/satellite-input-fstream-time-double-container.h>
 
 namespace ns3
 {
@@ -92,6 +93,8 @@ class SatTracedMobilityModel : public SatMobilityModel
 
     uint32_t m_satId;
     std::string m_traceFilename;
+    Ptr<SatInputFileStreamTimeDoubleContainer> m_positionTrace;
+    uint32_t m_positionTraceGeneration;
     Time m_updateInterval;
     GeoCoordinate::ReferenceEllipsoid_t m_refEllipsoid;
     GeoCoordinate m_geoPosition;
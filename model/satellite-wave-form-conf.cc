@@ -28,6 +28,7 @@
 #include <ns3/double.h>
 #include <ns3/enum.h>
 #include <ns3/log.h>
+#include <ns3/singleton.h>
 #include <ns3/uinteger.h>
 
 #include <algorithm>
@@ -275,8 +276,62 @@ SatWaveformConf::ReadFromFile(std::string filePathName)
 {
     NS_LOG_FUNCTION(this << filePathName);
 
+    SatTableBundle::Columns_t columns;
+
+    if (!Singleton<SatTableBundle>::Get()->GetColumns(filePathName, columns))
+    {
+        SatTableBundle::TextColumns_t text;
+        ReadTextColumns(filePathName, text);
+        SatTableBundle::TakeColumns(text, columns);
+    }
+
+    if (columns.size() != 7 || columns[0].empty())
+    {
+        NS_FATAL_ERROR("SatWaveformConf::ReadFromFile - No waveform read from " << filePathName);
+    }
+
     std::vector<uint32_t> wfIds;
 
+    for (uint32_t row = 0; row < columns[0].size(); row++)
+    {
+        uint32_t wfIndex = columns[0][row];
+        uint32_t modulatedBits = columns[1][row];
+        uint32_t codingRateNumerator = columns[2][row];
+        uint32_t codingRateDenominator = columns[3][row];
+        uint32_t payloadBytes = columns[4][row];
+        uint32_t durationInSymbols = columns[5][row];
+        uint32_t preambleDurationInSymbols = columns[6][row];
+
+        // Store temporarily all wfIds
+        wfIds.push_back(wfIndex);
+
+        double dCodingRate = double(codingRateNumerator) / codingRateDenominator;
+
+        // Convert modulated bits and coding rate to MODCOD enum
+        SatEnums::SatModcod_t modcod =
+            ConvertToModCod(modulatedBits, codingRateNumerator, codingRateDenominator);
+
+        // Create new waveform and insert it to the waveform map
+        Ptr<SatWaveform> wf = Create<SatWaveform>(wfIndex,
+                                                  modulatedBits,
+                                                  dCodingRate,
+                                                  modcod,
+                                                  payloadBytes,
+                                                  durationInSymbols,
+                                                  preambleDurationInSymbols);
+        m_waveforms.insert(std::make_pair(wfIndex, wf));
+    }
+
+    // Note, currently we assume that the waveform ids are consecutive!
+    m_minWfId = *std::min_element(wfIds.begin(), wfIds.end());
+    m_maxWfId = *std::max_element(wfIds.begin(), wfIds.end());
+}
+
+void
+SatWaveformConf::ReadTextColumns(std::string filePathName, SatTableBundle::TextColumns_t& columns)
+{
+    NS_LOG_FUNCTION(filePathName);
+
     // READ FROM THE SPECIFIED INPUT FILE
     std::ifstream* ifs = new std::ifstream(filePathName.c_str(), std::ifstream::in);
 
@@ -293,8 +348,7 @@ SatWaveformConf::ReadFromFile(std::string filePathName)
         }
     }
 
-    // Row vector containing the waveform information for a certain waveform index
-    std::vector<double> rowVector;
+    columns.assign(7, std::vector<double>());
 
     // Start conditions
     int32_t wfIndex, modulatedBits, payloadBytes, durationInSymbols, preambleDurationInSymbols;
@@ -320,10 +374,7 @@ SatWaveformConf::ReadFromFile(std::string filePathName)
             preambleDurationInSymbols = 0;
         }
 
-        // Store temporarily all wfIds
-        wfIds.push_back(wfIndex);
-
-        // Convert the coding rate fraction into double
+        // Convert the coding rate fraction into numerator and denominator
         std::istringstream ss(sCodingRate);
         std::string token;
         std::vector<uint32_t> output;
@@ -343,28 +394,17 @@ SatWaveformConf::ReadFromFile(std::string filePathName)
                            "amount of elements!");
         }
 
-        double dCodingRate = double(output[0]) / output[1];
-
-        // Convert modulated bits and coding rate to MODCOD enum
-        SatEnums::SatModcod_t modcod = ConvertToModCod(modulatedBits, output[0], output[1]);
-
-        // Create new waveform and insert it to the waveform map
-        Ptr<SatWaveform> wf = Create<SatWaveform>(wfIndex,
-                                                  modulatedBits,
-                                                  dCodingRate,
-                                                  modcod,
-                                                  payloadBytes,
-                                                  durationInSymbols,
-                                                  preambleDurationInSymbols);
-        m_waveforms.insert(std::make_pair(wfIndex, wf));
+        columns[0].push_back(wfIndex);
+        columns[1].push_back(modulatedBits);
+        columns[2].push_back(output[0]);
+        columns[3].push_back(output[1]);
+        columns[4].push_back(payloadBytes);
+        columns[5].push_back(durationInSymbols);
+        columns[6].push_back(preambleDurationInSymbols);
     }
 
     ifs->close();
     delete ifs;
-
-    // Note, currently we assume that the waveform ids are consecutive!
-    m_minWfId = *std::min_element(wfIds.begin(), wfIds.end());
-    m_maxWfId = *std::max_element(wfIds.begin(), wfIds.end());
 }
 
 void
@@ -22,6 +22,7 @@
 #define SATELLITE_WAVE_FORM_CONF_H
 
 #include "satellite-enums.h"
+#include "satellite-table-bundle.h"
 
 #include <ns3/nstime.h>
 #include <ns3/object.h>
@@ -353,9 +354,18 @@ class SatWaveformConf : public Object
      */
     static const uint32_t LONG_BURST_LENGTH = 1616;
 
+    /**
+     * \brief Parse a waveform table text file
+     * \param filePathName path and file name
+     * \param columns Waveform id, modulated bits, coding rate numerator and
+     * denominator, payload in bytes, duration and preamble duration in symbols
+     */
+    static void ReadTextColumns(std::string filePathName, SatTableBundle::TextColumns_t& columns);
+
   private:
     /**
-     * \brief Read the waveform table from a file
+     * \brief Read the waveform table from a file, or from the table bundle if
+     * it holds an up to date copy of the file
      * \param filePathName path and file name
      */
     void ReadFromFile(std::string filePathName);
@@ -21,13 +21,30 @@
 #include "../model/satellite-antenna-gain-pattern-container.h"
 #include "../model/satellite-antenna-gain-pattern.h"
 #include "../model/satellite-constant-position-mobility-model.h"
+#include "../model/satellite-utils.h"
 #include "../utils/satellite-env-variables.h"
 
+#include "ns3/boolean.h"
+#include "ns3/config.h"
+#include "ns3/double.h"
 #include "ns3/log.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/rng-seed-manager.h"
 #include "ns3/simulator.h"
 #include "ns3/singleton.h"
+#include "ns3/string.h"
 #include "ns3/test.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
 using namespace ns3;
 
 /**
@@ -37,7 +54,9 @@ using namespace ns3;
  *
  * This case creates the antenna gain patterns classes and compares the
  * antenna gain values and best beam ids for the test positions (= GW positions
- * of the 72 beam reference system).
+ * of the 72 beam reference system). The best beam ids looked up in the raster
+ * are then compared with the ones found by interpolating the gains of all
+ * the beams on a dense grid of positions.
  */
 class SatAntennaPatternTestCase : public TestCase
 {
@@ -127,9 +146,407 @@ SatAntennaPatternTestCase::DoRun(void)
         NS_TEST_ASSERT_MSG_EQ(bestBeamId, expectedBeamIds[i], "Not expected best spot-beam id");
     }
 
+    // The best beams from the raster match the ones from the gains of all the
+    // beams, for the default satellite position and for a moved satellite
+    SatAntennaGainPatternContainer fullContainer;
+    fullContainer.SetAttribute("UseBestBeamRaster", BooleanValue(false));
+
+    Ptr<SatMobilityModel> movedMobility = CreateObject<SatConstantPositionMobilityModel>();
+    movedMobility->SetGeoPosition(GeoCoordinate(0.3, 33.7, 35786000));
+    gpContainer.ConfigureBeamsMobility(1, movedMobility);
+    fullContainer.ConfigureBeamsMobility(0, mobility);
+    fullContainer.ConfigureBeamsMobility(1, movedMobility);
+
+    for (uint32_t satId = 0; satId < 2; satId++)
+    {
+        for (double lat = 36.0; lat < 66.0; lat += 0.37)
+        {
+            for (double lon = -9.0; lon < 30.0; lon += 0.41)
+            {
+                GeoCoordinate coord(lat, lon, 0.0);
+                NS_TEST_ASSERT_MSG_EQ(gpContainer.GetBestBeamId(satId, coord, true),
+                                      fullContainer.GetBestBeamId(satId, coord, true),
+                                      "Best beam from the raster differs at " << lat << " " << lon);
+            }
+        }
+    }
+
     Singleton<SatEnvVariables>::Get()->DoDispose();
 }
 
+/**
+ * \brief Test case comparing an antenna gain pattern mapped from its binary
+ * file with the same pattern parsed from its text file.
+ *
+ * A small pattern with NaN gains is written to a temporary text file, parsed,
+ * then converted to the binary format. The text file is removed, so that the
+ * pattern can only be loaded from the binary file, and the gains are compared
+ * on a dense grid of positions. The text file is then written again with
+ * different content, of another size or of the same size, which makes the
+ * binary file stale: the pattern must load the new text content. The batch
+ * interpolation of the positions is compared with their single interpolation.
+ */
+class SatAntennaPatternBinaryTestCase : public TestCase
+{
+  public:
+    SatAntennaPatternBinaryTestCase();
+
+  private:
+    virtual void DoRun(void);
+
+    /**
+     * \brief Write a pattern text file
+     * \param fileName Path of the file
+     * \param offsetDb Offset of all the gains
+     */
+    void WritePattern(std::string fileName, double offsetDb) const;
+};
+
+SatAntennaPatternBinaryTestCase::SatAntennaPatternBinaryTestCase()
+    : TestCase("Test satellite antenna gain pattern binary format.")
+{
+}
+
+void
+SatAntennaPatternBinaryTestCase::WritePattern(std::string fileName, double offsetDb) const
+{
+    std::ofstream ofs(fileName.c_str());
+    ofs.precision(17);
+    for (uint32_t latIndex = 0; latIndex < 7; latIndex++)
+    {
+        for (uint32_t lonIndex = 0; lonIndex < 9; lonIndex++)
+        {
+            ofs << 40.0 + 0.25 * latIndex << " " << -1.0 + 0.5 * lonIndex << " ";
+            if (latIndex == 6 && lonIndex > 6)
+            {
+                ofs << (lonIndex == 7 ? "NaN" : "nan") << std::endl;
+            }
+            else
+            {
+                ofs << offsetDb + 45.0 + 0.3 * latIndex - 0.17 * lonIndex * lonIndex << std::endl;
+            }
+        }
+    }
+    ofs.close();
+}
+
+void
+SatAntennaPatternBinaryTestCase::DoRun(void)
+{
+    std::string fileName = CreateTempDirFilename("antenna-pattern-test.txt");
+    std::string binaryName = SatAntennaGainPattern::GetBinaryPath(fileName);
+
+    WritePattern(fileName, 0.0);
+
+    GeoCoordinate geoPos = GeoCoordinate(0.0, 33.0, 35786000);
+    Ptr<SatMobilityModel> mobility = CreateObject<SatConstantPositionMobilityModel>();
+    mobility->SetGeoPosition(geoPos);
+
+    Ptr<SatAntennaGainPattern> textPattern = CreateObject<SatAntennaGainPattern>(fileName, geoPos);
+
+    SatAntennaGainPattern::ConvertToBinary(fileName);
+    std::remove(fileName.c_str());
+
+    Ptr<SatAntennaGainPattern> binaryPattern =
+        CreateObject<SatAntennaGainPattern>(fileName, geoPos);
+
+    std::vector<GeoCoordinate> coords;
+    std::vector<double> batchGains;
+
+    for (double lat = 40.0; lat <= 41.5; lat += 0.0625)
+    {
+        for (double lon = -1.0; lon <= 3.0; lon += 0.0625)
+        {
+            GeoCoordinate coord(lat, lon, 0.0);
+            coords.push_back(coord);
+            double textGain = textPattern->GetAntennaGain_lin(coord, mobility);
+            double binaryGain = binaryPattern->GetAntennaGain_lin(coord, mobility);
+
+            if (std::isnan(textGain))
+            {
+                NS_TEST_ASSERT_MSG_EQ(std::isnan(binaryGain),
+                                      true,
+                                      "Binary gain not NaN at " << lat << " " << lon);
+            }
+            else
+            {
+                NS_TEST_ASSERT_MSG_EQ(binaryGain,
+                                      textGain,
+                                      "Binary gain differs at " << lat << " " << lon);
+            }
+        }
+    }
+
+    // the batch interpolation matches the single one, out of range points included
+    coords.push_back(GeoCoordinate(39.0, 0.0, 0.0));
+    coords.push_back(GeoCoordinate(40.5, 3.5, 0.0));
+    binaryPattern->GetAntennaGains_lin(coords, mobility, batchGains);
+    NS_TEST_ASSERT_MSG_EQ(batchGains.size(), coords.size(), "Missing batch gains");
+    for (std::size_t i = 0; i < coords.size(); i++)
+    {
+        double gain = binaryPattern->GetAntennaGain_lin(coords[i], mobility);
+        NS_TEST_ASSERT_MSG_EQ((std::isnan(gain) && std::isnan(batchGains[i])) ||
+                                  gain == batchGains[i],
+                              true,
+                              "Batch gain differs at " << coords[i].GetLatitude() << " "
+                                                       << coords[i].GetLongitude());
+    }
+
+    // a text file not matching the binary file takes precedence, here its size differs
+    WritePattern(fileName, 100.0);
+
+    Ptr<SatAntennaGainPattern> stalePattern = CreateObject<SatAntennaGainPattern>(fileName, geoPos);
+    GeoCoordinate coord(40.0, -1.0, 0.0);
+    double gainDb = SatUtils::LinearToDb(stalePattern->GetAntennaGain_lin(coord, mobility));
+    NS_TEST_ASSERT_MSG_EQ_TOL(gainDb,
+                              145.0,
+                              1e-4,
+                              "Stale binary pattern used");
+
+    // the content is compared, an edit keeping the size of the file is seen as well
+    WritePattern(fileName, 0.0);
+    SatAntennaGainPattern::ConvertToBinary(fileName);
+
+    std::fstream edited(fileName.c_str(), std::fstream::in | std::fstream::out);
+    std::string line;
+    std::getline(edited, line);
+    std::string::size_type gainStart = line.rfind(' ') + 1;
+    NS_TEST_ASSERT_MSG_EQ(line[gainStart], '4', "Unexpected first gain " << line);
+    edited.seekp(gainStart);
+    edited.put('5');
+    edited.close();
+
+    stalePattern = CreateObject<SatAntennaGainPattern>(fileName, geoPos);
+    gainDb = SatUtils::LinearToDb(stalePattern->GetAntennaGain_lin(coord, mobility));
+    NS_TEST_ASSERT_MSG_EQ_TOL(gainDb,
+                              55.0,
+                              1e-4,
+                              "Binary pattern of a text file edited in place used");
+
+    std::remove(fileName.c_str());
+    std::remove(binaryName.c_str());
+}
+
+/**
+ * \brief Test case drawing random positions in an antenna gain pattern.
+ *
+ * A small pattern, with gains decreasing away from its center and a NaN
+ * gain, is written to a temporary text file. In Rejection mode, the drawn
+ * positions are compared with the ones of the former algorithm, which drew
+ * valid positions until the three other corners of the cell were found by a
+ * linear search, run with the same random stream. In ValidCells mode, every
+ * drawn position is checked to lie in a cell whose four corners are valid,
+ * so that its gain can be interpolated, and every such cell to be drawn.
+ */
+class SatAntennaPatternRandomPositionTestCase : public TestCase
+{
+  public:
+    SatAntennaPatternRandomPositionTestCase();
+
+  private:
+    virtual void DoRun(void);
+
+    /**
+     * \brief Get the gain of a grid point of the pattern
+     * \param latIndex Latitude index of the grid point
+     * \param lonIndex Longitude index of the grid point
+     * \return The gain in dB, NaN outside of the coverage
+     */
+    double GetGainDb(uint32_t latIndex, uint32_t lonIndex) const;
+
+    /**
+     * \brief Check whether the four corners of a cell are valid
+     * \param latIndex Latitude index of the lower left corner
+     * \param lonIndex Longitude index of the lower left corner
+     * \return true if the gains of the four corners are acceptable
+     */
+    bool IsValidCell(uint32_t latIndex, uint32_t lonIndex) const;
+
+    /**
+     * \brief Draw a position with the former rejection algorithm
+     * \param validPositions Valid positions, latitude by latitude
+     * \param random Random variable drawing the position
+     * \return The drawn position
+     */
+    GeoCoordinate DrawReferencePosition(
+        const std::vector<std::pair<double, double>>& validPositions,
+        Ptr<UniformRandomVariable> random) const;
+
+    static const uint32_t LAT_COUNT = 7;
+    static const uint32_t LON_COUNT = 9;
+    const double m_minLat;
+    const double m_minLon;
+    const double m_latInterval;
+    const double m_lonInterval;
+    const double m_minAcceptableGainDb;
+};
+
+SatAntennaPatternRandomPositionTestCase::SatAntennaPatternRandomPositionTestCase()
+    : TestCase("Test satellite antenna gain pattern random positions."),
+      m_minLat(40.0),
+      m_minLon(-1.0),
+      m_latInterval(0.25),
+      m_lonInterval(0.5),
+      m_minAcceptableGainDb(48.0)
+{
+}
+
+double
+SatAntennaPatternRandomPositionTestCase::GetGainDb(uint32_t latIndex, uint32_t lonIndex) const
+{
+    if (latIndex == 3 && lonIndex == 6)
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    double latDistance = latIndex > 3 ? latIndex - 3.0 : 3.0 - latIndex;
+    double lonDistance = lonIndex > 4 ? lonIndex - 4.0 : 4.0 - lonIndex;
+    return 53.0 - 2.0 * latDistance - lonDistance;
+}
+
+bool
+SatAntennaPatternRandomPositionTestCase::IsValidCell(uint32_t latIndex, uint32_t lonIndex) const
+{
+    // NaN gains are never acceptable
+    return latIndex + 1 < LAT_COUNT && lonIndex + 1 < LON_COUNT &&
+           GetGainDb(latIndex, lonIndex) >= m_minAcceptableGainDb &&
+           GetGainDb(latIndex, lonIndex + 1) >= m_minAcceptableGainDb &&
+           GetGainDb(latIndex + 1, lonIndex) >= m_minAcceptableGainDb &&
+           GetGainDb(latIndex + 1, lonIndex + 1) >= m_minAcceptableGainDb;
+}
+
+GeoCoordinate
+SatAntennaPatternRandomPositionTestCase::DrawReferencePosition(
+    const std::vector<std::pair<double, double>>& validPositions,
+    Ptr<UniformRandomVariable> random) const
+{
+    std::pair<double, double> lowerLeftCoord;
+
+    while (true)
+    {
+        lowerLeftCoord = validPositions[random->GetInteger(0, validPositions.size() - 1)];
+
+        std::pair<double, double> testPos(lowerLeftCoord.first + m_latInterval,
+                                          lowerLeftCoord.second);
+        if (std::find(validPositions.begin(), validPositions.end(), testPos) ==
+            validPositions.end())
+        {
+            continue;
+        }
+
+        testPos.second = lowerLeftCoord.second + m_lonInterval;
+        if (std::find(validPositions.begin(), validPositions.end(), testPos) ==
+            validPositions.end())
+        {
+            continue;
+        }
+
+        testPos.first = lowerLeftCoord.first;
+        if (std::find(validPositions.begin(), validPositions.end(), testPos) ==
+            validPositions.end())
+        {
+            continue;
+        }
+
+        break;
+    }
+
+    double latOffset = random->GetValue(0.0, m_latInterval - 0.001);
+    double lonOffset = random->GetValue(0.0, m_lonInterval - 0.001);
+
+    return GeoCoordinate(lowerLeftCoord.first + latOffset,
+                         lowerLeftCoord.second + lonOffset,
+                         0.0,
+                         true);
+}
+
+void
+SatAntennaPatternRandomPositionTestCase::DoRun(void)
+{
+    std::string fileName = CreateTempDirFilename("antenna-pattern-random-test.txt");
+    std::vector<std::pair<double, double>> validPositions;
+    uint32_t validCellCount = 0;
+
+    std::ofstream ofs(fileName.c_str());
+    ofs.precision(17);
+    for (uint32_t latIndex = 0; latIndex < LAT_COUNT; latIndex++)
+    {
+        for (uint32_t lonIndex = 0; lonIndex < LON_COUNT; lonIndex++)
+        {
+            double lat = m_minLat + m_latInterval * latIndex;
+            double lon = m_minLon + m_lonInterval * lonIndex;
+            ofs << lat << " " << lon << " " << GetGainDb(latIndex, lonIndex) << std::endl;
+
+            if (GetGainDb(latIndex, lonIndex) >= m_minAcceptableGainDb)
+            {
+                validPositions.push_back(std::make_pair(lat, lon));
+            }
+            validCellCount += IsValidCell(latIndex, lonIndex);
+        }
+    }
+    ofs.close();
+
+    GeoCoordinate geoPos = GeoCoordinate(0.0, 33.0, 35786000);
+    Ptr<SatMobilityModel> mobility = CreateObject<SatConstantPositionMobilityModel>();
+    mobility->SetGeoPosition(geoPos);
+
+    Config::SetDefault("ns3::SatAntennaGainPattern::MinAcceptableAntennaGainDb",
+                       DoubleValue(m_minAcceptableGainDb));
+    Config::SetDefault("ns3::SatAntennaGainPattern::UseBinaryPattern", BooleanValue(false));
+
+    // the random variable of the pattern is the first one created after the reset
+    // of the stream indexes, as the one of the former algorithm
+    RngSeedManager::SetSeed(7);
+    RngSeedManager::SetRun(3);
+    RngSeedManager::ResetNextStreamIndex();
+    Config::SetDefault("ns3::SatAntennaGainPattern::RandomPositionMode", StringValue("Rejection"));
+    Ptr<SatAntennaGainPattern> rejectionPattern =
+        CreateObject<SatAntennaGainPattern>(fileName, geoPos);
+
+    RngSeedManager::ResetNextStreamIndex();
+    Ptr<UniformRandomVariable> referenceRandom = CreateObject<UniformRandomVariable>();
+
+    for (uint32_t i = 0; i < 500; i++)
+    {
+        GeoCoordinate position = rejectionPattern->GetValidRandomPosition(mobility);
+        GeoCoordinate reference = DrawReferencePosition(validPositions, referenceRandom);
+        NS_TEST_ASSERT_MSG_EQ(position.GetLatitude(),
+                              reference.GetLatitude(),
+                              "Rejection latitude differs from the former one at draw " << i);
+        NS_TEST_ASSERT_MSG_EQ(position.GetLongitude(),
+                              reference.GetLongitude(),
+                              "Rejection longitude differs from the former one at draw " << i);
+    }
+
+    Config::SetDefault("ns3::SatAntennaGainPattern::RandomPositionMode", StringValue("ValidCells"));
+    Ptr<SatAntennaGainPattern> validCellsPattern =
+        CreateObject<SatAntennaGainPattern>(fileName, geoPos);
+
+    std::set<std::pair<uint32_t, uint32_t>> drawnCells;
+    for (uint32_t i = 0; i < 2000; i++)
+    {
+        GeoCoordinate position = validCellsPattern->GetValidRandomPosition(mobility);
+        uint32_t latIndex =
+            static_cast<uint32_t>(std::floor((position.GetLatitude() - m_minLat) / m_latInterval));
+        uint32_t lonIndex =
+            static_cast<uint32_t>(std::floor((position.GetLongitude() - m_minLon) / m_lonInterval));
+
+        NS_TEST_ASSERT_MSG_EQ(IsValidCell(latIndex, lonIndex),
+                              true,
+                              "Position drawn in cell " << latIndex << " " << lonIndex
+                                                        << " without four valid corners");
+        NS_TEST_ASSERT_MSG_EQ(std::isnan(validCellsPattern->GetAntennaGain_lin(position, mobility)),
+                              false,
+                              "Gain of a drawn position cannot be interpolated");
+        drawnCells.insert(std::make_pair(latIndex, lonIndex));
+    }
+
+    NS_TEST_ASSERT_MSG_EQ(drawnCells.size(), validCellCount, "Valid cells not drawn");
+
+    Config::Reset();
+    std::remove(fileName.c_str());
+}
+
 /**
  * \ingroup satellite
  * \brief Satellite antenna pattern test suite
@@ -144,6 +561,8 @@ SatAntennaPatternTestSuite::SatAntennaPatternTestSuite()
     : TestSuite("sat-antenna-gain-pattern-test", UNIT)
 {
     AddTestCase(new SatAntennaPatternTestCase, TestCase::QUICK);
+    AddTestCase(new SatAntennaPatternBinaryTestCase, TestCase::QUICK);
+    AddTestCase(new SatAntennaPatternRandomPositionTestCase, TestCase::QUICK);
 }
 
 // Do allocate an instance of this TestSuite
@@ -0,0 +1,998 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+/**
+ * \file satellite-channel-test.cc
+ * \ingroup satellite
+ * \brief Test cases to unit test the delivery of transmissions by SatChannel.
+ */
+
+#include "../model/satellite-antenna-gain-pattern-container.h"
+#include "../model/satellite-channel.h"
+#include "../model/satellite-const-variables.h"
+#include "../model/satellite-constant-position-mobility-model.h"
+#include "../model/satellite-frame-conf.h"
+#include "../model/satellite-free-space-loss.h"
+#include "../model/satellite-mac-tag.h"
+#include "../model/satellite-node-info.h"
+#include "../model/satellite-phy-rx-carrier-conf.h"
+#include "../model/satellite-phy-rx.h"
+#include "../model/satellite-phy-tx.h"
+#include "../model/satellite-signal-parameters.h"
+#include "../model/satellite-utils.h"
+#include "../model/satellite-wave-form-conf.h"
+#include "../utils/satellite-env-variables.h"
+
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+#include "ns3/enum.h"
+#include "ns3/node.h"
+#include "ns3/packet.h"
+#include "ns3/propagation-delay-model.h"
+#include "ns3/simple-net-device.h"
+#include "ns3/simulator.h"
+#include "ns3/singleton.h"
+#include "ns3/test.h"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Receiver recording the receptions started by the channel, instead of
+ * passing them to its carriers.
+ */
+class SatChannelTestPhyRx : public SatPhyRx
+{
+  public:
+    /**
+     * Reception started by the channel.
+     */
+    typedef struct
+    {
+        Ptr<SatSignalParameters> m_rxParams;
+        uint32_t m_context;
+        Time m_time;
+    } reception_s;
+
+    /**
+     * \brief Record a reception started by the channel
+     * \param rxParams Parameters of the received signal
+     */
+    virtual void StartRx(Ptr<SatSignalParameters> rxParams);
+
+    /**
+     * \brief Receptions recorded since the last clear
+     */
+    std::vector<reception_s> m_receptions;
+};
+
+void
+SatChannelTestPhyRx::StartRx(Ptr<SatSignalParameters> rxParams)
+{
+    reception_s reception;
+    reception.m_rxParams = rxParams;
+    reception.m_context = Simulator::GetContext();
+    reception.m_time = Simulator::Now();
+
+    m_receptions.push_back(reception);
+}
+
+/**
+ * \ingroup satellite
+ * \brief Base class of the channel test cases, creating a forward user channel
+ * with a satellite transmitter and recording receivers.
+ */
+class SatChannelBaseTestCase : public TestCase
+{
+  public:
+    /**
+     * \brief Constructor
+     * \param description Description of the test case
+     */
+    SatChannelBaseTestCase(std::string description);
+    virtual ~SatChannelBaseTestCase();
+
+  protected:
+    /**
+     * \brief Initialize the environment and the carrier configuration of the receivers
+     * \param outputName Name of the test used for the output directory
+     */
+    void SetUp(std::string outputName);
+
+    /**
+     * \brief Dispose the created objects and the simulator
+     */
+    void TearDown();
+
+    /**
+     * \brief Create the forward user channel and the satellite transmitter
+     * \param fwdMode Forwarding mode of the channel
+     * \return created channel
+     */
+    Ptr<SatChannel> CreateChannel(SatChannel::SatChannelFwdMode_e fwdMode);
+
+    /**
+     * \brief Create a receiver and add it to the channel
+     * \param channel Channel of the receiver
+     * \param beamId Beam id of the receiver
+     * \param address MAC address of the receiver
+     * \param position Position of the receiver
+     * \param node Node of the receiver, a new node is created if not given
+     * \return created receiver
+     */
+    Ptr<SatChannelTestPhyRx> CreateReceiver(Ptr<SatChannel> channel,
+                                            uint32_t beamId,
+                                            Mac48Address address,
+                                            GeoCoordinate position,
+                                            Ptr<Node> node = nullptr);
+
+    /**
+     * \brief Create a burst of the satellite transmitter with one packet per destination
+     * \param beamId Beam id of the burst
+     * \param destinations Destination MAC addresses of the packets
+     * \return parameters of the burst
+     */
+    Ptr<SatSignalParameters> CreateBurst(uint32_t beamId,
+                                         const std::vector<Mac48Address>& destinations);
+
+    /**
+     * \brief Clear the receptions recorded by the receivers
+     */
+    void ClearReceptions();
+
+    /**
+     * \brief Check that the receptions of the receivers share the same packet objects
+     * \param receivers Receivers with exactly one reception each
+     * \return true if the packets of all the receptions are the same objects
+     */
+    bool IsSharingPackets(const std::vector<Ptr<SatChannelTestPhyRx>>& receivers) const;
+
+    Ptr<SatPhyTx> m_phyTx;
+    Ptr<SatPhyRxCarrierConf> m_carrierConf;
+    Ptr<SatSuperframeConf> m_superframeConf;
+    std::vector<Ptr<SatChannelTestPhyRx>> m_receivers;
+    std::vector<Ptr<SatChannel>> m_channels;
+
+    /**
+     * \brief Carrier frequency converter of the channel
+     * \return carrier center frequency
+     */
+    static double GetCarrierFrequencyHz(SatEnums::ChannelType_t chType,
+                                        uint32_t freqId,
+                                        uint32_t carrierId);
+
+    /**
+     * \brief Carrier bandwidth converter of the channel and the receivers
+     * \return carrier bandwidth
+     */
+    static double GetCarrierBandwidthHz(SatEnums::ChannelType_t chType,
+                                        uint32_t carrierId,
+                                        SatEnums::CarrierBandwidthType_t bandwidthType);
+};
+
+SatChannelBaseTestCase::SatChannelBaseTestCase(std::string description)
+    : TestCase(description)
+{
+}
+
+SatChannelBaseTestCase::~SatChannelBaseTestCase()
+{
+}
+
+double
+SatChannelBaseTestCase::GetCarrierFrequencyHz(SatEnums::ChannelType_t chType,
+                                              uint32_t freqId,
+                                              uint32_t carrierId)
+{
+    return 20e9 + carrierId * 1e7;
+}
+
+double
+SatChannelBaseTestCase::GetCarrierBandwidthHz(SatEnums::ChannelType_t chType,
+                                              uint32_t carrierId,
+                                              SatEnums::CarrierBandwidthType_t bandwidthType)
+{
+    return 1e7;
+}
+
+void
+SatChannelBaseTestCase::SetUp(std::string outputName)
+{
+    Singleton<SatEnvVariables>::Get()->DoInitialize();
+    Singleton<SatEnvVariables>::Get()->SetOutputVariables(outputName, "", true);
+
+    std::string dataPath = Singleton<SatEnvVariables>::Get()->GetDataPath();
+    Ptr<SatWaveformConf> waveformConf =
+        CreateObject<SatWaveformConf>(dataPath + "/dvbRcs2Waveforms.txt");
+
+    m_superframeConf =
+        SatSuperframeConf::CreateSuperframeConf(SatSuperframeConf::SUPER_FRAME_CONFIG_0);
+    m_superframeConf->Configure(1e9, MilliSeconds(100), waveformConf);
+
+    SatPhyRxCarrierConf::RxCarrierCreateParams_s parameters =
+        SatPhyRxCarrierConf::RxCarrierCreateParams_s();
+    parameters.m_rxTemperatureK = 290.0;
+    parameters.m_chType = SatEnums::FORWARD_USER_CH;
+    parameters.m_linkRegenerationMode = SatEnums::TRANSPARENT;
+    parameters.m_bwConverter = MakeCallback(&SatChannelBaseTestCase::GetCarrierBandwidthHz);
+    parameters.m_carrierCount = 1;
+
+    m_carrierConf = CreateObject<SatPhyRxCarrierConf>(parameters);
+}
+
+void
+SatChannelBaseTestCase::TearDown()
+{
+    for (std::vector<Ptr<SatChannelTestPhyRx>>::iterator it = m_receivers.begin();
+         it != m_receivers.end();
+         ++it)
+    {
+        (*it)->Dispose();
+    }
+
+    for (std::vector<Ptr<SatChannel>>::iterator it = m_channels.begin(); it != m_channels.end();
+         ++it)
+    {
+        (*it)->Dispose();
+    }
+
+    m_phyTx->Dispose();
+
+    m_receivers.clear();
+    m_channels.clear();
+    m_phyTx = nullptr;
+    m_carrierConf = nullptr;
+    m_superframeConf = nullptr;
+
+    Simulator::Destroy();
+
+    Singleton<SatEnvVariables>::Get()->DoDispose();
+}
+
+Ptr<SatChannel>
+SatChannelBaseTestCase::CreateChannel(SatChannel::SatChannelFwdMode_e fwdMode)
+{
+    Ptr<SatChannel> channel = CreateObject<SatChannel>();
+    channel->SetAttribute("ForwardingMode", EnumValue(fwdMode));
+    channel->SetChannelType(SatEnums::FORWARD_USER_CH);
+    channel->SetFrequencyId(0);
+    channel->SetFrequencyConverter(MakeCallback(&SatChannelBaseTestCase::GetCarrierFrequencyHz));
+    channel->SetBandwidthConverter(MakeCallback(&SatChannelBaseTestCase::GetCarrierBandwidthHz));
+    channel->SetPropagationDelayModel(CreateObject<ConstantSpeedPropagationDelayModel>());
+    channel->SetFreeSpaceLoss(CreateObject<SatFreeSpaceLoss>());
+
+    if (!m_phyTx)
+    {
+        Ptr<SatMobilityModel> satMobility = CreateObject<SatConstantPositionMobilityModel>();
+        satMobility->SetGeoPosition(GeoCoordinate(0.0, 33.0, 35786000));
+
+        m_phyTx = CreateObject<SatPhyTx>();
+        m_phyTx->SetMobility(satMobility);
+        m_phyTx->SetMaxAntennaGain_Db(50.0);
+    }
+
+    m_channels.push_back(channel);
+
+    return channel;
+}
+
+Ptr<SatChannelTestPhyRx>
+SatChannelBaseTestCase::CreateReceiver(Ptr<SatChannel> channel,
+                                       uint32_t beamId,
+                                       Mac48Address address,
+                                       GeoCoordinate position,
+                                       Ptr<Node> node)
+{
+    if (!node)
+    {
+        node = CreateObject<Node>();
+    }
+
+    Ptr<SimpleNetDevice> device = CreateObject<SimpleNetDevice>();
+    device->SetAddress(address);
+    node->AddDevice(device);
+
+    Ptr<SatMobilityModel> mobility = CreateObject<SatConstantPositionMobilityModel>();
+    mobility->SetGeoPosition(position);
+
+    Ptr<SatChannelTestPhyRx> phyRx = CreateObject<SatChannelTestPhyRx>();
+    phyRx->SetDevice(device);
+    phyRx->SetMobility(mobility);
+    phyRx->SetMaxAntennaGain_Db(40.0);
+    phyRx->ConfigurePhyRxCarriers(m_carrierConf, m_superframeConf);
+    phyRx->SetNodeInfo(Create<SatNodeInfo>(SatEnums::NT_UT, node->GetId(), address));
+    phyRx->SetBeamId(beamId);
+
+    channel->AddRx(phyRx);
+    m_receivers.push_back(phyRx);
+
+    return phyRx;
+}
+
+Ptr<SatSignalParameters>
+SatChannelBaseTestCase::CreateBurst(uint32_t beamId, const std::vector<Mac48Address>& destinations)
+{
+    Ptr<SatSignalParameters> txParams = Create<SatSignalParameters>();
+    txParams->m_phyTx = m_phyTx;
+    txParams->m_beamId = beamId;
+    txParams->m_carrierId = 0;
+    txParams->m_duration = MilliSeconds(1);
+    txParams->m_txPower_W = 100.0;
+
+    for (std::vector<Mac48Address>::const_iterator it = destinations.begin();
+         it != destinations.end();
+         ++it)
+    {
+        Ptr<Packet> packet = Create<Packet>(100);
+
+        SatMacTag macTag;
+        macTag.SetDestAddress(*it);
+        macTag.SetSourceAddress(Mac48Address::Allocate());
+        packet->AddPacketTag(macTag);
+
+        txParams->m_packetsInBurst.push_back(packet);
+    }
+
+    return txParams;
+}
+
+void
+SatChannelBaseTestCase::ClearReceptions()
+{
+    for (std::vector<Ptr<SatChannelTestPhyRx>>::iterator it = m_receivers.begin();
+         it != m_receivers.end();
+         ++it)
+    {
+        (*it)->m_receptions.clear();
+    }
+}
+
+bool
+SatChannelBaseTestCase::IsSharingPackets(
+    const std::vector<Ptr<SatChannelTestPhyRx>>& receivers) const
+{
+    Ptr<SatSignalParameters> first = receivers.front()->m_receptions.front().m_rxParams;
+
+    for (std::vector<Ptr<SatChannelTestPhyRx>>::const_iterator it = receivers.begin() + 1;
+         it != receivers.end();
+         ++it)
+    {
+        Ptr<SatSignalParameters> rxParams = (*it)->m_receptions.front().m_rxParams;
+
+        if (rxParams == first ||
+            rxParams->m_packetsInBurst.size() != first->m_packetsInBurst.size())
+        {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < first->m_packetsInBurst.size(); ++i)
+        {
+            if (rxParams->m_packetsInBurst[i] != first->m_packetsInBurst[i])
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case for the beam and MAC address indexes of the channel receivers.
+ *
+ *   1.  Create a forward user channel in ONLY_DEST_BEAM mode with one receiver
+ *       in beam 1 and one in beam 2, and transmit in beam 1.
+ *   2.  Move the receiver of beam 2 to beam 1 with SetBeamId after it was added
+ *       to the channel, and transmit in beams 1 and 2.
+ *   3.  Remove the first receiver from the channel and transmit in beam 1.
+ *   4.  Create a channel in ONLY_DEST_NODE mode with two receivers in beam 3,
+ *       and transmit to the first one.
+ *   5.  Change the MAC address of the first receiver with SetNodeInfo after it
+ *       was added to the channel, and transmit to its old and new address.
+ *
+ *   Expected result:
+ *     The transmissions are received by the receivers having the beam id or
+ *     the MAC address of the transmission at the time of the transmission.
+ */
+class SatChannelRxIndexTestCase : public SatChannelBaseTestCase
+{
+  public:
+    SatChannelRxIndexTestCase();
+    virtual ~SatChannelRxIndexTestCase();
+
+  private:
+    virtual void DoRun(void);
+};
+
+SatChannelRxIndexTestCase::SatChannelRxIndexTestCase()
+    : SatChannelBaseTestCase("Test beam and address indexes of the channel receivers.")
+{
+}
+
+SatChannelRxIndexTestCase::~SatChannelRxIndexTestCase()
+{
+}
+
+void
+SatChannelRxIndexTestCase::DoRun(void)
+{
+    SetUp("test-sat-channel-rx-index");
+
+    std::vector<Mac48Address> destinations;
+    destinations.push_back(Mac48Address::GetBroadcast());
+
+    // Beam index
+    Ptr<SatChannel> beamChannel = CreateChannel(SatChannel::ONLY_DEST_BEAM);
+
+    Ptr<SatChannelTestPhyRx> rx1 =
+        CreateReceiver(beamChannel, 1, Mac48Address::Allocate(), GeoCoordinate(50.25, 3.75, 0.0));
+    Ptr<SatChannelTestPhyRx> rx2 =
+        CreateReceiver(beamChannel, 2, Mac48Address::Allocate(), GeoCoordinate(40.0, 10.0, 0.0));
+
+    beamChannel->StartTx(CreateBurst(1, destinations));
+    Simulator::Run();
+
+    NS_TEST_ASSERT_MSG_EQ(rx1->m_receptions.size(), 1, "Receiver of the beam not received");
+    NS_TEST_ASSERT_MSG_EQ(rx2->m_receptions.size(), 0, "Reception in another beam");
+
+    ClearReceptions();
+    rx2->SetBeamId(1);
+
+    beamChannel->StartTx(CreateBurst(1, destinations));
+    beamChannel->StartTx(CreateBurst(2, destinations));
+    Simulator::Run();
+
+    NS_TEST_ASSERT_MSG_EQ(rx1->m_receptions.size(), 1, "Receiver of the beam not received");
+    NS_TEST_ASSERT_MSG_EQ(rx2->m_receptions.size(), 1, "Beam change of a receiver not indexed");
+    NS_TEST_ASSERT_MSG_EQ(rx2->m_receptions.front().m_rxParams->m_beamId,
+                          1,
+                          "Reception in the old beam of a receiver");
+
+    ClearReceptions();
+    beamChannel->RemoveRx(rx1);
+
+    beamChannel->StartTx(CreateBurst(1, destinations));
+    Simulator::Run();
+
+    NS_TEST_ASSERT_MSG_EQ(rx1->m_receptions.size(), 0, "Reception of a removed receiver");
+    NS_TEST_ASSERT_MSG_EQ(rx2->m_receptions.size(), 1, "Receiver of the beam not received");
+
+    // MAC address index
+    Ptr<SatChannel> nodeChannel = CreateChannel(SatChannel::ONLY_DEST_NODE);
+
+    Mac48Address oldAddress = Mac48Address::Allocate();
+    Mac48Address newAddress = Mac48Address::Allocate();
+
+    Ptr<SatChannelTestPhyRx> rx3 =
+        CreateReceiver(nodeChannel, 3, oldAddress, GeoCoordinate(50.25, 3.75, 0.0));
+    Ptr<SatChannelTestPhyRx> rx4 =
+        CreateReceiver(nodeChannel, 3, Mac48Address::Allocate(), GeoCoordinate(51.0, 4.25, 0.0));
+
+    ClearReceptions();
+    destinations.clear();
+    destinations.push_back(oldAddress);
+
+    nodeChannel->StartTx(CreateBurst(3, destinations));
+    Simulator::Run();
+
+    NS_TEST_ASSERT_MSG_EQ(rx3->m_receptions.size(), 1, "Addressed receiver not received");
+    NS_TEST_ASSERT_MSG_EQ(rx4->m_receptions.size(), 0, "Reception of a non-addressed receiver");
+
+    ClearReceptions();
+    rx3->SetNodeInfo(Create<SatNodeInfo>(SatEnums::NT_UT,
+                                         rx3->GetDevice()->GetNode()->GetId(),
+                                         newAddress));
+
+    nodeChannel->StartTx(CreateBurst(3, destinations));
+    Simulator::Run();
+
+    NS_TEST_ASSERT_MSG_EQ(rx3->m_receptions.size(), 0, "Reception with an old MAC address");
+    NS_TEST_ASSERT_MSG_EQ(rx4->m_receptions.size(), 0, "Reception of a non-addressed receiver");
+
+    destinations.clear();
+    destinations.push_back(newAddress);
+
+    nodeChannel->StartTx(CreateBurst(3, destinations));
+    Simulator::Run();
+
+    NS_TEST_ASSERT_MSG_EQ(rx3->m_receptions.size(), 1, "MAC address change not indexed");
+    NS_TEST_ASSERT_MSG_EQ(rx4->m_receptions.size(), 0, "Reception of a non-addressed receiver");
+
+    TearDown();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case for the fan-out of the bursts to the addressed receivers.
+ *
+ *   1.  Create a forward user channel in ONLY_DEST_NODE mode with three receivers
+ *       in beam 1 and two receivers in beam 2, one of them having the MAC address
+ *       of a receiver of beam 1.
+ *   2.  Transmit in beam 1 a burst with packets to the first and the second
+ *       receiver, the first one twice.
+ *   3.  Transmit in beam 1 a burst with a broadcast packet.
+ *   4.  Transmit in beam 1 a burst to the third receiver only.
+ *
+ *   Expected result:
+ *     Each addressed receiver of beam 1, or every receiver of beam 1 with the
+ *     broadcast packet, starts exactly one reception of the burst and the
+ *     other receivers none. The receptions of a burst with several receivers
+ *     have their own signal parameters sharing the same packet objects.
+ */
+class SatChannelFanOutTestCase : public SatChannelBaseTestCase
+{
+  public:
+    SatChannelFanOutTestCase();
+    virtual ~SatChannelFanOutTestCase();
+
+  private:
+    virtual void DoRun(void);
+};
+
+SatChannelFanOutTestCase::SatChannelFanOutTestCase()
+    : SatChannelBaseTestCase("Test fan-out of bursts to the addressed receivers.")
+{
+}
+
+SatChannelFanOutTestCase::~SatChannelFanOutTestCase()
+{
+}
+
+void
+SatChannelFanOutTestCase::DoRun(void)
+{
+    SetUp("test-sat-channel-fan-out");
+
+    Ptr<SatChannel> channel = CreateChannel(SatChannel::ONLY_DEST_NODE);
+
+    Mac48Address address1 = Mac48Address::Allocate();
+    Mac48Address address2 = Mac48Address::Allocate();
+    Mac48Address address3 = Mac48Address::Allocate();
+
+    Ptr<SatChannelTestPhyRx> rx1 =
+        CreateReceiver(channel, 1, address1, GeoCoordinate(50.25, 3.75, 0.0));
+    Ptr<SatChannelTestPhyRx> rx2 =
+        CreateReceiver(channel, 1, address2, GeoCoordinate(51.0, 4.25, 0.0));
+    Ptr<SatChannelTestPhyRx> rx3 =
+        CreateReceiver(channel, 1, address3, GeoCoordinate(49.5, 3.0, 0.0));
+    Ptr<SatChannelTestPhyRx> otherBeamRx =
+        CreateReceiver(channel, 2, Mac48Address::Allocate(), GeoCoordinate(40.0, 10.0, 0.0));
+    Ptr<SatChannelTestPhyRx> otherBeamRx1 =
+        CreateReceiver(channel, 2, address1, GeoCoordinate(41.0, 11.0, 0.0));
+
+    std::vector<Ptr<SatChannelTestPhyRx>> addressed;
+    addressed.push_back(rx1);
+    addressed.push_back(rx2);
+
+    // Unicast packets to two receivers, one of them twice
+    std::vector<Mac48Address> destinations;
+    destinations.push_back(address1);
+    destinations.push_back(address2);
+    destinations.push_back(address1);
+
+    channel->StartTx(CreateBurst(1, destinations));
+    Simulator::Run();
+
+    NS_TEST_ASSERT_MSG_EQ(rx1->m_receptions.size(), 1, "Addressed receiver not received once");
+    NS_TEST_ASSERT_MSG_EQ(rx2->m_receptions.size(), 1, "Addressed receiver not received once");
+    NS_TEST_ASSERT_MSG_EQ(rx3->m_receptions.size(), 0, "Reception of a non-addressed receiver");
+    NS_TEST_ASSERT_MSG_EQ(otherBeamRx->m_receptions.size(), 0, "Reception in another beam");
+    NS_TEST_ASSERT_MSG_EQ(otherBeamRx1->m_receptions.size(),
+                          0,
+                          "Reception of an addressed receiver of another beam");
+    NS_TEST_ASSERT_MSG_EQ(rx1->m_receptions.front().m_rxParams->m_packetsInBurst.size(),
+                          3,
+                          "Unexpected number of packets received");
+    NS_TEST_ASSERT_MSG_EQ(IsSharingPackets(addressed),
+                          true,
+                          "Receptions are not sharing the packets of the burst");
+
+    // Broadcast packet to the whole beam
+    ClearReceptions();
+    addressed.push_back(rx3);
+
+    destinations.clear();
+    destinations.push_back(Mac48Address::GetBroadcast());
+
+    channel->StartTx(CreateBurst(1, destinations));
+    Simulator::Run();
+
+    for (std::vector<Ptr<SatChannelTestPhyRx>>::const_iterator it = addressed.begin();
+         it != addressed.end();
+         ++it)
+    {
+        NS_TEST_ASSERT_MSG_EQ((*it)->m_receptions.size(),
+                              1,
+                              "Receiver of the beam not received broadcast once");
+    }
+    NS_TEST_ASSERT_MSG_EQ(otherBeamRx->m_receptions.size(),
+                          0,
+                          "Broadcast reception in another beam");
+    NS_TEST_ASSERT_MSG_EQ(otherBeamRx1->m_receptions.size(),
+                          0,
+                          "Broadcast reception in another beam");
+    NS_TEST_ASSERT_MSG_EQ(IsSharingPackets(addressed),
+                          true,
+                          "Broadcast receptions are not sharing the packets of the burst");
+
+    // Unicast packet to a single receiver
+    ClearReceptions();
+
+    destinations.clear();
+    destinations.push_back(address3);
+
+    channel->StartTx(CreateBurst(1, destinations));
+    Simulator::Run();
+
+    NS_TEST_ASSERT_MSG_EQ(rx1->m_receptions.size(), 0, "Reception of a non-addressed receiver");
+    NS_TEST_ASSERT_MSG_EQ(rx2->m_receptions.size(), 0, "Reception of a non-addressed receiver");
+    NS_TEST_ASSERT_MSG_EQ(rx3->m_receptions.size(), 1, "Addressed receiver not received once");
+    NS_TEST_ASSERT_MSG_EQ(otherBeamRx->m_receptions.size(), 0, "Reception in another beam");
+
+    TearDown();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case for the batched scheduling of the receptions.
+ *
+ *   1.  Create two forward user channels in ALL_BEAMS mode, one of them with
+ *       batched receptions, with the same set of receivers: two receivers on
+ *       the same node, a receiver of another node at the same position and
+ *       receivers of another beam.
+ *   2.  Transmit the same bursts in both channels.
+ *
+ *   Expected result:
+ *     Every receiver of the batched channel starts the same receptions, at
+ *     the same time and with the same received power, as the corresponding
+ *     receiver of the unbatched channel. All the receptions run in the
+ *     context of the node of their receiver.
+ */
+class SatChannelBatchedRxTestCase : public SatChannelBaseTestCase
+{
+  public:
+    SatChannelBatchedRxTestCase();
+    virtual ~SatChannelBatchedRxTestCase();
+
+  private:
+    virtual void DoRun(void);
+
+    /**
+     * \brief Create the receivers of a channel
+     * \param channel Channel of the receivers
+     * \return created receivers
+     */
+    std::vector<Ptr<SatChannelTestPhyRx>> CreateReceivers(Ptr<SatChannel> channel);
+};
+
+SatChannelBatchedRxTestCase::SatChannelBatchedRxTestCase()
+    : SatChannelBaseTestCase("Test batched scheduling of the receptions.")
+{
+}
+
+SatChannelBatchedRxTestCase::~SatChannelBatchedRxTestCase()
+{
+}
+
+std::vector<Ptr<SatChannelTestPhyRx>>
+SatChannelBatchedRxTestCase::CreateReceivers(Ptr<SatChannel> channel)
+{
+    std::vector<Ptr<SatChannelTestPhyRx>> receivers;
+    Ptr<Node> node = CreateObject<Node>();
+    GeoCoordinate position(50.25, 3.75, 0.0);
+
+    receivers.push_back(CreateReceiver(channel, 1, Mac48Address::Allocate(), position, node));
+    receivers.push_back(CreateReceiver(channel, 1, Mac48Address::Allocate(), position, node));
+    receivers.push_back(CreateReceiver(channel, 1, Mac48Address::Allocate(), position));
+    receivers.push_back(
+        CreateReceiver(channel, 1, Mac48Address::Allocate(), GeoCoordinate(51.0, 4.25, 0.0)));
+    receivers.push_back(
+        CreateReceiver(channel, 2, Mac48Address::Allocate(), GeoCoordinate(40.0, 10.0, 0.0)));
+    receivers.push_back(
+        CreateReceiver(channel, 2, Mac48Address::Allocate(), GeoCoordinate(40.0, 10.0, 0.0)));
+
+    return receivers;
+}
+
+void
+SatChannelBatchedRxTestCase::DoRun(void)
+{
+    SetUp("test-sat-channel-batched-rx");
+
+    Ptr<SatChannel> channel = CreateChannel(SatChannel::ALL_BEAMS);
+    Ptr<SatChannel> batchedChannel = CreateChannel(SatChannel::ALL_BEAMS);
+    batchedChannel->SetAttribute("EnableBatchedRx", BooleanValue(true));
+
+    std::vector<Ptr<SatChannelTestPhyRx>> receivers = CreateReceivers(channel);
+    std::vector<Ptr<SatChannelTestPhyRx>> batchedReceivers = CreateReceivers(batchedChannel);
+
+    std::vector<Mac48Address> destinations;
+    destinations.push_back(receivers[0]->GetAddress());
+    destinations.push_back(Mac48Address::GetBroadcast());
+
+    for (uint32_t beamId = 1; beamId <= 2; ++beamId)
+    {
+        Ptr<SatSignalParameters> txParams = CreateBurst(beamId, destinations);
+        channel->StartTx(txParams);
+        batchedChannel->StartTx(txParams);
+    }
+    Simulator::Run();
+
+    for (uint32_t i = 0; i < receivers.size(); ++i)
+    {
+        const std::vector<SatChannelTestPhyRx::reception_s>& receptions =
+            receivers[i]->m_receptions;
+        const std::vector<SatChannelTestPhyRx::reception_s>& batchedReceptions =
+            batchedReceivers[i]->m_receptions;
+
+        NS_TEST_ASSERT_MSG_EQ(receptions.size(), 2, "Unexpected number of receptions");
+        NS_TEST_ASSERT_MSG_EQ(batchedReceptions.size(),
+                              receptions.size(),
+                              "Unexpected number of batched receptions");
+
+        for (uint32_t j = 0; j < receptions.size(); ++j)
+        {
+            NS_TEST_ASSERT_MSG_EQ(batchedReceptions[j].m_rxParams->m_beamId,
+                                  receptions[j].m_rxParams->m_beamId,
+                                  "Batched receptions in a different order");
+            NS_TEST_ASSERT_MSG_EQ(batchedReceptions[j].m_time,
+                                  receptions[j].m_time,
+                                  "Batched reception at a different time");
+            NS_TEST_ASSERT_MSG_EQ_TOL(batchedReceptions[j].m_rxParams->m_rxPower_W,
+                                      receptions[j].m_rxParams->m_rxPower_W,
+                                      receptions[j].m_rxParams->m_rxPower_W * 1e-12,
+                                      "Batched reception with a different Rx power");
+            NS_TEST_ASSERT_MSG_EQ(receptions[j].m_context,
+                                  receivers[i]->GetDevice()->GetNode()->GetId(),
+                                  "Reception not in the context of the receiver node");
+            NS_TEST_ASSERT_MSG_EQ(batchedReceptions[j].m_context,
+                                  batchedReceivers[i]->GetDevice()->GetNode()->GetId(),
+                                  "Batched reception not in the context of the receiver node");
+        }
+    }
+
+    TearDown();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case for the culling of insignificant interference.
+ *
+ *   1.  Create a forward user channel in ALL_BEAMS mode with interference
+ *       culling, a satellite transmitter with the antenna gain pattern of
+ *       beam 12, and receivers in beam 12, in a beam next to it and in four
+ *       beams far from it.
+ *   2.  Set the interference floor between the highest interference in the
+ *       next beam and the highest interference in the far beams, evaluated
+ *       from the highest gains of the antenna pattern over the beams.
+ *   3.  Transmit a burst in beam 12.
+ *
+ *   Expected result:
+ *     The receivers of beam 12 and of the next beam receive the burst, the
+ *     received power of the latter being below its highest interference. The
+ *     receivers of the far beams do not receive it, and the CulledInterference
+ *     trace reports each of them with its highest interference power, which is
+ *     above the power it would have received.
+ */
+class SatChannelCullingTestCase : public SatChannelBaseTestCase
+{
+  public:
+    SatChannelCullingTestCase();
+    virtual ~SatChannelCullingTestCase();
+
+  private:
+    virtual void DoRun(void);
+
+    /**
+     * \brief Record the interference culled by the channel
+     * \param txBeamId Beam id of the transmission
+     * \param rxBeamId Beam id of the receiver
+     * \param ifPower_W Culled interference power
+     */
+    void CulledInterference(uint32_t txBeamId, uint32_t rxBeamId, double ifPower_W);
+
+    /**
+     * \brief Get the highest interference power of a burst of beam 12 at a receiver
+     * \param txParams Parameters of the burst
+     * \param phyRx Receiver of another beam
+     * \return highest interference power
+     */
+    double GetHighestInterference(Ptr<SatSignalParameters> txParams, Ptr<SatPhyRx> phyRx);
+
+    Ptr<SatAntennaGainPatternContainer> m_antennaGainPatterns;
+    std::map<uint32_t, double> m_culledInterference;
+    uint32_t m_culledCount;
+};
+
+SatChannelCullingTestCase::SatChannelCullingTestCase()
+    : SatChannelBaseTestCase("Test culling of insignificant interference."),
+      m_culledCount(0)
+{
+}
+
+SatChannelCullingTestCase::~SatChannelCullingTestCase()
+{
+}
+
+void
+SatChannelCullingTestCase::CulledInterference(uint32_t txBeamId,
+                                              uint32_t rxBeamId,
+                                              double ifPower_W)
+{
+    NS_TEST_ASSERT_MSG_EQ(txBeamId, 12, "Unexpected beam of the culled transmission");
+
+    m_culledInterference[rxBeamId] = ifPower_W;
+    m_culledCount++;
+}
+
+double
+SatChannelCullingTestCase::GetHighestInterference(Ptr<SatSignalParameters> txParams,
+                                                  Ptr<SatPhyRx> phyRx)
+{
+    double gain_W = m_antennaGainPatterns->GetMaxCoverageGain_lin(phyRx->GetBeamId(), 12);
+    double fsl = CreateObject<SatFreeSpaceLoss>()->GetFsl(
+        m_phyTx->GetMobility(),
+        phyRx->GetMobility(),
+        GetCarrierFrequencyHz(SatEnums::FORWARD_USER_CH, 0, txParams->m_carrierId));
+
+    return txParams->m_txPower_W * gain_W * phyRx->GetAntennaGain(phyRx->GetMobility()) / fsl /
+           phyRx->GetLosses();
+}
+
+void
+SatChannelCullingTestCase::DoRun(void)
+{
+    SetUp("test-sat-channel-culling");
+
+    Ptr<SatChannel> channel = CreateChannel(SatChannel::ALL_BEAMS);
+    channel->SetAttribute("EnableInterferenceCulling", BooleanValue(true));
+    channel->TraceConnectWithoutContext(
+        "CulledInterference",
+        MakeCallback(&SatChannelCullingTestCase::CulledInterference, this));
+
+    Ptr<SatMobilityModel> satMobility = DynamicCast<SatMobilityModel>(m_phyTx->GetMobility());
+
+    m_antennaGainPatterns = CreateObject<SatAntennaGainPatternContainer>();
+    m_antennaGainPatterns->ConfigureBeamsMobility(0, satMobility);
+    m_phyTx->SetAntennaGainPattern(m_antennaGainPatterns->GetAntennaGainPattern(12), satMobility);
+    channel->SetAntennaGainPatterns(m_antennaGainPatterns);
+
+    // Receiver of beam 12 and of the first beam met eastwards from it
+    GeoCoordinate position(50.25, 3.75, 0.0);
+    Ptr<SatChannelTestPhyRx> beamRx =
+        CreateReceiver(channel, 12, Mac48Address::Allocate(), position);
+
+    uint32_t nextBeamId = 12;
+    while (nextBeamId == 12)
+    {
+        position = GeoCoordinate(position.GetLatitude(), position.GetLongitude() + 0.25, 0.0);
+        nextBeamId = m_antennaGainPatterns->GetBestBeamId(0, position, false);
+    }
+    Ptr<SatChannelTestPhyRx> nextBeamRx =
+        CreateReceiver(channel, nextBeamId, Mac48Address::Allocate(), position);
+
+    // Receivers of the beams of the gateways of the reference system
+    std::vector<Ptr<SatChannelTestPhyRx>> farBeamRxs;
+    farBeamRxs.push_back(
+        CreateReceiver(channel, 6, Mac48Address::Allocate(), GeoCoordinate(64.00, 8.25, 0.0)));
+    farBeamRxs.push_back(
+        CreateReceiver(channel, 22, Mac48Address::Allocate(), GeoCoordinate(42.25, -4.50, 0.0)));
+    farBeamRxs.push_back(
+        CreateReceiver(channel, 39, Mac48Address::Allocate(), GeoCoordinate(44.50, 13.50, 0.0)));
+    farBeamRxs.push_back(
+        CreateReceiver(channel, 58, Mac48Address::Allocate(), GeoCoordinate(37.25, 23.75, 0.0)));
+
+    std::vector<Mac48Address> destinations;
+    destinations.push_back(beamRx->GetAddress());
+    Ptr<SatSignalParameters> txParams = CreateBurst(12, destinations);
+
+    // Interference floor between the next beam and the far beams
+    double nextBeamIfPowerDb = SatUtils::LinearToDb(GetHighestInterference(txParams, nextBeamRx));
+    double farBeamIfPowerDb = -std::numeric_limits<double>::infinity();
+    for (std::vector<Ptr<SatChannelTestPhyRx>>::const_iterator it = farBeamRxs.begin();
+         it != farBeamRxs.end();
+         ++it)
+    {
+        farBeamIfPowerDb =
+            std::max(farBeamIfPowerDb,
+                     SatUtils::LinearToDb(GetHighestInterference(txParams, *it)));
+    }
+
+    NS_TEST_ASSERT_MSG_GT(nextBeamIfPowerDb,
+                          farBeamIfPowerDb + 1.0,
+                          "Far beams not isolated from beam 12");
+
+    double carrierBandwidthHz =
+        GetCarrierBandwidthHz(SatEnums::FORWARD_USER_CH, 0, SatEnums::EFFECTIVE_BANDWIDTH);
+    double noisePowerDb =
+        SatUtils::LinearToDb(SatConstVariables::BOLTZMANN_CONSTANT * 290.0 * carrierBandwidthHz);
+    channel->SetAttribute(
+        "InterferenceCullingThresholdDb",
+        DoubleValue((nextBeamIfPowerDb + farBeamIfPowerDb) / 2.0 - noisePowerDb));
+
+    channel->StartTx(txParams);
+    Simulator::Run();
+
+    NS_TEST_ASSERT_MSG_EQ(beamRx->m_receptions.size(), 1, "Receiver of the beam not received");
+    NS_TEST_ASSERT_MSG_EQ(nextBeamRx->m_receptions.size(), 1, "Significant interference culled");
+    NS_TEST_ASSERT_MSG_LT(nextBeamRx->m_receptions.front().m_rxParams->m_rxPower_W,
+                          GetHighestInterference(txParams, nextBeamRx) * (1.0 + 1e-9),
+                          "Received interference above the highest interference of the beam");
+    NS_TEST_ASSERT_MSG_EQ(m_culledCount, farBeamRxs.size(), "Unexpected culled interference");
+
+    for (std::vector<Ptr<SatChannelTestPhyRx>>::const_iterator it = farBeamRxs.begin();
+         it != farBeamRxs.end();
+         ++it)
+    {
+        uint32_t beamId = (*it)->GetBeamId();
+        double ifPower_W = GetHighestInterference(txParams, *it);
+        double rxPower_W = txParams->m_txPower_W * m_phyTx->GetAntennaGain((*it)->GetMobility()) *
+                           (*it)->GetAntennaGain((*it)->GetMobility()) /
+                           CreateObject<SatFreeSpaceLoss>()->GetFsl(
+                               m_phyTx->GetMobility(),
+                               (*it)->GetMobility(),
+                               GetCarrierFrequencyHz(SatEnums::FORWARD_USER_CH, 0, 0)) /
+                           (*it)->GetLosses();
+
+        NS_TEST_ASSERT_MSG_EQ((*it)->m_receptions.size(), 0, "Insignificant interference received");
+        NS_TEST_ASSERT_MSG_EQ(m_culledInterference.count(beamId),
+                              1,
+                              "Culled interference of beam " << beamId << " not traced");
+        NS_TEST_ASSERT_MSG_EQ_TOL(m_culledInterference[beamId],
+                                  ifPower_W,
+                                  ifPower_W * 1e-9,
+                                  "Unexpected culled interference power of beam " << beamId);
+        NS_TEST_ASSERT_MSG_LT(rxPower_W,
+                              ifPower_W * (1.0 + 1e-9),
+                              "Interference of beam " << beamId
+                                                      << " above its highest interference");
+    }
+
+    m_antennaGainPatterns = nullptr;
+
+    TearDown();
+}
+
+/**
+ * \brief Test suite for the satellite channel.
+ */
+class SatChannelTestSuite : public TestSuite
+{
+  public:
+    SatChannelTestSuite();
+};
+
+SatChannelTestSuite::SatChannelTestSuite()
+    : TestSuite("sat-channel-test", UNIT)
+{
+    AddTestCase(new SatChannelRxIndexTestCase, TestCase::QUICK);
+    AddTestCase(new SatChannelFanOutTestCase, TestCase::QUICK);
+    AddTestCase(new SatChannelBatchedRxTestCase, TestCase::QUICK);
+    AddTestCase(new SatChannelCullingTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatChannelTestSuite satChannelTestSuite;
@@ -26,6 +26,8 @@
 
 #include "../model/satellite-channel.h"
 #include "../model/satellite-fading-external-input-trace-container.h"
+#include "../model/satellite-fading-external-input-trace.h"
+#include "../model/satellite-utils.h"
 #include "../utils/satellite-env-variables.h"
 
 #include "ns3/log.h"
@@ -34,10 +36,31 @@
 #include "ns3/test.h"
 #include "ns3/timer.h"
 
+#include <cstdio>
+#include <fstream>
 #include <vector>
 
 using namespace ns3;
 
+/**
+ * \brief Write a fading trace file of 100 samples at 0.1 second interval,
+ * whose linear fading grows from 1.0 by the given step at each sample.
+ * \param fileName Path of the file
+ * \param columns Number of columns of the file
+ * \param step Increase of the linear fading at each sample
+ */
+static void
+WriteFadingTrace(std::string fileName, uint32_t columns, double step)
+{
+    std::ofstream ofs(fileName.c_str(), std::ofstream::out | std::ofstream::binary);
+    for (uint32_t i = 0; i < 100; i++)
+    {
+        float row[3] = {0.1f * i, (float)SatUtils::LinearToDb(1.0 + step * i), 0.0f};
+        ofs.write(reinterpret_cast<const char*>(row), columns * sizeof(float));
+    }
+    ofs.close();
+}
+
 /**
  * \ingroup satellite
  * \brief Test case to unit test satellite fading external input trace and container for these
@@ -137,6 +160,279 @@ SatFadingExternalInputTraceTestCase::DoRun(void)
     Singleton<SatEnvVariables>::Get()->DoDispose();
 }
 
+/**
+ * \ingroup satellite
+ * \brief Test case for the cursor of a fading trace shared between nodes.
+ *
+ *   1.  Write a fading trace whose linear fading grows linearly with time.
+ *   2.  Read the fading from two nodes sharing the trace, forward sample by
+ *       sample, at the same and at interleaved times, then after a jump.
+ *   3.  Restart the simulation and read the fading at earlier times.
+ *
+ *   Expected result:
+ *     The fading read by both nodes is the linear interpolation of the trace
+ *     at the current time, before and after the cursor is rewound.
+ */
+class SatFadingExternalInputTraceCursorTestCase : public TestCase
+{
+  public:
+    SatFadingExternalInputTraceCursorTestCase();
+    virtual ~SatFadingExternalInputTraceCursorTestCase();
+
+  private:
+    virtual void DoRun(void);
+
+    /**
+     * \brief Read the fading of a node at the current time
+     * \param trace Fading trace
+     * \param nodeId Index of the node reading the trace
+     */
+    void ReadFading(Ptr<SatFadingExternalInputTrace> trace, uint32_t nodeId);
+
+    /**
+     * \brief Read the fading of the nodes sharing a trace at the given times
+     * \param trace Fading trace
+     * \param times Read times in seconds
+     * \param nodeIds Index of the node reading the trace at each time
+     */
+    void RunReads(Ptr<SatFadingExternalInputTrace> trace,
+                  const std::vector<double>& times,
+                  const std::vector<uint32_t>& nodeIds);
+
+    std::vector<double> m_times[2];
+    std::vector<double> m_results[2];
+};
+
+SatFadingExternalInputTraceCursorTestCase::SatFadingExternalInputTraceCursorTestCase()
+    : TestCase("Test cursor of a satellite fading external input trace shared between nodes.")
+{
+}
+
+SatFadingExternalInputTraceCursorTestCase::~SatFadingExternalInputTraceCursorTestCase()
+{
+}
+
+void
+SatFadingExternalInputTraceCursorTestCase::ReadFading(Ptr<SatFadingExternalInputTrace> trace,
+                                                      uint32_t nodeId)
+{
+    m_times[nodeId].push_back(Simulator::Now().GetSeconds());
+    m_results[nodeId].push_back(trace->GetFading());
+}
+
+void
+SatFadingExternalInputTraceCursorTestCase::RunReads(Ptr<SatFadingExternalInputTrace> trace,
+                                                    const std::vector<double>& times,
+                                                    const std::vector<uint32_t>& nodeIds)
+{
+    for (uint32_t i = 0; i < times.size(); i++)
+    {
+        Simulator::Schedule(Seconds(times[i]),
+                            &SatFadingExternalInputTraceCursorTestCase::ReadFading,
+                            this,
+                            trace,
+                            nodeIds[i]);
+    }
+
+    Simulator::Run();
+    Simulator::Destroy();
+}
+
+void
+SatFadingExternalInputTraceCursorTestCase::DoRun(void)
+{
+    std::string fileName = CreateTempDirFilename("fading-cursor-test.bin");
+    WriteFadingTrace(fileName, 2, 1.0);
+
+    Ptr<SatFadingExternalInputTrace> trace =
+        Create<SatFadingExternalInputTrace>(SatFadingExternalInputTrace::FT_TWO_COLUMN, fileName);
+    NS_TEST_ASSERT_MSG_EQ(trace->TestFadingTrace(), true, "Fading trace test failed");
+
+    // forward sample by sample, both nodes at the same time then interleaved,
+    // and jumps over many samples
+    double forwardTimes[] = {0.0, 0.05, 0.05, 0.12, 0.17, 0.25, 0.31, 0.38, 7.77, 9.85};
+    uint32_t forwardNodes[] = {0, 0, 1, 1, 0, 1, 0, 1, 0, 1};
+    RunReads(trace,
+             std::vector<double>(forwardTimes, forwardTimes + 10),
+             std::vector<uint32_t>(forwardNodes, forwardNodes + 10));
+
+    // the restarted simulation moves the cursor back
+    double rewindTimes[] = {0.45, 1.26, 2.03, 6.5};
+    uint32_t rewindNodes[] = {1, 0, 1, 0};
+    RunReads(trace,
+             std::vector<double>(rewindTimes, rewindTimes + 4),
+             std::vector<uint32_t>(rewindNodes, rewindNodes + 4));
+
+    for (uint32_t nodeId = 0; nodeId < 2; nodeId++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(m_results[nodeId].size(), 7, "Unexpected number of fading reads");
+
+        for (uint32_t i = 0; i < m_results[nodeId].size(); i++)
+        {
+            // the linear fading grows by 1.0 every 0.1 second
+            double expected = 1.0 + 10.0 * m_times[nodeId][i];
+            NS_TEST_ASSERT_MSG_EQ_TOL(m_results[nodeId][i],
+                                      expected,
+                                      1e-3 * expected,
+                                      "Unexpected fading of node " << nodeId << " at "
+                                                                   << m_times[nodeId][i] << " s");
+        }
+    }
+
+    std::remove(fileName.c_str());
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case for the linear fading file of a fading trace.
+ *
+ *   1.  Write a three column fading trace and convert it to linear format.
+ *   2.  Load the trace and compare its fading with the trace file.
+ *   3.  Overwrite the values of the linear fading file and load the trace
+ *       twice, as done by two nodes of different simulations.
+ *   4.  Edit the trace file in place.
+ *
+ *   Expected result:
+ *     The converted fading matches the trace file, the traces loaded after
+ *     the overwrite both read the mapped linear fading file, and the linear
+ *     fading file is ignored once the trace file has been edited.
+ */
+class SatFadingExternalInputTraceLinearTestCase : public TestCase
+{
+  public:
+    SatFadingExternalInputTraceLinearTestCase();
+    virtual ~SatFadingExternalInputTraceLinearTestCase();
+
+  private:
+    virtual void DoRun(void);
+
+    /**
+     * \brief Store the fading of a trace at the current time
+     * \param trace Fading trace
+     */
+    void ReadFading(Ptr<SatFadingExternalInputTrace> trace);
+
+    /**
+     * \brief Read the fading of a trace at 0.15, 2.0 and 5.55 seconds
+     * \param trace Fading trace
+     * \return fading at the read times
+     */
+    std::vector<double> RunReads(Ptr<SatFadingExternalInputTrace> trace);
+
+    std::vector<double> m_results;
+};
+
+SatFadingExternalInputTraceLinearTestCase::SatFadingExternalInputTraceLinearTestCase()
+    : TestCase("Test linear fading file of a satellite fading external input trace.")
+{
+}
+
+SatFadingExternalInputTraceLinearTestCase::~SatFadingExternalInputTraceLinearTestCase()
+{
+}
+
+void
+SatFadingExternalInputTraceLinearTestCase::ReadFading(Ptr<SatFadingExternalInputTrace> trace)
+{
+    m_results.push_back(trace->GetFading());
+}
+
+std::vector<double>
+SatFadingExternalInputTraceLinearTestCase::RunReads(Ptr<SatFadingExternalInputTrace> trace)
+{
+    m_results.clear();
+
+    double times[] = {0.15, 2.0, 5.55};
+    for (double time : times)
+    {
+        Simulator::Schedule(Seconds(time),
+                            &SatFadingExternalInputTraceLinearTestCase::ReadFading,
+                            this,
+                            trace);
+    }
+
+    Simulator::Run();
+    Simulator::Destroy();
+
+    return m_results;
+}
+
+void
+SatFadingExternalInputTraceLinearTestCase::DoRun(void)
+{
+    std::string fileName = CreateTempDirFilename("fading-linear-test.bin");
+    std::string linearName = SatFadingExternalInputTrace::GetLinearPath(fileName);
+    WriteFadingTrace(fileName, 3, 1.0);
+
+    SatFadingExternalInputTrace::ConvertToLinear(SatFadingExternalInputTrace::FT_THREE_COLUMN,
+                                                 fileName);
+
+    std::vector<double> results =
+        RunReads(Create<SatFadingExternalInputTrace>(SatFadingExternalInputTrace::FT_THREE_COLUMN,
+                                                     fileName));
+    double expected[] = {2.5, 21.0, 56.5};
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ_TOL(results[i],
+                                  expected[i],
+                                  1e-3 * expected[i],
+                                  "Converted fading differs from the trace file");
+    }
+
+    // double the linear values after the header, only a mapped file gives them
+    std::fstream fs(linearName.c_str(),
+                    std::fstream::in | std::fstream::out | std::fstream::binary);
+    NS_TEST_ASSERT_MSG_EQ(fs.is_open(), true, "Linear fading file not written");
+    fs.seekg(0, std::fstream::end);
+    std::streamoff headerSize = (std::streamoff)fs.tellg() - 100 * sizeof(float);
+    NS_TEST_ASSERT_MSG_GT(headerSize, 0, "Linear fading file too small");
+    fs.seekp(headerSize);
+    for (uint32_t i = 0; i < 100; i++)
+    {
+        float value = 2.0f * (1.0f + i);
+        fs.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+    fs.close();
+
+    Ptr<SatFadingExternalInputTrace> firstTrace =
+        Create<SatFadingExternalInputTrace>(SatFadingExternalInputTrace::FT_THREE_COLUMN, fileName);
+    Ptr<SatFadingExternalInputTrace> secondTrace =
+        Create<SatFadingExternalInputTrace>(SatFadingExternalInputTrace::FT_THREE_COLUMN, fileName);
+    std::vector<double> firstResults = RunReads(firstTrace);
+    std::vector<double> secondResults = RunReads(secondTrace);
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ_TOL(firstResults[i],
+                                  2.0 * expected[i],
+                                  2e-3 * expected[i],
+                                  "Linear fading file not mapped");
+        NS_TEST_ASSERT_MSG_EQ_TOL(secondResults[i],
+                                  firstResults[i],
+                                  1e-6 * firstResults[i],
+                                  "Traces of the same file differ");
+    }
+
+    firstTrace = 0;
+    secondTrace = 0;
+
+    // same size edit of the trace file, the linear fading file is stale
+    WriteFadingTrace(fileName, 3, 2.0);
+    results =
+        RunReads(Create<SatFadingExternalInputTrace>(SatFadingExternalInputTrace::FT_THREE_COLUMN,
+                                                     fileName));
+    double editedExpected[] = {4.0, 41.0, 112.0};
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ_TOL(results[i],
+                                  editedExpected[i],
+                                  1e-3 * editedExpected[i],
+                                  "Stale linear fading file used");
+    }
+
+    std::remove(fileName.c_str());
+    std::remove(linearName.c_str());
+}
+
 /**
  * \ingroup satellite
  * \brief Test suite for satellite fading external input trace
@@ -151,6 +447,8 @@ SatFadingExternalInputTraceTestSuite::SatFadingExternalInputTraceTestSuite()
     : TestSuite("sat-fading-external-input-trace-test", UNIT)
 {
     AddTestCase(new SatFadingExternalInputTraceTestCase, TestCase::QUICK);
+    AddTestCase(new SatFadingExternalInputTraceCursorTestCase, TestCase::QUICK);
+    AddTestCase(new SatFadingExternalInputTraceLinearTestCase, TestCase::QUICK);
 }
 
 // Do allocate an instance of this TestSuite
@@ -0,0 +1,152 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+/**
+ * \file satellite-fading-oscillator-bank-test.cc
+ * \ingroup satellite
+ * \brief Test cases to unit test the bank of fading oscillators.
+ */
+
+#include "../model/satellite-fading-oscillator-bank.h"
+#include "../model/satellite-fading-oscillator.h"
+
+#include "ns3/double.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/test.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case comparing the bank of fading oscillators with the
+ * oscillator objects.
+ *
+ *   1.  Create banks of a few oscillators up to more than a block of
+ *       oscillators, and the same oscillators as SatFadingOscillator objects.
+ *   2.  Sum the oscillators at random times, one time at a time and for all
+ *       the times at once.
+ *
+ *   Expected result:
+ *     The complex and cosine wave sums of the banks are the sums of the
+ *     values of the oscillator objects, added in the same order.
+ */
+class SatFadingOscillatorBankTestCase : public TestCase
+{
+  public:
+    SatFadingOscillatorBankTestCase();
+    virtual ~SatFadingOscillatorBankTestCase();
+
+  private:
+    virtual void DoRun(void);
+};
+
+SatFadingOscillatorBankTestCase::SatFadingOscillatorBankTestCase()
+    : TestCase("Test satellite fading oscillator bank.")
+{
+}
+
+SatFadingOscillatorBankTestCase::~SatFadingOscillatorBankTestCase()
+{
+}
+
+void
+SatFadingOscillatorBankTestCase::DoRun(void)
+{
+    Ptr<UniformRandomVariable> uniform = CreateObject<UniformRandomVariable>();
+    uniform->SetAttribute("Min", DoubleValue(-M_PI));
+    uniform->SetAttribute("Max", DoubleValue(M_PI));
+
+    uint32_t counts[4] = {1, 10, 64, 150};
+    for (uint32_t count : counts)
+    {
+        SatFadingOscillatorBank complexBank;
+        SatFadingOscillatorBank cosineWaveBank;
+        std::vector<Ptr<SatFadingOscillator>> complexOscillators;
+        std::vector<Ptr<SatFadingOscillator>> cosineWaveOscillators;
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            std::complex<double> amplitude(uniform->GetValue(), uniform->GetValue());
+            double realAmplitude = uniform->GetValue();
+            double phase = uniform->GetValue();
+            double omega = 20.0 * uniform->GetValue();
+
+            complexBank.Add(amplitude, phase, omega);
+            complexOscillators.push_back(
+                CreateObject<SatFadingOscillator>(amplitude, phase, omega));
+            cosineWaveBank.Add(std::complex<double>(realAmplitude, 0.0), phase, omega);
+            cosineWaveOscillators.push_back(
+                CreateObject<SatFadingOscillator>(realAmplitude, phase, omega));
+        }
+
+        std::vector<double> times;
+        for (uint32_t k = 0; k < 100; k++)
+        {
+            times.push_back(0.01 * k + uniform->GetValue());
+        }
+
+        std::vector<std::complex<double>> complexSums;
+        std::vector<std::complex<double>> cosineWaveSums;
+        complexBank.GetComplexSumsAt(times, complexSums);
+        cosineWaveBank.GetCosineWaveSumsAt(times, cosineWaveSums);
+
+        for (uint32_t k = 0; k < times.size(); k++)
+        {
+            std::complex<double> complexSum(0, 0);
+            std::complex<double> cosineWaveSum(0, 0);
+            for (uint32_t i = 0; i < count; i++)
+            {
+                complexSum += complexOscillators[i]->GetComplexValueAt(times[k]);
+                cosineWaveSum += cosineWaveOscillators[i]->GetCosineWaveValueAt(times[k]);
+            }
+
+            NS_TEST_ASSERT_MSG_EQ(complexBank.GetComplexSumAt(times[k]) == complexSum,
+                                  true,
+                                  "Complex sum of " << count << " oscillators differs");
+            NS_TEST_ASSERT_MSG_EQ(cosineWaveBank.GetCosineWaveSumAt(times[k]) == cosineWaveSum,
+                                  true,
+                                  "Cosine wave sum of " << count << " oscillators differs");
+            NS_TEST_ASSERT_MSG_EQ(complexSums[k] == complexSum,
+                                  true,
+                                  "Batch complex sum of " << count << " oscillators differs");
+            NS_TEST_ASSERT_MSG_EQ(cosineWaveSums[k] == cosineWaveSum,
+                                  true,
+                                  "Batch cosine wave sum of " << count << " oscillators differs");
+        }
+    }
+}
+
+/**
+ * \brief Test suite for the bank of fading oscillators.
+ */
+class SatFadingOscillatorBankTestSuite : public TestSuite
+{
+  public:
+    SatFadingOscillatorBankTestSuite();
+};
+
+SatFadingOscillatorBankTestSuite::SatFadingOscillatorBankTestSuite()
+    : TestSuite("sat-fading-oscillator-bank-test", UNIT)
+{
+    AddTestCase(new SatFadingOscillatorBankTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatFadingOscillatorBankTestSuite satFadingOscillatorBankTestSuite;
@@ -0,0 +1,282 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+/**
+ * \file satellite-input-trace-container-test.cc
+ * \ingroup satellite
+ * \brief Test cases to unit test the time sample look ups of input traces.
+ */
+
+#include "../model/satellite-input-trace-handle.h"
+#include "../model/satellite-rx-cno-input-trace-container.h"
+#include "../utils/satellite-input-fstream-time-double-container.h"
+
+#include "ns3/mac48-address.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+#include <fstream>
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case for the time sample look ups of the input trace container.
+ *
+ *   1.  Write a trace of ten samples, one per second, the last row being
+ *       incomplete.
+ *   2.  Look up the closest samples during a simulation, going past the
+ *       last sample, and interpolate between the samples.
+ *   3.  Look up a sample again in a new simulation.
+ *
+ *   Expected result:
+ *     The closest sample is returned, the later one on ties, the samples
+ *     being looped after the last one. Interpolation is linear. The look ups
+ *     start again from the first sample when the time moves backwards.
+ */
+class SatInputTraceContainerTestCase : public TestCase
+{
+  public:
+    SatInputTraceContainerTestCase();
+    virtual ~SatInputTraceContainerTestCase();
+
+  private:
+    virtual void DoRun(void);
+
+    /**
+     * \brief Look up the closest sample and the interpolated values
+     * \param interpolate whether to interpolate, the time being within the samples
+     */
+    void LookUp(bool interpolate);
+
+    Ptr<SatInputFileStreamTimeDoubleContainer> m_closestContainer;
+    Ptr<SatInputFileStreamTimeDoubleContainer> m_interpolationContainer;
+    std::vector<double> m_closestValues;
+    std::vector<double> m_interpolatedValues;
+};
+
+SatInputTraceContainerTestCase::SatInputTraceContainerTestCase()
+    : TestCase("Test satellite input trace container look ups.")
+{
+}
+
+SatInputTraceContainerTestCase::~SatInputTraceContainerTestCase()
+{
+}
+
+void
+SatInputTraceContainerTestCase::LookUp(bool interpolate)
+{
+    m_closestValues.push_back(m_closestContainer->ProceedToNextClosestTimeSampleValue(1));
+    std::vector<double> row = m_closestContainer->ProceedToNextClosestTimeSample();
+    NS_TEST_ASSERT_MSG_EQ(row.size(), 3, "Unexpected row size");
+    NS_TEST_ASSERT_MSG_EQ(row[1], m_closestValues.back(), "Row and value look ups differ");
+
+    if (interpolate)
+    {
+        m_interpolatedValues.push_back(
+            m_interpolationContainer->InterpolateBetweenClosestTimeSamples().at(2));
+    }
+}
+
+void
+SatInputTraceContainerTestCase::DoRun(void)
+{
+    std::string fileName = CreateTempDirFilename("input-trace-test.txt");
+    std::ofstream ofs(fileName.c_str());
+    for (uint32_t i = 1; i <= 10; i++)
+    {
+        ofs << i << " " << 10 * i << "\t" << -1.0 * i << "\n";
+    }
+    ofs << 11 << " " << 110;
+    ofs.close();
+
+    m_closestContainer =
+        CreateObject<SatInputFileStreamTimeDoubleContainer>(fileName, std::ios::in, 3);
+    m_interpolationContainer =
+        CreateObject<SatInputFileStreamTimeDoubleContainer>(fileName, std::ios::in, 3);
+
+    double times[4] = {0.4, 2.5, 2.75, 6.2};
+    for (double time : times)
+    {
+        Simulator::Schedule(Seconds(time), &SatInputTraceContainerTestCase::LookUp, this, true);
+    }
+    Simulator::Schedule(Seconds(12.4), &SatInputTraceContainerTestCase::LookUp, this, false);
+    Simulator::Run();
+    Simulator::Destroy();
+
+    Simulator::Schedule(Seconds(3.1), &SatInputTraceContainerTestCase::LookUp, this, true);
+    Simulator::Run();
+    Simulator::Destroy();
+
+    double closestValues[6] = {10, 30, 30, 60, 20, 30};
+    double interpolatedValues[5] = {-1.0, -2.5, -2.75, -6.2, -3.1};
+
+    NS_TEST_ASSERT_MSG_EQ(m_closestValues.size(), 6, "Unexpected number of look ups");
+    NS_TEST_ASSERT_MSG_EQ(m_interpolatedValues.size(), 5, "Unexpected number of interpolations");
+    for (uint32_t i = 0; i < 6; i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(m_closestValues[i],
+                              closestValues[i],
+                              "Unexpected closest sample at look up " << i);
+    }
+    for (uint32_t i = 0; i < 5; i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ_TOL(m_interpolatedValues[i],
+                                  interpolatedValues[i],
+                                  1e-9,
+                                  "Unexpected interpolated value at interpolation " << i);
+    }
+
+    m_closestContainer->Dispose();
+    m_interpolationContainer->Dispose();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case for the handles to the Rx C/N0 input traces.
+ *
+ *   1.  Set a constant C/N0 for a first address and a trace file for a second
+ *       address of a Rx C/N0 input trace container.
+ *   2.  Resolve a handle for the addresses in turn, as done by the channel for
+ *       the receptions, and read the C/N0.
+ *   3.  Change the constant C/N0, then reset the container and set the C/N0
+ *       again, as done when a configuration is applied.
+ *
+ *   Expected result:
+ *     The handle is resolved again on each address change only, and reads the
+ *     constant C/N0 or the trace of its address. It is resolved again after
+ *     the C/N0 is changed and after the container is reset, reading the new
+ *     C/N0.
+ */
+class SatInputTraceHandleTestCase : public TestCase
+{
+  public:
+    SatInputTraceHandleTestCase();
+    virtual ~SatInputTraceHandleTestCase();
+
+  private:
+    virtual void DoRun(void);
+
+    /**
+     * \brief Resolve the handle for an address unless already resolved
+     * \param address address of the reception
+     * \return C/N0 read through the handle
+     */
+    double Read(const Address& address);
+
+    Ptr<SatRxCnoInputTraceContainer> m_container;
+    SatInputTraceHandle m_handle;
+    uint32_t m_resolutions;
+};
+
+SatInputTraceHandleTestCase::SatInputTraceHandleTestCase()
+    : TestCase("Test satellite input trace handles."),
+      m_resolutions(0)
+{
+}
+
+SatInputTraceHandleTestCase::~SatInputTraceHandleTestCase()
+{
+}
+
+double
+SatInputTraceHandleTestCase::Read(const Address& address)
+{
+    if (!m_handle.IsResolvedFor(address, m_container->GetGeneration()))
+    {
+        m_handle = m_container->GetHandle(std::make_pair(address, SatEnums::FORWARD_USER_CH));
+        m_resolutions++;
+    }
+
+    return m_handle.GetValue();
+}
+
+void
+SatInputTraceHandleTestCase::DoRun(void)
+{
+    std::string fileName = CreateTempDirFilename("input-trace-handle-test.txt");
+    std::ofstream ofs(fileName.c_str());
+    for (uint32_t i = 0; i < 5; i++)
+    {
+        ofs << i << " " << 1000.0 * (i + 1) << "\n";
+    }
+    ofs.close();
+
+    Address constantAddress = Mac48Address("00:00:00:00:00:01");
+    Address traceAddress = Mac48Address("00:00:00:00:00:02");
+
+    m_container = CreateObject<SatRxCnoInputTraceContainer>();
+    m_container->SetRxCno(std::make_pair(constantAddress, SatEnums::FORWARD_USER_CH), 1e7);
+    m_container->SetRxCnoFile(std::make_pair(traceAddress, SatEnums::FORWARD_USER_CH), fileName);
+
+    NS_TEST_ASSERT_MSG_EQ(m_handle.IsResolvedFor(constantAddress, m_container->GetGeneration()),
+                          false,
+                          "Default handle resolved");
+
+    // resolved on the address changes only
+    NS_TEST_ASSERT_MSG_EQ(Read(constantAddress), 1e7, "Unexpected constant C/N0");
+    NS_TEST_ASSERT_MSG_EQ(Read(constantAddress), 1e7, "Unexpected constant C/N0");
+    NS_TEST_ASSERT_MSG_EQ(m_resolutions, 1, "Handle not kept for the same address");
+    NS_TEST_ASSERT_MSG_EQ(Read(traceAddress), 1000.0, "Unexpected C/N0 of the trace");
+    NS_TEST_ASSERT_MSG_EQ(Read(traceAddress), 1000.0, "Unexpected C/N0 of the trace");
+    NS_TEST_ASSERT_MSG_EQ(Read(constantAddress), 1e7, "Unexpected constant C/N0");
+    NS_TEST_ASSERT_MSG_EQ(m_resolutions, 3, "Handle not resolved on address changes");
+
+    // a new constant C/N0 is read by the handles resolved before
+    m_container->SetRxCno(std::make_pair(constantAddress, SatEnums::FORWARD_USER_CH), 2e7);
+    NS_TEST_ASSERT_MSG_EQ(Read(constantAddress), 2e7, "Changed C/N0 not read");
+    NS_TEST_ASSERT_MSG_EQ(m_resolutions, 4, "Handle not resolved after a C/N0 change");
+
+    // the configuration is applied on a reset container
+    uint32_t generation = m_container->GetGeneration();
+    m_container->Reset();
+    NS_TEST_ASSERT_MSG_EQ(m_handle.IsResolvedFor(constantAddress, m_container->GetGeneration()),
+                          false,
+                          "Handle still resolved after a reset");
+    NS_TEST_ASSERT_MSG_GT(m_container->GetGeneration(), generation, "Generation not increased");
+    m_container->SetRxCno(std::make_pair(constantAddress, SatEnums::FORWARD_USER_CH), 3e7);
+    NS_TEST_ASSERT_MSG_EQ(Read(constantAddress), 3e7, "C/N0 of the new configuration not read");
+    NS_TEST_ASSERT_MSG_EQ(m_resolutions, 5, "Handle not resolved after a reset");
+
+    m_handle = SatInputTraceHandle();
+    m_container->Dispose();
+    m_container = 0;
+    Simulator::Destroy();
+}
+
+/**
+ * \brief Test suite for the input trace containers.
+ */
+class SatInputTraceContainerTestSuite : public TestSuite
+{
+  public:
+    SatInputTraceContainerTestSuite();
+};
+
+SatInputTraceContainerTestSuite::SatInputTraceContainerTestSuite()
+    : TestSuite("sat-input-trace-container-test", UNIT)
+{
+    AddTestCase(new SatInputTraceContainerTestCase, TestCase::QUICK);
+    AddTestCase(new SatInputTraceHandleTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatInputTraceContainerTestSuite satInputTraceContainerTestSuite;
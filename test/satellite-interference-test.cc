@@ -28,6 +28,8 @@
 
 // Include a header file from your module to test.
 #include "../model/satellite-constant-interference.h"
+#include "../model/satellite-fragment-vector.h"
+#include "../model/satellite-per-packet-energy-interference.h"
 #include "../model/satellite-per-packet-interference.h"
 #include "../model/satellite-traced-interference.h"
 #include "../utils/satellite-env-variables.h"
@@ -36,12 +38,15 @@
 #include "ns3/config.h"
 #include "ns3/double.h"
 #include "ns3/log.h"
+#include "ns3/random-variable-stream.h"
 #include "ns3/simulator.h"
 #include "ns3/singleton.h"
 #include "ns3/string.h"
 #include "ns3/test.h"
 #include "ns3/timer.h"
 
+#include <algorithm>
+
 using namespace ns3;
 
 /**
@@ -102,11 +107,13 @@ SatConstantInterferenceTestCase::DoRun(void)
 
     interference->NotifyRxStart(event);
 
-    std::vector<std::pair<double, double>> power = interference->Calculate(event);
+    SatFragmentVector power = interference->Calculate(event);
 
-    NS_TEST_ASSERT_MSG_EQ(1, power.size(), "Calculated power returned more than one fragment");
-    NS_TEST_ASSERT_MSG_EQ(1.0, power[0].first, "Calculated power does not span the whole packet");
-    NS_TEST_ASSERT_MSG_EQ(100, power[0].second, "Calculated power not correct");
+    NS_TEST_ASSERT_MSG_EQ(1, power.GetSize(), "Calculated power returned more than one fragment");
+    NS_TEST_ASSERT_MSG_EQ(1.0,
+                          power.GetDuration(0),
+                          "Calculated power does not span the whole packet");
+    NS_TEST_ASSERT_MSG_EQ(100, power.GetValue(0), "Calculated power not correct");
 
     interference->NotifyRxEnd(event);
 
@@ -117,9 +124,11 @@ SatConstantInterferenceTestCase::DoRun(void)
 
     power = interference->Calculate(event);
 
-    NS_TEST_ASSERT_MSG_EQ(1, power.size(), "Calculated power returned more than one fragment");
-    NS_TEST_ASSERT_MSG_EQ(1.0, power[0].first, "Calculated power does not span the whole packet");
-    NS_TEST_ASSERT_MSG_EQ(50, power[0].second, "Calculated power not correct");
+    NS_TEST_ASSERT_MSG_EQ(1, power.GetSize(), "Calculated power returned more than one fragment");
+    NS_TEST_ASSERT_MSG_EQ(1.0,
+                          power.GetDuration(0),
+                          "Calculated power does not span the whole packet");
+    NS_TEST_ASSERT_MSG_EQ(50, power.GetValue(0), "Calculated power not correct");
 
     Singleton<SatEnvVariables>::Get()->DoDispose();
 }
@@ -129,7 +138,8 @@ SatConstantInterferenceTestCase::DoRun(void)
  * \brief Test case to unit test satellite per packet interference model.
  *
  * This case tests that SatPerPacketInterference object can be created successfully and interference
- * value calculated correctly.
+ * value calculated correctly. The same case is run for SatPerPacketEnergyInterference, which
+ * must produce the same values.
  *  1.  Create SatPerPacketInterference object.
  *  2.  Create events, add them to SatPerPacketInterference about them.
  *  3.  Notify SatPerPacketInterference about the event wanted to calculate.
@@ -142,7 +152,9 @@ SatConstantInterferenceTestCase::DoRun(void)
 class SatPerPacketInterferenceTestCase : public TestCase
 {
   public:
-    SatPerPacketInterferenceTestCase();
+    SatPerPacketInterferenceTestCase(Ptr<SatInterference> interference,
+                                     std::string name,
+                                     std::string simTag);
     virtual ~SatPerPacketInterferenceTestCase();
 
     // adds interference to model object
@@ -156,16 +168,21 @@ class SatPerPacketInterferenceTestCase : public TestCase
 
   private:
     virtual void DoRun(void);
-    Ptr<SatPerPacketInterference> m_interference;
+    Ptr<SatInterference> m_interference;
+    std::string m_simTag;
     Ptr<SatInterference::InterferenceChangeEvent> m_rxEvent[4];
     uint32_t m_rxIndex;
     double finalPower[4];
 };
 
-SatPerPacketInterferenceTestCase::SatPerPacketInterferenceTestCase()
-    : TestCase("Test satellite per packet interference model.")
+SatPerPacketInterferenceTestCase::SatPerPacketInterferenceTestCase(
+    Ptr<SatInterference> interference,
+    std::string name,
+    std::string simTag)
+    : TestCase("Test satellite " + name + " interference model."),
+      m_interference(interference),
+      m_simTag(simTag)
 {
-    m_interference = CreateObject<SatPerPacketInterference>();
     m_rxIndex = 0;
 
     for (int i = 0; i < 4; i++)
@@ -207,11 +224,13 @@ SatPerPacketInterferenceTestCase::StartReceiver(Time duration, double power, Add
 void
 SatPerPacketInterferenceTestCase::Receive(uint32_t rxIndex)
 {
-    std::vector<std::pair<double, double>> ifPower = m_interference->Calculate(m_rxEvent[rxIndex]);
-    NS_TEST_ASSERT_MSG_EQ(1, ifPower.size(), "Calculated power returned more than one fragment");
-    NS_TEST_ASSERT_MSG_EQ(1.0, ifPower[0].first, "Calculated power does not span the whole packet");
+    SatFragmentVector ifPower = m_interference->Calculate(m_rxEvent[rxIndex]);
+    NS_TEST_ASSERT_MSG_EQ(1, ifPower.GetSize(), "Calculated power returned more than one fragment");
+    NS_TEST_ASSERT_MSG_EQ(1.0,
+                          ifPower.GetDuration(0),
+                          "Calculated power does not span the whole packet");
 
-    finalPower[rxIndex] = ifPower[0].second;
+    finalPower[rxIndex] = ifPower.GetValue(0);
     m_interference->NotifyRxEnd(m_rxEvent[rxIndex]);
 }
 
@@ -220,7 +239,7 @@ SatPerPacketInterferenceTestCase::DoRun(void)
 {
     // Set simulation output details
     Singleton<SatEnvVariables>::Get()->DoInitialize();
-    Singleton<SatEnvVariables>::Get()->SetOutputVariables("test-sat-if-unit", "perpacket", true);
+    Singleton<SatEnvVariables>::Get()->SetOutputVariables("test-sat-if-unit", m_simTag, true);
 
     // simulate interferences and receiving (4 receivers), adding and calculation done in callback
     // routines
@@ -301,6 +320,209 @@ SatPerPacketInterferenceTestCase::DoRun(void)
     Singleton<SatEnvVariables>::Get()->DoDispose();
 }
 
+/**
+ * \ingroup satellite
+ * \brief Test case comparing satellite per packet energy interference model against per packet
+ * interference model.
+ *
+ * This case tests that SatPerPacketEnergyInterference calculates the same interference values as
+ * SatPerPacketInterference under a random load of overlapping transmissions.
+ *  1.  Create SatPerPacketInterference and SatPerPacketEnergyInterference objects.
+ *  2.  Add the same random events to both objects, some of them being received.
+ *  3.  At the end of each received event calculate interference with both objects.
+ *
+ *  Expected result:
+ *   Both objects should calculate the same interference values within floating point precision.
+ *
+ */
+class SatPerPacketEnergyInterferenceTestCase : public TestCase
+{
+  public:
+    SatPerPacketEnergyInterferenceTestCase();
+    virtual ~SatPerPacketEnergyInterferenceTestCase();
+
+    // adds interference to both model objects and schedules receiving when requested
+    void Add(Time duration, double power, bool receive);
+
+    // calculates interference with both model objects and stops receiving.
+    void Receive(Ptr<SatInterference::InterferenceChangeEvent> refEvent,
+                 Ptr<SatInterference::InterferenceChangeEvent> event);
+
+  private:
+    virtual void DoRun(void);
+    Ptr<SatPerPacketInterference> m_refInterference;
+    Ptr<SatPerPacketEnergyInterference> m_interference;
+    uint32_t m_received;
+};
+
+SatPerPacketEnergyInterferenceTestCase::SatPerPacketEnergyInterferenceTestCase()
+    : TestCase("Test satellite per packet energy interference model against per packet model."),
+      m_received(0)
+{
+    m_refInterference = CreateObject<SatPerPacketInterference>();
+    m_interference = CreateObject<SatPerPacketEnergyInterference>();
+}
+
+SatPerPacketEnergyInterferenceTestCase::~SatPerPacketEnergyInterferenceTestCase()
+{
+}
+
+void
+SatPerPacketEnergyInterferenceTestCase::Add(Time duration, double power, bool receive)
+{
+    Address address = Mac48Address::ConvertFrom(Mac48Address::Allocate());
+    Ptr<SatInterference::InterferenceChangeEvent> refEvent =
+        m_refInterference->Add(duration, power, address);
+    Ptr<SatInterference::InterferenceChangeEvent> event =
+        m_interference->Add(duration, power, address);
+
+    if (receive)
+    {
+        m_refInterference->NotifyRxStart(refEvent);
+        m_interference->NotifyRxStart(event);
+
+        Simulator::Schedule(duration,
+                            &SatPerPacketEnergyInterferenceTestCase::Receive,
+                            this,
+                            refEvent,
+                            event);
+    }
+}
+
+void
+SatPerPacketEnergyInterferenceTestCase::Receive(
+    Ptr<SatInterference::InterferenceChangeEvent> refEvent,
+    Ptr<SatInterference::InterferenceChangeEvent> event)
+{
+    SatFragmentVector refPower = m_refInterference->Calculate(refEvent);
+    SatFragmentVector power = m_interference->Calculate(event);
+
+    NS_TEST_ASSERT_MSG_EQ(1, power.GetSize(), "Calculated power returned more than one fragment");
+    NS_TEST_ASSERT_MSG_EQ(1.0,
+                          power.GetDuration(0),
+                          "Calculated power does not span the whole packet");
+
+    double tolerance = 1e-9 * std::max(refPower.GetValue(0), event->GetRxPower());
+    NS_TEST_ASSERT_MSG_EQ_TOL(power.GetValue(0),
+                              refPower.GetValue(0),
+                              tolerance,
+                              "Final power differs from per packet model");
+
+    m_refInterference->NotifyRxEnd(refEvent);
+    m_interference->NotifyRxEnd(event);
+    m_received++;
+}
+
+void
+SatPerPacketEnergyInterferenceTestCase::DoRun(void)
+{
+    // Set simulation output details
+    Singleton<SatEnvVariables>::Get()->DoInitialize();
+    Singleton<SatEnvVariables>::Get()->SetOutputVariables("test-sat-if-unit",
+                                                          "perpacketenergy-compare",
+                                                          true);
+
+    Ptr<UniformRandomVariable> random = CreateObject<UniformRandomVariable>();
+    random->SetStream(1);
+
+    // overlapping bursts of random length and power, every fourth one being received
+    uint32_t expectedReceived = 0;
+    for (uint32_t i = 0; i < 500; i++)
+    {
+        Time start = Time(random->GetInteger(0, 20000));
+        Time duration = Time(random->GetInteger(100, 2000));
+        double power = random->GetValue(1e-12, 1e-9);
+        bool receive = (i % 4 == 0);
+
+        Simulator::Schedule(start,
+                            &SatPerPacketEnergyInterferenceTestCase::Add,
+                            this,
+                            duration,
+                            power,
+                            receive);
+
+        if (receive)
+        {
+            expectedReceived++;
+        }
+    }
+
+    Simulator::Run();
+
+    NS_TEST_ASSERT_MSG_EQ(m_received, expectedReceived, "Not all packets were received");
+
+    Simulator::Destroy();
+    Singleton<SatEnvVariables>::Get()->DoDispose();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case to unit test satellite fragment vector.
+ *
+ * This case tests that SatFragmentVector stores fragments and computes their weighted sum.
+ *  1.  Create SatFragmentVector and add fragments of various count.
+ *  2.  Compute weighted sum of the fragments.
+ *  3.  Clear the vector and reuse it.
+ *
+ *  Expected result:
+ *   Weighted sum should match the sum of durations multiplied by values for any fragment count.
+ *
+ */
+class SatFragmentVectorTestCase : public TestCase
+{
+  public:
+    SatFragmentVectorTestCase();
+    virtual ~SatFragmentVectorTestCase();
+
+  private:
+    virtual void DoRun(void);
+};
+
+SatFragmentVectorTestCase::SatFragmentVectorTestCase()
+    : TestCase("Test satellite fragment vector.")
+{
+}
+
+SatFragmentVectorTestCase::~SatFragmentVectorTestCase()
+{
+}
+
+void
+SatFragmentVectorTestCase::DoRun(void)
+{
+    SatFragmentVector single(1.0, 42.0);
+    NS_TEST_ASSERT_MSG_EQ(single.GetSize(), 1, "Single fragment vector size incorrect");
+    NS_TEST_ASSERT_MSG_EQ(single.GetWeightedSum(), 42.0, "Single fragment weighted sum incorrect");
+
+    SatFragmentVector fragments;
+    NS_TEST_ASSERT_MSG_EQ(fragments.IsEmpty(), true, "Default fragment vector not empty");
+    NS_TEST_ASSERT_MSG_EQ(fragments.GetWeightedSum(), 0.0, "Empty weighted sum not zero");
+
+    // weighted sums over a growing number of fragments
+    for (uint32_t count = 1; count <= 11; count++)
+    {
+        fragments.Clear();
+        double expected = 0.0;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            double duration = 1.0 / count;
+            double value = 1.0 + i;
+            fragments.Add(duration, value);
+            expected += duration * value;
+        }
+
+        NS_TEST_ASSERT_MSG_EQ(fragments.GetSize(), count, "Fragment count incorrect");
+        NS_TEST_ASSERT_MSG_EQ_TOL(fragments.GetWeightedSum(),
+                                  expected,
+                                  1e-12,
+                                  "Weighted sum incorrect");
+    }
+
+    fragments.SetValue(0, 0.0);
+    NS_TEST_ASSERT_MSG_EQ(fragments.GetValue(0), 0.0, "Fragment value not updated");
+    NS_TEST_ASSERT_MSG_EQ(fragments.GetDuration(0), 1.0 / 11, "Fragment duration changed");
+}
+
 /**
  * \ingroup satellite
  * \brief Test suite for Satellite interference unit test cases.
@@ -314,8 +536,18 @@ class SatInterferenceTestSuite : public TestSuite
 SatInterferenceTestSuite::SatInterferenceTestSuite()
     : TestSuite("sat-if-unit-test", UNIT)
 {
+    AddTestCase(new SatFragmentVectorTestCase, TestCase::QUICK);
     AddTestCase(new SatConstantInterferenceTestCase, TestCase::QUICK);
-    AddTestCase(new SatPerPacketInterferenceTestCase, TestCase::QUICK);
+    AddTestCase(new SatPerPacketInterferenceTestCase(CreateObject<SatPerPacketInterference>(),
+                                                     "per packet",
+                                                     "perpacket"),
+                TestCase::QUICK);
+    AddTestCase(
+        new SatPerPacketInterferenceTestCase(CreateObject<SatPerPacketEnergyInterference>(),
+                                             "per packet energy",
+                                             "perpacketenergy"),
+        TestCase::QUICK);
+    AddTestCase(new SatPerPacketEnergyInterferenceTestCase, TestCase::QUICK);
 }
 
 // Do allocate an instance of this TestSuite
@@ -0,0 +1,213 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+/**
+ * \file satellite-link-budget-cache-test.cc
+ * \ingroup satellite
+ * \brief Test cases to unit test the link budget cache of SatChannel.
+ */
+
+#include "../model/satellite-antenna-gain-pattern-container.h"
+#include "../model/satellite-constant-position-mobility-model.h"
+#include "../model/satellite-link-budget-cache.h"
+#include "../model/satellite-phy-rx.h"
+#include "../model/satellite-phy-tx.h"
+#include "../utils/satellite-env-variables.h"
+
+#include "ns3/constant-position-mobility-model.h"
+#include "ns3/simulator.h"
+#include "ns3/singleton.h"
+#include "ns3/test.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case for the hits and invalidation of the link budget cache.
+ *
+ *   1.  Add the link budget of a satellite to UT link to the cache.
+ *   2.  Look it up again for the same and for another carrier.
+ *   3.  Move the UT, change the maximum antenna gains and set an antenna gain
+ *       pattern, looking the link budget up after each change.
+ *   4.  Add a link budget of a receiver without satellite mobility model.
+ *
+ *   Expected result:
+ *     The link budget is returned unchanged while neither end moves nor has
+ *     its antenna reconfigured, and is never returned after such a change
+ *     until it is added again. Links whose ends do not both have a satellite
+ *     mobility model are not cached.
+ */
+class SatLinkBudgetCacheTestCase : public TestCase
+{
+  public:
+    SatLinkBudgetCacheTestCase();
+    virtual ~SatLinkBudgetCacheTestCase();
+
+  private:
+    virtual void DoRun(void);
+
+    /**
+     * \brief Calculate the link budget of a link and add it to the cache
+     * \param phyTx transmitter
+     * \param phyRx receiver
+     * \return calculated link budget
+     */
+    SatLinkBudgetCache::linkBudget_s AddLinkBudget(Ptr<SatPhyTx> phyTx, Ptr<SatPhyRx> phyRx);
+
+    SatLinkBudgetCache m_cache;
+};
+
+SatLinkBudgetCacheTestCase::SatLinkBudgetCacheTestCase()
+    : TestCase("Test satellite channel link budget cache.")
+{
+}
+
+SatLinkBudgetCacheTestCase::~SatLinkBudgetCacheTestCase()
+{
+}
+
+SatLinkBudgetCache::linkBudget_s
+SatLinkBudgetCacheTestCase::AddLinkBudget(Ptr<SatPhyTx> phyTx, Ptr<SatPhyRx> phyRx)
+{
+    SatLinkBudgetCache::linkBudget_s linkBudget;
+    linkBudget.m_txAntennaGain_W = phyTx->GetAntennaGain(phyRx->GetMobility());
+    linkBudget.m_rxAntennaGain_W = phyRx->GetAntennaGain(phyRx->GetMobility());
+    linkBudget.m_fsl = 1e20;
+
+    m_cache.Add(phyTx, phyRx, 0, linkBudget);
+
+    return linkBudget;
+}
+
+void
+SatLinkBudgetCacheTestCase::DoRun(void)
+{
+    Singleton<SatEnvVariables>::Get()->DoInitialize();
+    Singleton<SatEnvVariables>::Get()->SetOutputVariables("test-sat-link-budget-cache", "", true);
+
+    Ptr<SatMobilityModel> satMobility = CreateObject<SatConstantPositionMobilityModel>();
+    satMobility->SetGeoPosition(GeoCoordinate(0.0, 33.0, 35786000));
+    Ptr<SatMobilityModel> utMobility = CreateObject<SatConstantPositionMobilityModel>();
+    utMobility->SetGeoPosition(GeoCoordinate(50.25, 3.75, 0.0));
+
+    Ptr<SatPhyTx> phyTx = CreateObject<SatPhyTx>();
+    phyTx->SetMobility(satMobility);
+    phyTx->SetMaxAntennaGain_Db(50.0);
+    Ptr<SatPhyRx> phyRx = CreateObject<SatPhyRx>();
+    phyRx->SetMobility(utMobility);
+    phyRx->SetMaxAntennaGain_Db(40.0);
+
+    SatLinkBudgetCache::linkBudget_s cached;
+
+    // Hits of an unchanged link
+    NS_TEST_ASSERT_MSG_EQ(m_cache.Get(phyTx, phyRx, 0, Seconds(1), cached),
+                          false,
+                          "Hit in an empty cache");
+    SatLinkBudgetCache::linkBudget_s linkBudget = AddLinkBudget(phyTx, phyRx);
+    NS_TEST_ASSERT_MSG_EQ(m_cache.Get(phyTx, phyRx, 0, Seconds(1), cached), true, "No cache hit");
+    NS_TEST_ASSERT_MSG_EQ(cached.m_txAntennaGain_W,
+                          linkBudget.m_txAntennaGain_W,
+                          "Unexpected Tx antenna gain");
+    NS_TEST_ASSERT_MSG_EQ(cached.m_rxAntennaGain_W,
+                          linkBudget.m_rxAntennaGain_W,
+                          "Unexpected Rx antenna gain");
+    NS_TEST_ASSERT_MSG_EQ(cached.m_fsl, linkBudget.m_fsl, "Unexpected free space loss");
+    NS_TEST_ASSERT_MSG_EQ(m_cache.Get(phyTx, phyRx, 1, Seconds(1), cached),
+                          false,
+                          "Hit for another carrier");
+
+    // Course change of the receiver
+    utMobility->SetGeoPosition(GeoCoordinate(64.0, 8.25, 0.0));
+    NS_TEST_ASSERT_MSG_EQ(m_cache.Get(phyTx, phyRx, 0, Seconds(1), cached),
+                          false,
+                          "Hit after a course change");
+    AddLinkBudget(phyTx, phyRx);
+    NS_TEST_ASSERT_MSG_EQ(m_cache.Get(phyTx, phyRx, 0, Seconds(1), cached),
+                          true,
+                          "No cache hit after a course change");
+
+    // Reconfiguration of the maximum antenna gains
+    phyTx->SetMaxAntennaGain_Db(52.0);
+    NS_TEST_ASSERT_MSG_EQ(m_cache.Get(phyTx, phyRx, 0, Seconds(1), cached),
+                          false,
+                          "Hit after a Tx antenna gain change");
+    AddLinkBudget(phyTx, phyRx);
+    phyRx->SetMaxAntennaGain_Db(42.0);
+    NS_TEST_ASSERT_MSG_EQ(m_cache.Get(phyTx, phyRx, 0, Seconds(1), cached),
+                          false,
+                          "Hit after an Rx antenna gain change");
+
+    // Antenna gain pattern of the transmitter
+    linkBudget = AddLinkBudget(phyTx, phyRx);
+    SatAntennaGainPatternContainer gpContainer;
+    phyTx->SetAntennaGainPattern(gpContainer.GetAntennaGainPattern(6), satMobility);
+    NS_TEST_ASSERT_MSG_EQ(m_cache.Get(phyTx, phyRx, 0, Seconds(1), cached),
+                          false,
+                          "Hit after setting an antenna gain pattern");
+    SatLinkBudgetCache::linkBudget_s patternLinkBudget = AddLinkBudget(phyTx, phyRx);
+    NS_TEST_ASSERT_MSG_NE(patternLinkBudget.m_txAntennaGain_W,
+                          linkBudget.m_txAntennaGain_W,
+                          "Antenna gain pattern not used");
+    NS_TEST_ASSERT_MSG_EQ(m_cache.Get(phyTx, phyRx, 0, Seconds(1), cached),
+                          true,
+                          "No cache hit with an antenna gain pattern");
+    NS_TEST_ASSERT_MSG_EQ(cached.m_txAntennaGain_W,
+                          patternLinkBudget.m_txAntennaGain_W,
+                          "Unexpected Tx antenna gain with an antenna gain pattern");
+
+    // Receiver without satellite mobility model
+    Ptr<SatPhyRx> otherPhyRx = CreateObject<SatPhyRx>();
+    otherPhyRx->SetMobility(CreateObject<ConstantPositionMobilityModel>());
+    linkBudget.m_fsl = 1e20;
+    m_cache.Add(phyTx, otherPhyRx, 0, linkBudget);
+    NS_TEST_ASSERT_MSG_EQ(m_cache.Get(phyTx, otherPhyRx, 0, Seconds(1), cached),
+                          false,
+                          "Hit for a receiver without satellite mobility model");
+    NS_TEST_ASSERT_MSG_EQ(m_cache.GetSize(), 1, "Unexpected number of entries");
+
+    m_cache.Clear();
+    NS_TEST_ASSERT_MSG_EQ(m_cache.GetSize(), 0, "Cache not cleared");
+
+    phyTx->Dispose();
+    phyRx->Dispose();
+    otherPhyRx->Dispose();
+
+    Simulator::Destroy();
+
+    Singleton<SatEnvVariables>::Get()->DoDispose();
+}
+
+/**
+ * \brief Test suite for the link budget cache.
+ */
+class SatLinkBudgetCacheTestSuite : public TestSuite
+{
+  public:
+    SatLinkBudgetCacheTestSuite();
+};
+
+SatLinkBudgetCacheTestSuite::SatLinkBudgetCacheTestSuite()
+    : TestSuite("sat-link-budget-cache-test", UNIT)
+{
+    AddTestCase(new SatLinkBudgetCacheTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatLinkBudgetCacheTestSuite satLinkBudgetCacheTestSuite;
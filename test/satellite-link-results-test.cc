@@ -25,12 +25,25 @@
  * \brief Test cases for satellite link results.
  */
 
+#include <ns3/double.h>
+#include <ns3/enum.h>
 #include <ns3/log.h>
 #include <ns3/ptr.h>
+#include <ns3/satellite-carrier-error-model.h>
 #include <ns3/satellite-link-results.h>
 #include <ns3/satellite-look-up-table.h>
+#include <ns3/satellite-mutual-information-table.h>
+#include <ns3/satellite-table-bundle.h>
+#include <ns3/satellite-utils.h>
+#include <ns3/singleton.h>
+#include <ns3/string.h>
+#include <ns3/system-path.h>
 #include <ns3/test.h>
 
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
 NS_LOG_COMPONENT_DEFINE("TestLinkResult");
 
 #define SAT_LINK_RESULTS_PRECISION 0.00011
@@ -155,6 +168,609 @@ SatLinkResultsDvbS2TestCase::DoRun()
                               "Difference of " << (actualBler - m_bler) << " from reference BLER");
 }
 
+/*
+ * CARRIER ERROR MODEL TEST CASE
+ */
+
+/**
+ * \brief Test case comparing the BLER of a resolved SatCarrierErrorModel with
+ *        the BLER queried from the link results.
+ *
+ * Forward link, return link and regenerative return feeder link carriers are
+ * resolved and the BLER of every table is compared on an SINR sweep.
+ */
+class SatCarrierErrorModelTestCase : public TestCase
+{
+  public:
+    /**
+     * \param linkResultsRtn pre-loaded DVB-RCS2 link results
+     * \param linkResultsFwd pre-loaded DVB-S2 link results
+     */
+    SatCarrierErrorModelTestCase(Ptr<SatLinkResultsDvbRcs2> linkResultsRtn,
+                                 Ptr<SatLinkResultsDvbS2> linkResultsFwd);
+
+  private:
+    virtual void DoRun();
+    Ptr<SatLinkResultsDvbRcs2> m_linkResultsRtn;
+    Ptr<SatLinkResultsDvbS2> m_linkResultsFwd;
+};
+
+SatCarrierErrorModelTestCase::SatCarrierErrorModelTestCase(
+    Ptr<SatLinkResultsDvbRcs2> linkResultsRtn,
+    Ptr<SatLinkResultsDvbS2> linkResultsFwd)
+    : TestCase("Comparing SatCarrierErrorModel with link results"),
+      m_linkResultsRtn(linkResultsRtn),
+      m_linkResultsFwd(linkResultsFwd)
+{
+}
+
+void
+SatCarrierErrorModelTestCase::DoRun()
+{
+    SatCarrierErrorModel fwdModel;
+    fwdModel.Resolve(m_linkResultsFwd, SatEnums::FORWARD_USER_CH, SatEnums::TRANSPARENT);
+
+    SatCarrierErrorModel feederModel;
+    feederModel.Resolve(m_linkResultsFwd,
+                        SatEnums::RETURN_FEEDER_CH,
+                        SatEnums::REGENERATION_NETWORK);
+
+    SatEnums::SatBbFrameType_t frameTypes[] = {SatEnums::NORMAL_FRAME, SatEnums::SHORT_FRAME};
+
+    for (const auto& table : m_linkResultsFwd->GetLookUpTables())
+    {
+        for (SatEnums::SatBbFrameType_t frameType : frameTypes)
+        {
+            for (double sinrDb = -5.0; sinrDb <= 20.0; sinrDb += 0.05)
+            {
+                double sinr = SatUtils::DbToLinear(sinrDb);
+                double bler =
+                    m_linkResultsFwd->GetBler(table.first, frameType, SatUtils::LinearToDb(sinr));
+
+                NS_TEST_ASSERT_MSG_EQ(fwdModel.GetBler(sinr, table.first, 0, frameType),
+                                      bler,
+                                      "Forward BLER differs for MODCOD " << table.first);
+                NS_TEST_ASSERT_MSG_EQ(feederModel.GetBler(sinr, table.first, 0, frameType),
+                                      bler,
+                                      "Regenerative feeder BLER differs for MODCOD "
+                                          << table.first);
+            }
+        }
+    }
+
+    SatCarrierErrorModel rtnModel;
+    rtnModel.Resolve(m_linkResultsRtn, SatEnums::RETURN_USER_CH, SatEnums::TRANSPARENT);
+
+    SatEnums::SatModcod_t modcods[] = {SatEnums::SAT_MODCOD_QPSK_1_TO_2,
+                                       SatEnums::SAT_MODCOD_8PSK_2_TO_3,
+                                       SatEnums::SAT_MODCOD_16APSK_3_TO_4};
+
+    for (const auto& table : m_linkResultsRtn->GetLookUpTables())
+    {
+        for (SatEnums::SatModcod_t modcod : modcods)
+        {
+            double divisor = SatUtils::GetCodingRate(modcod) * SatUtils::GetModulatedBits(modcod);
+
+            for (double sinrDb = -5.0; sinrDb <= 20.0; sinrDb += 0.05)
+            {
+                double sinr = SatUtils::DbToLinear(sinrDb);
+                double bler =
+                    m_linkResultsRtn->GetBler(table.first, SatUtils::LinearToDb(sinr / divisor));
+
+                NS_TEST_ASSERT_MSG_EQ(
+                    rtnModel.GetBler(sinr, modcod, table.first, SatEnums::NORMAL_FRAME),
+                    bler,
+                    "Return BLER differs for waveform " << table.first);
+            }
+        }
+    }
+}
+
+/*
+ * LOOK UP TABLE MODE TEST CASE
+ */
+
+/**
+ * \brief Test case comparing the BLER look up modes of SatLookUpTable with
+ *        the original linear scan of the table.
+ *
+ * A table with irregular Es/No spacing and steep BLER drops is written to a
+ * temporary file and loaded once per look up mode. BLER is then queried on a
+ * dense Es/No sweep spanning beyond both ends of the table. The test fails if
+ * any look up mode differs from the linear scan by more than 1e-12.
+ */
+class SatLookUpTableModeTestCase : public TestCase
+{
+  public:
+    SatLookUpTableModeTestCase();
+
+  private:
+    virtual void DoRun();
+
+    /**
+     * \brief Reference BLER computed by a linear scan of the table rows
+     */
+    double GetReferenceBler(double esNoDb) const;
+
+    std::vector<double> m_esNoDb;
+    std::vector<double> m_bler;
+};
+
+SatLookUpTableModeTestCase::SatLookUpTableModeTestCase()
+    : TestCase("Comparing SatLookUpTable look up modes with a linear scan")
+{
+    double esNoDb[] = {-3.0, -2.5, -2.45, -2.0, -1.2, -1.19, -0.5, 0.0, 0.01, 1.7, 3.0};
+    double bler[] = {1.0, 1.0, 0.9, 0.5, 0.1, 1.0e-2, 1.0e-3, 5.0e-4, 1.0e-5, 1.0e-6, 0.0};
+    m_esNoDb.assign(esNoDb, esNoDb + 11);
+    m_bler.assign(bler, bler + 11);
+}
+
+double
+SatLookUpTableModeTestCase::GetReferenceBler(double esNoDb) const
+{
+    uint32_t n = m_esNoDb.size();
+
+    if (esNoDb < m_esNoDb[0])
+    {
+        return 1.0;
+    }
+
+    uint32_t i = 1;
+    while ((i < n) && (esNoDb > m_esNoDb[i]))
+    {
+        i++;
+    }
+
+    if (i >= n)
+    {
+        return 0.0;
+    }
+
+    return SatUtils::Interpolate(esNoDb, m_esNoDb[i - 1], m_esNoDb[i], m_bler[i - 1], m_bler[i]);
+}
+
+void
+SatLookUpTableModeTestCase::DoRun()
+{
+    std::string fileName = CreateTempDirFilename("lut-mode-test.txt");
+    std::ofstream ofs(fileName.c_str());
+    ofs.precision(17);
+    for (uint32_t i = 0; i < m_esNoDb.size(); i++)
+    {
+        ofs << m_esNoDb[i] << " " << m_bler[i] << std::endl;
+    }
+    ofs.close();
+
+    SatLookUpTable::LookUpMode modes[] = {SatLookUpTable::LUT_BINARY_SEARCH,
+                                          SatLookUpTable::LUT_UNIFORM_GRID};
+
+    for (SatLookUpTable::LookUpMode mode : modes)
+    {
+        Ptr<SatLookUpTable> table = CreateObject<SatLookUpTable>(fileName);
+        table->SetAttribute("LookUpMode", EnumValue(mode));
+
+        // include the exact row values, which sit on the segment boundaries
+        for (double esNoDb : m_esNoDb)
+        {
+            NS_TEST_ASSERT_MSG_EQ_TOL(table->GetBler(esNoDb),
+                                      GetReferenceBler(esNoDb),
+                                      1e-12,
+                                      "BLER differs from linear scan at row " << esNoDb);
+        }
+
+        for (double esNoDb = -4.0; esNoDb <= 4.0; esNoDb += 0.0007)
+        {
+            NS_TEST_ASSERT_MSG_EQ_TOL(table->GetBler(esNoDb),
+                                      GetReferenceBler(esNoDb),
+                                      1e-12,
+                                      "BLER differs from linear scan at " << esNoDb);
+        }
+
+        NS_TEST_ASSERT_MSG_EQ_TOL(table->GetEsNoDb(0.5),
+                                  -2.0,
+                                  1e-12,
+                                  "Es/No target incorrect for a table row");
+        NS_TEST_ASSERT_MSG_EQ_TOL(table->GetEsNoDb(0.3),
+                                  -1.6,
+                                  1e-12,
+                                  "Es/No target incorrect between table rows");
+    }
+
+    // a range many orders of magnitude above the row spacing caps the grid size
+    std::string wideFileName = CreateTempDirFilename("lut-mode-wide-test.txt");
+    std::ofstream wideOfs(wideFileName.c_str());
+    wideOfs.precision(17);
+    wideOfs << -1.0e6 << " " << 1.0 << std::endl;
+    wideOfs << 0.0 << " " << 0.5 << std::endl;
+    wideOfs << 1.0e-12 << " " << 0.0 << std::endl;
+    wideOfs.close();
+
+    Ptr<SatLookUpTable> exact = CreateObject<SatLookUpTable>(wideFileName);
+    exact->SetAttribute("LookUpMode", EnumValue(SatLookUpTable::LUT_BINARY_SEARCH));
+    Ptr<SatLookUpTable> grid = CreateObject<SatLookUpTable>(wideFileName);
+    grid->SetAttribute("LookUpMode", EnumValue(SatLookUpTable::LUT_UNIFORM_GRID));
+
+    double wideEsNoDb[] = {-2.0e6, -1.0e6, -5.0e5, -1.0, 0.0, 5.0e-13, 1.0e-12, 1.0};
+    for (double esNoDb : wideEsNoDb)
+    {
+        NS_TEST_ASSERT_MSG_EQ_TOL(grid->GetBler(esNoDb),
+                                  exact->GetBler(esNoDb),
+                                  1e-12,
+                                  "BLER of a wide table differs between modes at " << esNoDb);
+    }
+
+    // a single row has no grid and is searched exactly
+    std::string singleFileName = CreateTempDirFilename("lut-mode-single-test.txt");
+    std::ofstream singleOfs(singleFileName.c_str());
+    singleOfs << 0.0 << " " << 0.5 << std::endl;
+    singleOfs.close();
+
+    exact = CreateObject<SatLookUpTable>(singleFileName);
+    exact->SetAttribute("LookUpMode", EnumValue(SatLookUpTable::LUT_BINARY_SEARCH));
+    grid = CreateObject<SatLookUpTable>(singleFileName);
+    grid->SetAttribute("LookUpMode", EnumValue(SatLookUpTable::LUT_UNIFORM_GRID));
+
+    double singleEsNoDb[] = {-1.0, 0.0, 1.0};
+    for (double esNoDb : singleEsNoDb)
+    {
+        NS_TEST_ASSERT_MSG_EQ_TOL(grid->GetBler(esNoDb),
+                                  exact->GetBler(esNoDb),
+                                  1e-12,
+                                  "BLER of a single row table differs between modes at " << esNoDb);
+    }
+}
+
+/*
+ * MUTUAL INFORMATION LOOK UP MODE TEST CASE
+ */
+
+/**
+ * \brief Test case comparing the look up modes of SatMutualInformationTable
+ *        with the original linear scan of the table.
+ *
+ * A table with irregular SNIR spacing and flat runs at both ends is written
+ * to a temporary file and loaded once per look up mode. The normalized symbol
+ * information is queried on a dense SNIR sweep spanning beyond both ends of
+ * the table: the resampled grid may differ from the linear scan near the rows
+ * by a fraction of the grid step. The inverse look up and the effective SNIR
+ * of fragment vectors, longer than the batches of the table, are compared
+ * with the same computation done on the linear scan. The linear scan is
+ * checked to be the default mode, and tables of a single row or of equal
+ * symbol information to give the same results in both modes.
+ */
+class SatMutualInformationModeTestCase : public TestCase
+{
+  public:
+    SatMutualInformationModeTestCase();
+
+  private:
+    virtual void DoRun();
+
+    /**
+     * \brief Reference symbol information computed by a linear scan of the table rows
+     */
+    double GetReferenceSymbolInformation(double snirDb) const;
+
+    /**
+     * \brief Reference SNIR computed by a linear scan of the table rows
+     */
+    double GetReferenceSnirDb(double symbolInformation) const;
+
+    std::vector<double> m_snirDb;
+    std::vector<double> m_symbolInformation;
+};
+
+SatMutualInformationModeTestCase::SatMutualInformationModeTestCase()
+    : TestCase("Comparing SatMutualInformationTable look up modes with a linear scan")
+{
+    double snirDb[] = {-10.0, -6.0, -5.47, -3.0, 0.0, 0.23, 2.11, 5.0, 8.0, 12.0, 15.0};
+    double symbolInformation[] = {0.0, 0.0, 0.05, 0.2, 0.45, 0.47, 0.62, 0.85, 0.98, 1.0, 1.0};
+    m_snirDb.assign(snirDb, snirDb + 11);
+    m_symbolInformation.assign(symbolInformation, symbolInformation + 11);
+}
+
+double
+SatMutualInformationModeTestCase::GetReferenceSymbolInformation(double snirDb) const
+{
+    uint32_t n = m_snirDb.size();
+
+    if (snirDb < m_snirDb[0])
+    {
+        return 0.0;
+    }
+
+    uint32_t i = 1;
+    while ((i < n) && (snirDb > m_snirDb[i]))
+    {
+        i++;
+    }
+
+    if (i >= n)
+    {
+        return 1.0;
+    }
+
+    return SatUtils::Interpolate(snirDb,
+                                 m_snirDb[i - 1],
+                                 m_snirDb[i],
+                                 m_symbolInformation[i - 1],
+                                 m_symbolInformation[i]);
+}
+
+double
+SatMutualInformationModeTestCase::GetReferenceSnirDb(double symbolInformation) const
+{
+    uint32_t n = m_symbolInformation.size();
+
+    if (symbolInformation <= m_symbolInformation[0])
+    {
+        return -1.0e10;
+    }
+
+    if (symbolInformation > m_symbolInformation[n - 1])
+    {
+        return m_snirDb[n - 1];
+    }
+
+    uint32_t i = 1;
+    while (symbolInformation > m_symbolInformation[i])
+    {
+        i++;
+    }
+
+    return SatUtils::Interpolate(symbolInformation,
+                                 m_symbolInformation[i - 1],
+                                 m_symbolInformation[i],
+                                 m_snirDb[i - 1],
+                                 m_snirDb[i]);
+}
+
+void
+SatMutualInformationModeTestCase::DoRun()
+{
+    std::string fileName = CreateTempDirFilename("mi-mode-test.txt");
+    std::ofstream ofs(fileName.c_str());
+    ofs.precision(17);
+    for (uint32_t i = 0; i < m_snirDb.size(); i++)
+    {
+        ofs << m_snirDb[i] << " " << m_symbolInformation[i] << std::endl;
+    }
+    ofs.close();
+
+    const double beta = 1.5;
+
+    // fragment vectors spanning the whole table, with more fragments than a batch
+    std::vector<SatFragmentVector> fragments(3);
+    uint32_t counts[] = {1, 7, 150};
+    for (uint32_t f = 0; f < fragments.size(); f++)
+    {
+        for (uint32_t i = 0; i < counts[f]; i++)
+        {
+            double position = (i + 1) * 0.618034;
+            double snirDb = -12.0 + 29.0 * (position - std::floor(position));
+            fragments[f].Add(1.0 / counts[f], beta * SatUtils::DbToLinear(snirDb));
+        }
+    }
+
+    SatMutualInformationTable::LookUpMode modes[] = {SatMutualInformationTable::MI_LINEAR_SCAN,
+                                                     SatMutualInformationTable::MI_UNIFORM_GRID};
+
+    for (SatMutualInformationTable::LookUpMode mode : modes)
+    {
+        Ptr<SatMutualInformationTable> table = CreateObject<SatMutualInformationTable>(fileName);
+        table->SetAttribute("LookUpMode", EnumValue(mode));
+        table->SetAttribute("Beta", DoubleValue(beta));
+
+        // the grid is 16 times finer than the smallest row spacing, its error
+        // only comes from the cells holding a row
+        double tolerance = (mode == SatMutualInformationTable::MI_LINEAR_SCAN) ? 1e-12 : 2.5e-4;
+
+        // include the exact row values, where the resampling error is the largest
+        for (double snirDb : m_snirDb)
+        {
+            NS_TEST_ASSERT_MSG_EQ_TOL(table->GetNormalizedSymbolInformation(snirDb),
+                                      GetReferenceSymbolInformation(snirDb),
+                                      tolerance,
+                                      "Symbol information differs from linear scan at row "
+                                          << snirDb);
+        }
+
+        for (double snirDb = -12.0; snirDb <= 17.0; snirDb += 0.0007)
+        {
+            NS_TEST_ASSERT_MSG_EQ_TOL(table->GetNormalizedSymbolInformation(snirDb),
+                                      GetReferenceSymbolInformation(snirDb),
+                                      tolerance,
+                                      "Symbol information differs from linear scan at "
+                                          << snirDb);
+        }
+
+        for (double symbolInformation = -0.01; symbolInformation <= 1.0;
+             symbolInformation += 0.00013)
+        {
+            NS_TEST_ASSERT_MSG_EQ_TOL(table->GetSnirDb(symbolInformation),
+                                      GetReferenceSnirDb(symbolInformation),
+                                      1e-12,
+                                      "SNIR differs from linear scan at " << symbolInformation);
+        }
+
+        for (const SatFragmentVector& gamma : fragments)
+        {
+            double meanSymbolInformation = 0.0;
+            for (std::size_t i = 0; i < gamma.GetSize(); i++)
+            {
+                meanSymbolInformation +=
+                    gamma.GetDuration(i) * GetReferenceSymbolInformation(
+                                               SatUtils::LinearToDb(gamma.GetValue(i) / beta));
+            }
+            double referenceSnirDb =
+                SatUtils::LinearToDb(beta) + GetReferenceSnirDb(meanSymbolInformation);
+
+            // the symbol information error is amplified by the inverse slope,
+            // up to 200 dB per unit on the flattest rows of the table
+            NS_TEST_ASSERT_MSG_EQ_TOL(SatUtils::LinearToDb(table->GetEffectiveSnir(gamma)),
+                                      referenceSnirDb,
+                                      (mode == SatMutualInformationTable::MI_LINEAR_SCAN)
+                                          ? 1e-9
+                                          : 200.0 * tolerance,
+                                      "Effective SNIR differs from linear scan for "
+                                          << gamma.GetSize() << " fragments");
+        }
+    }
+
+    // the approximate grid is opt-in
+    EnumValue defaultMode;
+    CreateObject<SatMutualInformationTable>(fileName)->GetAttribute("LookUpMode", defaultMode);
+    NS_TEST_ASSERT_MSG_EQ(defaultMode.Get(),
+                          SatMutualInformationTable::MI_LINEAR_SCAN,
+                          "The default look up mode is not exact");
+
+    // a single row, or rows of equal symbol information, have no grid and are searched exactly
+    std::string singleFileName = CreateTempDirFilename("mi-mode-single-test.txt");
+    std::ofstream singleOfs(singleFileName.c_str());
+    singleOfs << 0.0 << " " << 0.5 << std::endl;
+    singleOfs.close();
+
+    std::string flatFileName = CreateTempDirFilename("mi-mode-flat-test.txt");
+    std::ofstream flatOfs(flatFileName.c_str());
+    flatOfs << -1.0 << " " << 0.5 << std::endl;
+    flatOfs << 1.0 << " " << 0.5 << std::endl;
+    flatOfs.close();
+
+    std::string degenerateFileNames[] = {singleFileName, flatFileName};
+    for (const std::string& degenerateFileName : degenerateFileNames)
+    {
+        Ptr<SatMutualInformationTable> exact =
+            CreateObject<SatMutualInformationTable>(degenerateFileName);
+        exact->SetAttribute("LookUpMode", EnumValue(SatMutualInformationTable::MI_LINEAR_SCAN));
+        Ptr<SatMutualInformationTable> grid =
+            CreateObject<SatMutualInformationTable>(degenerateFileName);
+        grid->SetAttribute("LookUpMode", EnumValue(SatMutualInformationTable::MI_UNIFORM_GRID));
+
+        double snirDbs[] = {-2.0, -1.0, 0.0, 1.0, 2.0};
+        for (double snirDb : snirDbs)
+        {
+            NS_TEST_ASSERT_MSG_EQ(grid->GetNormalizedSymbolInformation(snirDb),
+                                  exact->GetNormalizedSymbolInformation(snirDb),
+                                  "Symbol information of " << degenerateFileName
+                                                           << " differs between modes at "
+                                                           << snirDb);
+        }
+
+        double symbolInformations[] = {0.0, 0.5, 0.75, 1.0};
+        for (double symbolInformation : symbolInformations)
+        {
+            NS_TEST_ASSERT_MSG_EQ(grid->GetSnirDb(symbolInformation),
+                                  exact->GetSnirDb(symbolInformation),
+                                  "SNIR of " << degenerateFileName << " differs between modes at "
+                                             << symbolInformation);
+        }
+    }
+}
+
+/*
+ * TABLE BUNDLE TEST CASE
+ */
+
+/**
+ * \brief Test case loading a SatLookUpTable from a binary table bundle.
+ *
+ * Two link results text files of the same name in different folders are
+ * written in a bundle, then removed: the tables must still load from the
+ * bundle, each with its own content, and stay valid once the bundle is
+ * released. The text files are then written again with different content,
+ * of another size or of the same size, which makes the bundle entries stale:
+ * the tables must load the new text content.
+ */
+class SatTableBundleTestCase : public TestCase
+{
+  public:
+    SatTableBundleTestCase();
+
+  private:
+    virtual void DoRun();
+
+    /**
+     * \brief Write a two row link results file
+     */
+    void WriteTable(std::string fileName, double esNoDb0, double esNoDb1) const;
+};
+
+SatTableBundleTestCase::SatTableBundleTestCase()
+    : TestCase("Loading link results from a binary table bundle")
+{
+}
+
+void
+SatTableBundleTestCase::WriteTable(std::string fileName, double esNoDb0, double esNoDb1) const
+{
+    std::ofstream ofs(fileName.c_str());
+    ofs << esNoDb0 << " " << 1.0 << std::endl;
+    ofs << esNoDb1 << " " << 0.0 << std::endl;
+    ofs.close();
+}
+
+void
+SatTableBundleTestCase::DoRun()
+{
+    std::string fileName = CreateTempDirFilename("bundle-test-table.txt");
+    std::string otherDirName = CreateTempDirFilename("bundle-test");
+    std::string otherFileName = otherDirName + "/bundle-test-table.txt";
+    std::string bundleName = CreateTempDirFilename("bundle-test.bin");
+
+    SystemPath::MakeDirectories(otherDirName);
+    WriteTable(fileName, -1.0, 1.0);
+    WriteTable(otherFileName, 3.0, 5.0);
+
+    std::vector<SatTableBundle::sourceTable_s> tables(2);
+    tables[0].m_sourcePath = fileName;
+    SatLookUpTable::ReadTextColumns(fileName, tables[0].m_columns);
+    tables[1].m_sourcePath = otherFileName;
+    SatLookUpTable::ReadTextColumns(otherFileName, tables[1].m_columns);
+    SatTableBundle::Write(bundleName, tables);
+
+    SatTableBundle* bundle = Singleton<SatTableBundle>::Get();
+    bundle->SetAttribute("FileName", StringValue(bundleName));
+    bundle->Reset();
+
+    // the text files are gone, the tables come from the bundle
+    std::remove(fileName.c_str());
+    std::remove(otherFileName.c_str());
+
+    Ptr<SatLookUpTable> table = CreateObject<SatLookUpTable>(fileName);
+    Ptr<SatLookUpTable> otherTable = CreateObject<SatLookUpTable>(otherFileName);
+
+    // the tables view the bundle, which stays mapped while they use it
+    bundle->Reset();
+
+    NS_TEST_ASSERT_MSG_EQ_TOL(table->GetBler(0.0), 0.5, 1e-12, "Table not read from bundle");
+    NS_TEST_ASSERT_MSG_EQ_TOL(table->GetEsNoDb(0.5), 0.0, 1e-12, "Table not read from bundle");
+    NS_TEST_ASSERT_MSG_EQ_TOL(otherTable->GetBler(4.0),
+                              0.5,
+                              1e-12,
+                              "Table of the same file name not read from bundle");
+    NS_TEST_ASSERT_MSG_EQ_TOL(otherTable->GetEsNoDb(0.5),
+                              4.0,
+                              1e-12,
+                              "Table of the same file name not read from bundle");
+
+    // a text file not matching the bundle entry takes precedence
+    WriteTable(fileName, 2.5, 10.0);
+
+    table = CreateObject<SatLookUpTable>(fileName);
+    NS_TEST_ASSERT_MSG_EQ_TOL(table->GetBler(6.25), 0.5, 1e-12, "Stale bundle entry used");
+    NS_TEST_ASSERT_MSG_EQ_TOL(table->GetBler(0.0), 1.0, 1e-12, "Stale bundle entry used");
+
+    // an edit of the same size within the same second is seen by the content hash
+    WriteTable(otherFileName, 7.0, 9.0);
+
+    otherTable = CreateObject<SatLookUpTable>(otherFileName);
+    NS_TEST_ASSERT_MSG_EQ_TOL(otherTable->GetBler(8.0), 0.5, 1e-12, "Stale bundle entry used");
+    NS_TEST_ASSERT_MSG_EQ_TOL(otherTable->GetBler(4.0), 1.0, 1e-12, "Stale bundle entry used");
+
+    bundle->SetAttribute("FileName", StringValue("tables.bin"));
+    bundle->Reset();
+}
+
 /*
  * TEST SUITE
  */
@@ -1983,6 +2599,12 @@ static class LinkResultTestSuite : public TestSuite
 
         // END OF AUTO-GENERATED TEST CASES
 
+        AddTestCase(new SatCarrierErrorModelTestCase(linkResultsDvbRcs2, linkResultsDvbS2),
+                    TestCase::QUICK);
+        AddTestCase(new SatLookUpTableModeTestCase, TestCase::QUICK);
+        AddTestCase(new SatMutualInformationModeTestCase, TestCase::QUICK);
+        AddTestCase(new SatTableBundleTestCase, TestCase::QUICK);
+
     } // end of LinkResultTestSuite ()
 
 } g_linkResultTestSuite;
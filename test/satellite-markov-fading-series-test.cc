@@ -0,0 +1,430 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+/**
+ * \file satellite-markov-fading-series-test.cc
+ * \ingroup satellite
+ * \brief Test cases to unit test the pregenerated Markov fading time series and
+ * their replay by the Markov containers.
+ */
+
+#include "../model/satellite-base-fader.h"
+#include "../model/satellite-loo-model.h"
+#include "../model/satellite-markov-conf.h"
+#include "../model/satellite-markov-container.h"
+#include "../model/satellite-markov-fading-series.h"
+#include "../model/satellite-rayleigh-model.h"
+#include "../model/satellite-utils.h"
+
+#include "ns3/boolean.h"
+#include "ns3/nstime.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case for the fading time series of a Markov configuration.
+ *
+ *   1.  Create a Markov configuration replaying fading time series.
+ *   2.  Read the series on samples, between samples and after their duration.
+ *
+ *   Expected result:
+ *     The series are generated once for the configuration, the gains are
+ *     positive, linearly interpolated between the samples and repeated
+ *     after the duration of the series.
+ */
+class SatMarkovFadingSeriesTestCase : public TestCase
+{
+  public:
+    SatMarkovFadingSeriesTestCase();
+    virtual ~SatMarkovFadingSeriesTestCase();
+
+  private:
+    virtual void DoRun(void);
+};
+
+SatMarkovFadingSeriesTestCase::SatMarkovFadingSeriesTestCase()
+    : TestCase("Test satellite Markov fading time series.")
+{
+}
+
+SatMarkovFadingSeriesTestCase::~SatMarkovFadingSeriesTestCase()
+{
+}
+
+void
+SatMarkovFadingSeriesTestCase::DoRun(void)
+{
+    Ptr<SatMarkovConf> markovConf = CreateObject<SatMarkovConf>();
+    markovConf->SetAttribute("UseFadingSeries", BooleanValue(true));
+    markovConf->SetAttribute("FadingSeriesCount", UintegerValue(2));
+    markovConf->SetAttribute("FadingSeriesDuration", TimeValue(Seconds(1.0)));
+    markovConf->SetAttribute("FadingSeriesSamplingInterval", TimeValue(MilliSeconds(1)));
+
+    Ptr<SatMarkovFadingSeries> series = markovConf->GetFadingSeries();
+    NS_TEST_ASSERT_MSG_EQ(bool(series), true, "Fading series not generated");
+    NS_TEST_ASSERT_MSG_EQ((markovConf->GetFadingSeries() == series),
+                          true,
+                          "Fading series not shared");
+    NS_TEST_ASSERT_MSG_EQ(series->GetSeriesCount(), 2, "Unexpected number of series");
+    NS_TEST_ASSERT_MSG_EQ(series->GetDuration(), Seconds(1.0), "Unexpected series duration");
+
+    for (uint32_t set = 0; set < markovConf->GetNumOfSets(); set++)
+    {
+        for (uint32_t state = 0; state < markovConf->GetStateCount(); state++)
+        {
+            for (uint32_t index = 0; index < series->GetSeriesCount(); index++)
+            {
+                for (uint32_t sample = 0; sample < 1000; sample += 37)
+                {
+                    double time = sample * 0.001;
+                    double gain = series->GetChannelGain(set, state, index, time);
+                    double nextGain = series->GetChannelGain(set, state, index, time + 0.001);
+                    double middleGain = series->GetChannelGain(set, state, index, time + 0.0005);
+
+                    NS_TEST_ASSERT_MSG_GT(gain, 0.0, "Fading gain not positive");
+                    NS_TEST_ASSERT_MSG_EQ_TOL(middleGain,
+                                              0.5 * (gain + nextGain),
+                                              1e-6 * gain,
+                                              "Fading gain not interpolated");
+                    NS_TEST_ASSERT_MSG_EQ_TOL(series->GetChannelGain(set, state, index, time + 1.0),
+                                              gain,
+                                              1e-6 * gain,
+                                              "Fading series not repeated");
+                }
+            }
+        }
+    }
+
+    markovConf->Dispose();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case comparing the fading time series with the faders they replay.
+ *
+ *   1.  Generate the fading series of a Markov configuration after a reset of
+ *       the random stream indexes.
+ *   2.  Reset the stream indexes again and run, in the same order, the faders
+ *       the series are generated from over the sampling times.
+ *   3.  Average the gains of each set and state, over the series and over the
+ *       faders.
+ *
+ *   Expected result:
+ *     The mean gain of each set and state of the series matches the mean gain
+ *     of the faders, within the precision of the stored samples.
+ */
+class SatMarkovFadingSeriesMeanTestCase : public TestCase
+{
+  public:
+    SatMarkovFadingSeriesMeanTestCase();
+    virtual ~SatMarkovFadingSeriesMeanTestCase();
+
+  private:
+    virtual void DoRun(void);
+};
+
+SatMarkovFadingSeriesMeanTestCase::SatMarkovFadingSeriesMeanTestCase()
+    : TestCase("Test mean gains of satellite Markov fading time series.")
+{
+}
+
+SatMarkovFadingSeriesMeanTestCase::~SatMarkovFadingSeriesMeanTestCase()
+{
+}
+
+void
+SatMarkovFadingSeriesMeanTestCase::DoRun(void)
+{
+    const uint32_t seriesCount = 4;
+    const uint32_t sampleCount = 1000;
+    const double samplingInterval = 0.001;
+
+    Ptr<SatMarkovConf> markovConf = CreateObject<SatMarkovConf>();
+    markovConf->SetAttribute("UseFadingSeries", BooleanValue(true));
+    markovConf->SetAttribute("FadingSeriesCount", UintegerValue(seriesCount));
+    markovConf->SetAttribute("FadingSeriesDuration", TimeValue(Seconds(1.0)));
+    markovConf->SetAttribute("FadingSeriesSamplingInterval", TimeValue(Seconds(samplingInterval)));
+
+    // the faders of the series are the first random variables created after
+    // the reset of the stream indexes
+    RngSeedManager::SetSeed(5);
+    RngSeedManager::SetRun(2);
+    RngSeedManager::ResetNextStreamIndex();
+    Ptr<SatMarkovFadingSeries> series = markovConf->GetFadingSeries();
+    NS_TEST_ASSERT_MSG_EQ(series->GetSeriesCount(), seriesCount, "Unexpected number of series");
+
+    std::vector<double> times(sampleCount);
+    for (uint32_t i = 0; i < sampleCount; i++)
+    {
+        times[i] = i * samplingInterval;
+    }
+
+    uint32_t setCount = markovConf->GetNumOfSets();
+    uint32_t stateCount = markovConf->GetStateCount();
+    std::vector<double> seriesMean(setCount * stateCount, 0.0);
+    std::vector<double> faderMean(setCount * stateCount, 0.0);
+
+    // same faders, created in the same order as by the series
+    RngSeedManager::ResetNextStreamIndex();
+    std::vector<double> gains;
+    for (uint32_t set = 0; set < setCount; set++)
+    {
+        for (uint32_t index = 0; index < seriesCount; index++)
+        {
+            Ptr<SatBaseFader> fader;
+            if (markovConf->GetFaderType() == SatMarkovConf::LOO_FADER)
+            {
+                fader = CreateObject<SatLooModel>(markovConf->GetLooConf(), stateCount, set, 0);
+            }
+            else
+            {
+                fader = CreateObject<SatRayleighModel>(markovConf->GetRayleighConf(), set, 0);
+            }
+
+            for (uint32_t state = 0; state < stateCount; state++)
+            {
+                fader->UpdateParameters(set, state);
+                fader->GetChannelGains(times, gains);
+
+                for (uint32_t i = 0; i < sampleCount; i++)
+                {
+                    faderMean[set * stateCount + state] += gains[i];
+                    seriesMean[set * stateCount + state] +=
+                        series->GetChannelGain(set, state, index, times[i]);
+                }
+            }
+
+            fader->Dispose();
+        }
+    }
+
+    for (uint32_t set = 0; set < setCount; set++)
+    {
+        for (uint32_t state = 0; state < stateCount; state++)
+        {
+            double expected = faderMean[set * stateCount + state] / (seriesCount * sampleCount);
+            double actual = seriesMean[set * stateCount + state] / (seriesCount * sampleCount);
+
+            NS_TEST_ASSERT_MSG_GT(expected, 0.0, "Fader mean gain not positive");
+            NS_TEST_ASSERT_MSG_EQ_TOL(actual,
+                                      expected,
+                                      1e-5 * expected,
+                                      "Mean gain of the series differs from the faders in set "
+                                          << set << " state " << state);
+        }
+    }
+
+    markovConf->Dispose();
+}
+
+/**
+ * \ingroup satellite
+ * \brief Test case for the replay of the fading time series by a Markov container.
+ *
+ *   1.  Create a Markov configuration replaying fading time series, and two
+ *       containers of the configuration after a reset of the random stream
+ *       indexes, the second one returning the fading in decibels.
+ *   2.  Draw the series index and offset again after a reset of the stream
+ *       indexes, as done by the containers.
+ *   3.  Lock the containers to another parameter set and state before each
+ *       read of the fading, over more than the duration of the series.
+ *
+ *   Expected result:
+ *     The containers return the gain of the drawn series, at the simulation
+ *     time shifted by the drawn offset, for the locked set and state, in
+ *     linear format or in decibels.
+ */
+class SatMarkovContainerFadingSeriesTestCase : public TestCase
+{
+  public:
+    SatMarkovContainerFadingSeriesTestCase();
+    virtual ~SatMarkovContainerFadingSeriesTestCase();
+
+  private:
+    virtual void DoRun(void);
+
+    /**
+     * \brief Lock the containers to a parameter set and state, and check their fading
+     * \param set Parameter set
+     * \param state State
+     */
+    void CheckFading(uint32_t set, uint32_t state);
+
+    /**
+     * \return Elevation angle of the containers
+     */
+    static double GetElevation();
+
+    /**
+     * \return Velocity of the containers, no state change is evaluated
+     */
+    static double GetVelocity();
+
+    Ptr<SatMarkovFadingSeries> m_series;
+    Ptr<SatMarkovContainer> m_container;
+    Ptr<SatMarkovContainer> m_containerDb;
+    uint32_t m_seriesIndex;
+    double m_seriesOffset;
+};
+
+SatMarkovContainerFadingSeriesTestCase::SatMarkovContainerFadingSeriesTestCase()
+    : TestCase("Test satellite Markov container replaying fading time series."),
+      m_series(0),
+      m_container(0),
+      m_containerDb(0),
+      m_seriesIndex(0),
+      m_seriesOffset(0.0)
+{
+}
+
+SatMarkovContainerFadingSeriesTestCase::~SatMarkovContainerFadingSeriesTestCase()
+{
+}
+
+double
+SatMarkovContainerFadingSeriesTestCase::GetElevation()
+{
+    return 45.0;
+}
+
+double
+SatMarkovContainerFadingSeriesTestCase::GetVelocity()
+{
+    return 0.0;
+}
+
+void
+SatMarkovContainerFadingSeriesTestCase::CheckFading(uint32_t set, uint32_t state)
+{
+    m_container->LockToSetAndState(set, state);
+    m_containerDb->LockToSetAndState(set, state);
+
+    double gain = m_series->GetChannelGain(set,
+                                           state,
+                                           m_seriesIndex,
+                                           Simulator::Now().GetSeconds() + m_seriesOffset);
+
+    // both channels replay the same series
+    std::vector<SatEnums::ChannelType_t> channelTypes = {SatEnums::RETURN_USER_CH,
+                                                         SatEnums::FORWARD_USER_CH};
+    for (SatEnums::ChannelType_t channelType : channelTypes)
+    {
+        NS_TEST_ASSERT_MSG_EQ_TOL(m_container->DoGetFading(Address(), channelType),
+                                  gain,
+                                  1e-9 * gain,
+                                  "Unexpected fading in set " << set << " state " << state);
+        NS_TEST_ASSERT_MSG_EQ_TOL(m_containerDb->DoGetFading(Address(), channelType),
+                                  SatUtils::LinearToDb(gain),
+                                  1e-9,
+                                  "Unexpected fading in decibels in set " << set << " state "
+                                                                           << state);
+    }
+}
+
+void
+SatMarkovContainerFadingSeriesTestCase::DoRun(void)
+{
+    const uint32_t seriesCount = 3;
+    const Time duration = Seconds(1.0);
+
+    Ptr<SatMarkovConf> markovConf = CreateObject<SatMarkovConf>();
+    markovConf->SetAttribute("UseFadingSeries", BooleanValue(true));
+    markovConf->SetAttribute("FadingSeriesCount", UintegerValue(seriesCount));
+    markovConf->SetAttribute("FadingSeriesDuration", TimeValue(duration));
+    markovConf->SetAttribute("FadingSeriesSamplingInterval", TimeValue(MilliSeconds(1)));
+    markovConf->SetAttribute("CooldownPeriodLength", TimeValue(Seconds(0)));
+
+    // generated beforehand, the series index and offset are then the only random
+    // draws of the containers
+    m_series = markovConf->GetFadingSeries();
+
+    RngSeedManager::SetSeed(3);
+    RngSeedManager::SetRun(4);
+    RngSeedManager::ResetNextStreamIndex();
+    m_container = CreateObject<SatMarkovContainer>(
+        markovConf,
+        MakeCallback(&SatMarkovContainerFadingSeriesTestCase::GetElevation),
+        MakeCallback(&SatMarkovContainerFadingSeriesTestCase::GetVelocity));
+
+    markovConf->SetAttribute("UseDecibels", BooleanValue(true));
+    RngSeedManager::ResetNextStreamIndex();
+    m_containerDb = CreateObject<SatMarkovContainer>(
+        markovConf,
+        MakeCallback(&SatMarkovContainerFadingSeriesTestCase::GetElevation),
+        MakeCallback(&SatMarkovContainerFadingSeriesTestCase::GetVelocity));
+
+    RngSeedManager::ResetNextStreamIndex();
+    Ptr<UniformRandomVariable> uniform = CreateObject<UniformRandomVariable>();
+    m_seriesIndex = uniform->GetInteger(0, seriesCount - 1);
+    m_seriesOffset = uniform->GetValue(0.0, duration.GetSeconds());
+
+    NS_TEST_ASSERT_MSG_LT(m_seriesIndex, seriesCount, "Series index out of range");
+    NS_TEST_ASSERT_MSG_LT(m_seriesOffset, duration.GetSeconds(), "Series offset out of range");
+
+    // read over two series durations, switching the set and the state every time
+    uint32_t setCount = markovConf->GetNumOfSets();
+    uint32_t stateCount = markovConf->GetStateCount();
+    for (uint32_t step = 0; step < 12; step++)
+    {
+        Simulator::Schedule(Seconds(0.1 + 0.173 * step),
+                            &SatMarkovContainerFadingSeriesTestCase::CheckFading,
+                            this,
+                            step % setCount,
+                            (step / setCount + step) % stateCount);
+    }
+
+    Simulator::Run();
+    Simulator::Destroy();
+
+    m_container->Dispose();
+    m_containerDb->Dispose();
+    markovConf->Dispose();
+    m_container = 0;
+    m_containerDb = 0;
+    m_series = 0;
+}
+
+/**
+ * \brief Test suite for the Markov fading time series.
+ */
+class SatMarkovFadingSeriesTestSuite : public TestSuite
+{
+  public:
+    SatMarkovFadingSeriesTestSuite();
+};
+
+SatMarkovFadingSeriesTestSuite::SatMarkovFadingSeriesTestSuite()
+    : TestSuite("sat-markov-fading-series-test", UNIT)
+{
+    AddTestCase(new SatMarkovFadingSeriesTestCase, TestCase::QUICK);
+    AddTestCase(new SatMarkovFadingSeriesMeanTestCase, TestCase::QUICK);
+    AddTestCase(new SatMarkovContainerFadingSeriesTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatMarkovFadingSeriesTestSuite satMarkovFadingSeriesTestSuite;
@@ -0,0 +1,152 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+/**
+ * \file satellite-ring-buffer-test.cc
+ * \ingroup satellite
+ * \brief Test cases to unit test the ring buffer of the ESSA receiver.
+ */
+
+#include "../model/satellite-ring-buffer.h"
+
+#include "ns3/test.h"
+
+#include <stdint.h>
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case for the wraparound and growth of the ring buffer.
+ *
+ *   1.  Append and remove items so that the oldest item is not at the start of the storage.
+ *   2.  Append items until the storage is full and its end wraps around to its start.
+ *   3.  Append one more item, which grows the storage.
+ *   4.  Remove all the items.
+ *
+ *   Expected result:
+ *     At each step, the items are read from the oldest to the newest in the
+ *     order they were appended, by position as well as from the front.
+ */
+class SatRingBufferTestCase : public TestCase
+{
+  public:
+    SatRingBufferTestCase();
+    virtual ~SatRingBufferTestCase();
+
+  private:
+    virtual void DoRun(void);
+
+    /**
+     * \brief Check that the buffer holds the consecutive items from first to last
+     * \param buffer Buffer to check
+     * \param first Oldest item expected
+     * \param last Newest item expected
+     */
+    void CheckItems(const SatRingBuffer<uint32_t>& buffer, uint32_t first, uint32_t last);
+};
+
+SatRingBufferTestCase::SatRingBufferTestCase()
+    : TestCase("Test satellite ring buffer wraparound, growth and iteration order.")
+{
+}
+
+SatRingBufferTestCase::~SatRingBufferTestCase()
+{
+}
+
+void
+SatRingBufferTestCase::CheckItems(const SatRingBuffer<uint32_t>& buffer,
+                                  uint32_t first,
+                                  uint32_t last)
+{
+    NS_TEST_ASSERT_MSG_EQ(buffer.GetSize(), last - first + 1, "Unexpected number of items");
+
+    for (std::size_t position = 0; position < buffer.GetSize(); position++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(buffer[position], first + position, "Items out of order");
+    }
+}
+
+void
+SatRingBufferTestCase::DoRun(void)
+{
+    SatRingBuffer<uint32_t> buffer;
+    NS_TEST_ASSERT_MSG_EQ(buffer.IsEmpty(), true, "New buffer not empty");
+
+    for (uint32_t item = 0; item < 10; item++)
+    {
+        buffer.PushBack(item);
+    }
+    for (uint32_t item = 0; item < 6; item++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(buffer.Front(), item, "Oldest item not removed first");
+        buffer.PopFront();
+    }
+    CheckItems(buffer, 6, 9);
+
+    // the initial storage of 16 items is full, the newest items wrap around to its start
+    for (uint32_t item = 10; item < 22; item++)
+    {
+        buffer.PushBack(item);
+        NS_TEST_ASSERT_MSG_EQ(buffer.Back(), item, "Newest item not appended last");
+    }
+    CheckItems(buffer, 6, 21);
+
+    // growing moves the wrapped items, they keep their order
+    buffer.PushBack(22);
+    CheckItems(buffer, 6, 22);
+
+    for (uint32_t item = 23; item < 100; item++)
+    {
+        buffer.PushBack(item);
+        buffer.PopFront();
+        buffer.PushBack(1000 + item);
+        buffer.PopFront();
+    }
+    NS_TEST_ASSERT_MSG_EQ(buffer.GetSize(), 17, "Unexpected number of items");
+    NS_TEST_ASSERT_MSG_EQ(buffer.Front(), 1091, "Unexpected oldest item");
+    NS_TEST_ASSERT_MSG_EQ(buffer.Back(), 1099, "Unexpected newest item");
+
+    while (!buffer.IsEmpty())
+    {
+        buffer.PopFront();
+    }
+    buffer.PushBack(7);
+    CheckItems(buffer, 7, 7);
+}
+
+/**
+ * \brief Test suite for the ring buffer.
+ */
+class SatRingBufferTestSuite : public TestSuite
+{
+  public:
+    SatRingBufferTestSuite();
+};
+
+SatRingBufferTestSuite::SatRingBufferTestSuite()
+    : TestSuite("sat-ring-buffer-test", UNIT)
+{
+    AddTestCase(new SatRingBufferTestCase, TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatRingBufferTestSuite satRingBufferTestSuite;
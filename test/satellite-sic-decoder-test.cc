@@ -0,0 +1,522 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 CNES
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Bastien Tauran <bastien.tauran@viveris.fr>
+ */
+
+/**
+ * \file satellite-sic-decoder-test.cc
+ * \ingroup satellite
+ * \brief Test cases comparing the SIC decoders of the CRDSA frames, and the
+ * decoding of the frames by one or several threads.
+ */
+
+#include "ns3/boolean.h"
+#include "ns3/config.h"
+#include "ns3/double.h"
+#include "ns3/enum.h"
+#include "ns3/object-vector.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/satellite-env-variables.h"
+#include "ns3/satellite-frame-decoding-pool.h"
+#include "ns3/satellite-helper.h"
+#include "ns3/satellite-net-device.h"
+#include "ns3/satellite-phy-rx-carrier-per-frame.h"
+#include "ns3/satellite-phy-rx.h"
+#include "ns3/satellite-phy.h"
+#include "ns3/simulation-helper.h"
+#include "ns3/simulator.h"
+#include "ns3/singleton.h"
+#include "ns3/string.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup satellite
+ * \brief Test case comparing two runs of a random access scenario, either with the
+ * SlotScan and Peeling SIC decoders, with the frames decoded without and with
+ * SatFrameDecodingPool or with the frames decoded by one and several threads of the
+ * pool.
+ *
+ *   1.  Create a scenario where UTs send CBR traffic through random access,
+ *       loading the frames enough for the replicas to collide.
+ *   2.  Run the scenario with the same seed, once with each configuration.
+ *   3.  Record the unique payloads received after the frame processing, the
+ *       composite SINRs traced by the carriers and, with MARSALA, the correlations
+ *       of the replicas.
+ *
+ *   Expected result:
+ *     Both runs receive the same payloads, from the same UTs at the same time,
+ *     with the same error flags, and trace the same composite SINRs. The pool
+ *     delivers the frames in the order of the carriers, so the traces of a time
+ *     are compared whatever their order when only one run uses the pool. With MARSALA,
+ *     the SlotScan decoder searches the slots for the replicas as before the frame
+ *     graph was introduced, and both decoders trace the same correlations.
+ */
+class SatSicDecoderTestCase : public TestCase
+{
+  public:
+    /**
+     * \brief Configuration of a run
+     */
+    typedef struct
+    {
+        std::string m_decoder;
+        uint32_t m_decodingThreads; // 0 to decode the frames without the pool
+    } runConf_s;
+
+    /**
+     * \brief Constructor
+     * \param name Name of the test case
+     * \param model Random access model of the scenario
+     * \param beams Number of beams of the scenario, carriers of several beams
+     * end their frames at the same time
+     * \param expected Configuration of the reference run
+     * \param actual Configuration of the compared run
+     */
+    SatSicDecoderTestCase(std::string name,
+                          SatEnums::RandomAccessModel_t model,
+                          uint32_t beams,
+                          runConf_s expected,
+                          runConf_s actual);
+    virtual ~SatSicDecoderTestCase();
+
+  private:
+    /**
+     * \brief Trace fired by a carrier
+     */
+    typedef struct
+    {
+        Time m_time;
+        uint32_t m_ut;
+        uint32_t m_value;
+        bool m_phyError;
+        double m_sinrDb;
+    } traceRecord_s;
+
+    /**
+     * \brief Traces fired by the carriers during a run
+     */
+    typedef struct
+    {
+        std::vector<traceRecord_s> m_payloads;
+        std::vector<traceRecord_s> m_sinrs;
+        std::vector<traceRecord_s> m_correlations;
+    } runRecords_s;
+
+    virtual void DoRun(void);
+
+    /**
+     * \brief Run the scenario
+     * \param conf Configuration of the run
+     * \param records Traces fired by the carriers
+     */
+    void RunScenario(runConf_s conf, runRecords_s& records);
+
+    /**
+     * \brief Sort the traces fired at the same time
+     * \param records Traces fired by the carriers
+     */
+    static void SortRecords(std::vector<traceRecord_s>& records);
+
+    /**
+     * \brief Check that two runs fired the same traces
+     * \param expected Traces of the reference run
+     * \param actual Traces of the compared run
+     * \param trace Name of the traces
+     */
+    void CheckRecords(const std::vector<traceRecord_s>& expected,
+                      const std::vector<traceRecord_s>& actual,
+                      std::string trace);
+
+    /**
+     * \brief Record a trace
+     */
+    void Record(std::vector<traceRecord_s>& records,
+                const Address& source,
+                uint32_t value,
+                bool phyError,
+                double sinrDb);
+
+    /**
+     * \brief Callback of the CrdsaUniquePayloadRx trace
+     */
+    void UniquePayloadRxCb(uint32_t packets, const Address& source, bool phyError);
+
+    /**
+     * \brief Callback of the Sinr trace
+     */
+    void SinrCb(double sinrDb, const Address& source);
+
+    /**
+     * \brief Callback of the MarsalaCorrelationRx trace
+     */
+    void MarsalaCorrelationRxCb(uint32_t correlations, const Address& source, bool phyError);
+
+    SatEnums::RandomAccessModel_t m_model;
+    uint32_t m_beams;
+    runConf_s m_expected;
+    runConf_s m_actual;
+    std::map<Address, uint32_t> m_utIndexes;
+    runRecords_s* m_records;
+};
+
+SatSicDecoderTestCase::SatSicDecoderTestCase(std::string name,
+                                             SatEnums::RandomAccessModel_t model,
+                                             uint32_t beams,
+                                             runConf_s expected,
+                                             runConf_s actual)
+    : TestCase(name),
+      m_model(model),
+      m_beams(beams),
+      m_expected(expected),
+      m_actual(actual),
+      m_utIndexes(),
+      m_records(0)
+{
+}
+
+SatSicDecoderTestCase::~SatSicDecoderTestCase()
+{
+}
+
+void
+SatSicDecoderTestCase::Record(std::vector<traceRecord_s>& records,
+                              const Address& source,
+                              uint32_t value,
+                              bool phyError,
+                              double sinrDb)
+{
+    traceRecord_s record;
+    record.m_time = Simulator::Now();
+    record.m_ut = m_utIndexes[source];
+    record.m_value = value;
+    record.m_phyError = phyError;
+    record.m_sinrDb = sinrDb;
+    records.push_back(record);
+}
+
+void
+SatSicDecoderTestCase::UniquePayloadRxCb(uint32_t packets, const Address& source, bool phyError)
+{
+    Record(m_records->m_payloads, source, packets, phyError, 0.0);
+}
+
+void
+SatSicDecoderTestCase::SinrCb(double sinrDb, const Address& source)
+{
+    Record(m_records->m_sinrs, source, 0, false, sinrDb);
+}
+
+void
+SatSicDecoderTestCase::MarsalaCorrelationRxCb(uint32_t correlations,
+                                              const Address& source,
+                                              bool phyError)
+{
+    Record(m_records->m_correlations, source, correlations, phyError, 0.0);
+}
+
+void
+SatSicDecoderTestCase::RunScenario(runConf_s conf, runRecords_s& records)
+{
+    Config::Reset();
+
+    // same random draws in both runs
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+    RngSeedManager::ResetNextStreamIndex();
+
+    std::string runName = conf.m_decoder + "-" + std::to_string(conf.m_decodingThreads);
+    Singleton<SatEnvVariables>::Get()->DoInitialize();
+    Singleton<SatEnvVariables>::Get()->SetOutputVariables("test-sat-sic-decoder", runName, true);
+
+    Config::SetDefault("ns3::SatPhyRxCarrierPerFrame::SicDecoder", StringValue(conf.m_decoder));
+
+    // the pool is a singleton created before this run, its attributes are set directly
+    SatFrameDecodingPool* pool = Singleton<SatFrameDecodingPool>::Get();
+    pool->SetAttribute("Enabled", BooleanValue(conf.m_decodingThreads > 0));
+    pool->SetAttribute("Threads", UintegerValue(conf.m_decodingThreads));
+
+    SatPhyRxCarrierConf::ErrorModel em(SatPhyRxCarrierConf::EM_AVI);
+    Config::SetDefault("ns3::SatUtHelper::FwdLinkErrorModel", EnumValue(em));
+    Config::SetDefault("ns3::SatGwHelper::RtnLinkErrorModel", EnumValue(em));
+    Config::SetDefault("ns3::SatBeamHelper::RandomAccessModel", EnumValue(m_model));
+    Config::SetDefault("ns3::SatBeamHelper::RaInterferenceModel",
+                       EnumValue(SatPhyRxCarrierConf::IF_PER_PACKET));
+    Config::SetDefault("ns3::SatBeamHelper::RaCollisionModel",
+                       EnumValue(SatPhyRxCarrierConf::RA_COLLISION_CHECK_AGAINST_SINR));
+    Config::SetDefault("ns3::SatBeamScheduler::ControlSlotsEnabled", BooleanValue(false));
+    Config::SetDefault("ns3::SatPhyRxCarrierConf::EnableRandomAccessDynamicLoadControl",
+                       BooleanValue(false));
+
+    // random access parameters of the CRDSA examples
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::RaService0_MaximumUniquePayloadPerBlock",
+                       UintegerValue(3));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::RaService0_MaximumConsecutiveBlockAccessed",
+                       UintegerValue(6));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::RaService0_MinimumIdleBlock",
+                       UintegerValue(2));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::RaService0_BackOffTimeInMilliSeconds",
+                       UintegerValue(250));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::RaService0_BackOffProbability",
+                       UintegerValue(10000));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::RaService0_HighLoadBackOffProbability",
+                       UintegerValue(30000));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::RaService0_NumberOfInstances",
+                       UintegerValue(3));
+    Config::SetDefault("ns3::SatRandomAccessConf::CrdsaSignalingOverheadInBytes", UintegerValue(5));
+
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService0_ConstantAssignmentProvided",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService1_ConstantAssignmentProvided",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService2_ConstantAssignmentProvided",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService3_ConstantAssignmentProvided",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService0_RbdcAllowed",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService1_RbdcAllowed",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService2_RbdcAllowed",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService3_RbdcAllowed",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService0_VolumeAllowed",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService1_VolumeAllowed",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService2_VolumeAllowed",
+                       BooleanValue(false));
+    Config::SetDefault("ns3::SatLowerLayerServiceConf::DaService3_VolumeAllowed",
+                       BooleanValue(false));
+
+    Ptr<SimulationHelper> simulationHelper =
+        CreateObject<SimulationHelper>("test-sat-sic-decoder/" + runName);
+    simulationHelper->SetSimulationTime(Seconds(2.0));
+    simulationHelper->SetUserCountPerUt(1);
+    simulationHelper->SetUtCountPerBeam(40 / m_beams);
+    std::set<uint32_t> beamSet;
+    for (uint32_t beam = 1; beam <= m_beams; beam++)
+    {
+        beamSet.insert(beam);
+    }
+    simulationHelper->SetBeamSet(beamSet);
+    Ptr<SatHelper> helper = simulationHelper->CreateSatScenario();
+
+    Config::SetDefault("ns3::CbrApplication::Interval", TimeValue(MilliSeconds(10)));
+    Config::SetDefault("ns3::CbrApplication::PacketSize", UintegerValue(20));
+    simulationHelper->InstallTrafficModel(SimulationHelper::CBR,
+                                          SimulationHelper::UDP,
+                                          SimulationHelper::RTN_LINK,
+                                          Seconds(0.01),
+                                          Seconds(3.0),
+                                          Seconds(0.05));
+
+    // the MAC addresses differ between the runs, the payloads are compared by UT
+    m_utIndexes.clear();
+    NodeContainer uts = helper->UtNodes();
+    for (uint32_t ut = 0; ut < uts.GetN(); ut++)
+    {
+        for (uint32_t dev = 0; dev < uts.Get(ut)->GetNDevices(); dev++)
+        {
+            m_utIndexes[uts.Get(ut)->GetDevice(dev)->GetAddress()] = ut;
+        }
+    }
+
+    m_records = &records;
+    NodeContainer gws = helper->GwNodes();
+    for (uint32_t gw = 0; gw < gws.GetN(); gw++)
+    {
+        for (uint32_t dev = 0; dev < gws.Get(gw)->GetNDevices(); dev++)
+        {
+            Ptr<SatNetDevice> satDev = DynamicCast<SatNetDevice>(gws.Get(gw)->GetDevice(dev));
+            if (!satDev)
+            {
+                continue;
+            }
+
+            ObjectVectorValue carriers;
+            satDev->GetPhy()->GetPhyRx()->GetAttribute("RxCarrierList", carriers);
+            for (ObjectVectorValue::Iterator it = carriers.Begin(); it != carriers.End(); ++it)
+            {
+                Ptr<SatPhyRxCarrierPerFrame> carrier =
+                    DynamicCast<SatPhyRxCarrierPerFrame>(it->second);
+                if (!carrier)
+                {
+                    continue;
+                }
+
+                carrier->TraceConnectWithoutContext(
+                    "CrdsaUniquePayloadRx",
+                    MakeCallback(&SatSicDecoderTestCase::UniquePayloadRxCb, this));
+                carrier->TraceConnectWithoutContext(
+                    "Sinr",
+                    MakeCallback(&SatSicDecoderTestCase::SinrCb, this));
+
+                // only found in the MARSALA carriers
+                carrier->TraceConnectWithoutContext(
+                    "MarsalaCorrelationRx",
+                    MakeCallback(&SatSicDecoderTestCase::MarsalaCorrelationRxCb, this));
+            }
+        }
+    }
+
+    simulationHelper->RunSimulation();
+    Simulator::Destroy();
+
+    pool->SetAttribute("Enabled", BooleanValue(false));
+    m_records = 0;
+    Singleton<SatEnvVariables>::Get()->DoDispose();
+}
+
+void
+SatSicDecoderTestCase::SortRecords(std::vector<traceRecord_s>& records)
+{
+    std::stable_sort(records.begin(),
+                     records.end(),
+                     [](const traceRecord_s& a, const traceRecord_s& b) {
+                         return std::tie(a.m_time, a.m_ut, a.m_value, a.m_phyError, a.m_sinrDb) <
+                                std::tie(b.m_time, b.m_ut, b.m_value, b.m_phyError, b.m_sinrDb);
+                     });
+}
+
+void
+SatSicDecoderTestCase::CheckRecords(const std::vector<traceRecord_s>& expected,
+                                    const std::vector<traceRecord_s>& actual,
+                                    std::string trace)
+{
+    NS_TEST_ASSERT_MSG_EQ(actual.size(),
+                          expected.size(),
+                          "Runs fired a different number of " << trace << " traces");
+
+    for (uint32_t i = 0; i < expected.size() && i < actual.size(); i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(actual[i].m_time,
+                              expected[i].m_time,
+                              trace << " trace " << i << " time differs");
+        NS_TEST_ASSERT_MSG_EQ(actual[i].m_ut,
+                              expected[i].m_ut,
+                              trace << " trace " << i << " UT differs");
+        NS_TEST_ASSERT_MSG_EQ(actual[i].m_value,
+                              expected[i].m_value,
+                              trace << " trace " << i << " value differs");
+        NS_TEST_ASSERT_MSG_EQ(actual[i].m_phyError,
+                              expected[i].m_phyError,
+                              trace << " trace " << i << " error differs");
+        NS_TEST_ASSERT_MSG_EQ_TOL(actual[i].m_sinrDb,
+                                  expected[i].m_sinrDb,
+                                  1e-9,
+                                  trace << " trace " << i << " SINR differs");
+    }
+}
+
+void
+SatSicDecoderTestCase::DoRun(void)
+{
+    runRecords_s expectedRecords;
+    runRecords_s actualRecords;
+
+    RunScenario(m_expected, expectedRecords);
+    RunScenario(m_actual, actualRecords);
+
+    uint32_t received = 0;
+    for (const traceRecord_s& record : expectedRecords.m_payloads)
+    {
+        received += record.m_phyError ? 0 : 1;
+    }
+    NS_TEST_ASSERT_MSG_GT(received, 0, "No payload received");
+
+    // the frames ending at the same time are delivered in another order by the pool
+    if ((m_expected.m_decodingThreads == 0) != (m_actual.m_decodingThreads == 0))
+    {
+        for (runRecords_s* records : {&expectedRecords, &actualRecords})
+        {
+            SortRecords(records->m_payloads);
+            SortRecords(records->m_sinrs);
+            SortRecords(records->m_correlations);
+        }
+    }
+
+    CheckRecords(expectedRecords.m_payloads, actualRecords.m_payloads, "CrdsaUniquePayloadRx");
+    CheckRecords(expectedRecords.m_sinrs, actualRecords.m_sinrs, "Sinr");
+    CheckRecords(expectedRecords.m_correlations,
+                 actualRecords.m_correlations,
+                 "MarsalaCorrelationRx");
+
+    if (m_model == SatEnums::RA_MODEL_MARSALA)
+    {
+        NS_TEST_ASSERT_MSG_GT(expectedRecords.m_correlations.size(),
+                              0,
+                              "No replicas correlated with MARSALA");
+    }
+}
+
+/**
+ * \brief Test suite for the SIC decoders and the frame decoding pool.
+ */
+class SatSicDecoderTestSuite : public TestSuite
+{
+  public:
+    SatSicDecoderTestSuite();
+};
+
+SatSicDecoderTestSuite::SatSicDecoderTestSuite()
+    : TestSuite("sat-sic-decoder-test", SYSTEM)
+{
+    SatSicDecoderTestCase::runConf_s slotScan = {"SlotScan", 0};
+    SatSicDecoderTestCase::runConf_s peeling = {"Peeling", 0};
+    SatSicDecoderTestCase::runConf_s oneThread = {"Peeling", 1};
+    SatSicDecoderTestCase::runConf_s fourThreads = {"Peeling", 4};
+
+    AddTestCase(new SatSicDecoderTestCase("Test satellite SIC decoders with CRDSA",
+                                          SatEnums::RA_MODEL_CRDSA,
+                                          1,
+                                          slotScan,
+                                          peeling),
+                TestCase::QUICK);
+    AddTestCase(new SatSicDecoderTestCase("Test satellite SIC decoders with MARSALA",
+                                          SatEnums::RA_MODEL_MARSALA,
+                                          1,
+                                          slotScan,
+                                          peeling),
+                TestCase::QUICK);
+    AddTestCase(new SatSicDecoderTestCase("Test satellite frame decoding without and with the pool",
+                                          SatEnums::RA_MODEL_CRDSA,
+                                          4,
+                                          peeling,
+                                          fourThreads),
+                TestCase::QUICK);
+    AddTestCase(new SatSicDecoderTestCase("Test satellite frame decoding by 1 and 4 threads",
+                                          SatEnums::RA_MODEL_CRDSA,
+                                          4,
+                                          oneThread,
+                                          fourThreads),
+                TestCase::QUICK);
+}
+
+// Do allocate an instance of this TestSuite
+static SatSicDecoderTestSuite satSicDecoderTestSuite;
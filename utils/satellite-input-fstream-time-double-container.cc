@@ -24,6 +24,12 @@
 #include "ns3/log.h"
 #include "ns3/simulator.h"
 
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+
 NS_LOG_COMPONENT_DEFINE("SatInputFileStreamTimeDoubleContainer");
 
 namespace ns3
@@ -44,14 +50,15 @@ SatInputFileStreamTimeDoubleContainer::SatInputFileStreamTimeDoubleContainer(
     uint32_t valuesInRow)
     : m_inputFileStreamWrapper(),
       m_inputFileStream(),
-      m_container(),
+      m_columns(),
       m_fileName(filename),
       m_fileMode(filemode),
       m_valuesInRow(valuesInRow),
       m_lastValidPosition(0),
       m_numOfPasses(0),
       m_timeShiftValue(0),
-      m_timeColumn(0)
+      m_timeColumn(0),
+      m_lastComparisonTimeValue(0)
 {
     NS_LOG_FUNCTION(this << m_fileName << m_fileMode);
 
@@ -61,14 +68,15 @@ SatInputFileStreamTimeDoubleContainer::SatInputFileStreamTimeDoubleContainer(
 SatInputFileStreamTimeDoubleContainer::SatInputFileStreamTimeDoubleContainer()
     : m_inputFileStreamWrapper(),
       m_inputFileStream(),
-      m_container(),
+      m_columns(),
       m_fileName(),
       m_fileMode(),
       m_valuesInRow(),
       m_lastValidPosition(),
       m_numOfPasses(),
       m_timeShiftValue(),
-      m_timeColumn()
+      m_timeColumn(),
+      m_lastComparisonTimeValue()
 {
     NS_LOG_FUNCTION(this);
     NS_FATAL_ERROR("SatInputFileStreamTimeDoubleContainer::SatInputFileStreamTimeDoubleContainer - "
@@ -97,6 +105,7 @@ SatInputFileStreamTimeDoubleContainer::UpdateContainer(std::string filename,
                                                        uint32_t valuesInRow)
 {
     NS_LOG_FUNCTION(this);
+    NS_ASSERT(valuesInRow > 0);
 
     ClearContainer();
 
@@ -109,14 +118,11 @@ SatInputFileStreamTimeDoubleContainer::UpdateContainer(std::string filename,
 
     if (m_inputFileStream->is_open())
     {
-        std::vector<double> tempVector = ReadRow();
-
-        while (!m_inputFileStream->eof())
-        {
-            m_container.push_back(tempVector);
-            tempVector = ReadRow();
-        }
+        std::stringstream buffer;
+        buffer << m_inputFileStream->rdbuf();
         m_inputFileStream->close();
+
+        ReadColumns(buffer.str());
     }
     else
     {
@@ -128,20 +134,63 @@ SatInputFileStreamTimeDoubleContainer::UpdateContainer(std::string filename,
     ResetStream();
 }
 
-std::vector<double>
-SatInputFileStreamTimeDoubleContainer::ReadRow()
+void
+SatInputFileStreamTimeDoubleContainer::ReadColumns(const std::string& buffer)
 {
     NS_LOG_FUNCTION(this);
 
-    double tempValue;
-    std::vector<double> tempVector;
+    m_columns.assign(m_valuesInRow, std::vector<double>());
+
+    const char* position = buffer.c_str();
+    char* end = 0;
+    uint32_t column = 0;
+
+    while (true)
+    {
+        double value = std::strtod(position, &end);
+
+        if (end == position)
+        {
+            break;
+        }
+
+        m_columns[column].push_back(value);
+        column = (column + 1 == m_valuesInRow) ? 0 : column + 1;
+        position = end;
+    }
+
+    // only white spaces may follow the last value
+    while (std::isspace(static_cast<unsigned char>(*position)))
+    {
+        ++position;
+    }
+
+    if (*position != '\0')
+    {
+        NS_FATAL_ERROR("SatInputFileStreamDoubleContainer::UpdateContainer - Invalid value in "
+                       << m_fileName << " at offset " << position - buffer.c_str());
+    }
+
+    // an incomplete last row is ignored
+    std::size_t rowCount = m_columns[m_valuesInRow - 1].size();
+    for (uint32_t i = 0; i < m_valuesInRow; i++)
+    {
+        m_columns[i].resize(rowCount);
+    }
+
+    NS_LOG_INFO("Read " << rowCount << " rows from " << m_fileName);
+}
+
+std::vector<double>
+SatInputFileStreamTimeDoubleContainer::GetRow(uint32_t index) const
+{
+    std::vector<double> row(m_valuesInRow);
 
     for (uint32_t i = 0; i < m_valuesInRow; i++)
     {
-        *m_inputFileStream >> tempValue;
-        tempVector.push_back(tempValue);
+        row[i] = m_columns[i][index];
     }
-    return tempVector;
+    return row;
 }
 
 void
@@ -149,14 +198,16 @@ SatInputFileStreamTimeDoubleContainer::CheckContainerSanity()
 {
     NS_LOG_FUNCTION(this);
 
+    const std::vector<double>& times = m_columns.at(m_timeColumn);
+
     /// check time sample sanity
-    if (m_container.size() < 1)
+    if (times.size() < 1)
     {
         NS_FATAL_ERROR("SatInputFileStreamDoubleContainer::UpdateContainer - Empty file");
     }
-    else if (m_container.size() == 1)
+    else if (times.size() == 1)
     {
-        if (m_container[m_container.size() - 1].at(m_timeColumn) == 0)
+        if (times[0] == 0)
         {
             NS_FATAL_ERROR("SatInputFileStreamDoubleContainer::UpdateContainer - Invalid input "
                            "file format (time sample error)");
@@ -164,16 +215,13 @@ SatInputFileStreamTimeDoubleContainer::CheckContainerSanity()
     }
     else
     {
-        double tempValue1 = m_container[0].at(m_timeColumn);
-
-        for (uint32_t i = 1; i < m_container.size(); i++)
+        for (uint32_t i = 1; i < times.size(); i++)
         {
-            if (tempValue1 > m_container[i].at(m_timeColumn))
+            if (times[i - 1] > times[i])
             {
                 NS_FATAL_ERROR("SatInputFileStreamDoubleContainer::UpdateContainer - Invalid input "
                                "file format (time sample error)");
             }
-            tempValue1 = m_container[i].at(m_timeColumn);
         }
     }
 }
@@ -183,11 +231,31 @@ SatInputFileStreamTimeDoubleContainer::ProceedToNextClosestTimeSample()
 {
     NS_LOG_FUNCTION(this);
 
-    while (!FindNextClosest(m_lastValidPosition, m_timeShiftValue, Now().GetSeconds()))
+    return GetRow(ProceedToNextClosestTimeSampleIndex());
+}
+
+double
+SatInputFileStreamTimeDoubleContainer::ProceedToNextClosestTimeSampleValue(uint32_t column)
+{
+    NS_LOG_FUNCTION(this << column);
+    NS_ASSERT(column < m_valuesInRow);
+
+    return m_columns[column][ProceedToNextClosestTimeSampleIndex()];
+}
+
+uint32_t
+SatInputFileStreamTimeDoubleContainer::ProceedToNextClosestTimeSampleIndex()
+{
+    NS_LOG_FUNCTION(this);
+
+    double currentTime = Now().GetSeconds();
+    RewindOnTimeDecrease(currentTime);
+
+    while (!FindNextClosest(m_lastValidPosition, m_timeShiftValue, currentTime))
     {
         m_lastValidPosition = 0;
         m_numOfPasses++;
-        m_timeShiftValue = m_numOfPasses * m_container[m_container.size() - 1].at(m_timeColumn);
+        m_timeShiftValue = m_numOfPasses * m_columns[m_timeColumn].back();
 
         NS_LOG_INFO("Looping samples again with shift value: " << m_timeShiftValue);
     }
@@ -196,12 +264,12 @@ SatInputFileStreamTimeDoubleContainer::ProceedToNextClosestTimeSample()
     {
         std::cout
             << "WARNING! - SatInputFileStreamDoubleContainer::ProceedToNextClosestTimeSample for "
-            << m_fileName << " is out of samples @ time sample " << Now().GetSeconds()
-            << " (passes " << m_numOfPasses << ")" << std::endl;
+            << m_fileName << " is out of samples @ time sample " << currentTime << " (passes "
+            << m_numOfPasses << ")" << std::endl;
         std::cout << "The container will loop samples from the beginning." << std::endl;
     }
 
-    return m_container[m_lastValidPosition];
+    return m_lastValidPosition;
 }
 
 std::vector<double>
@@ -210,51 +278,107 @@ SatInputFileStreamTimeDoubleContainer::InterpolateBetweenClosestTimeSamples()
     NS_LOG_FUNCTION(this);
 
     double currentTime = Now().GetSeconds();
+    RewindOnTimeDecrease(currentTime);
     FindNextClosest(m_lastValidPosition, m_timeShiftValue, currentTime);
 
-    std::vector<double> selectedPosition = m_container[m_lastValidPosition];
-    double selectedTime = selectedPosition.at(m_timeColumn);
+    const std::vector<double>& times = m_columns[m_timeColumn];
+    uint32_t selectedPosition = m_lastValidPosition;
+    double selectedTime = times[selectedPosition];
 
     // Easy case: a time sample for the current time exist
     if (selectedTime == currentTime)
     {
-        return selectedPosition;
+        return GetRow(selectedPosition);
     }
 
     // Fetch the second position to perform linear interpolation
-    std::vector<double> closestPosition;
+    uint32_t closestPosition;
     if (selectedTime > currentTime)
     {
-        if (m_lastValidPosition == 0)
+        if (selectedPosition == 0)
         {
             // No previous position available, abort
-            return selectedPosition;
+            return GetRow(selectedPosition);
         }
-        closestPosition = m_container[m_lastValidPosition - 1];
+        closestPosition = selectedPosition - 1;
     }
     else
     {
-        if (m_lastValidPosition == m_container.size() - 1)
+        if (selectedPosition == times.size() - 1)
         {
             // No next position available, abort
-            return selectedPosition;
+            return GetRow(selectedPosition);
         }
-        closestPosition = m_container[m_lastValidPosition + 1];
+        closestPosition = selectedPosition + 1;
     }
 
     double linearCoefficient =
-        (currentTime - selectedTime) / (closestPosition.at(m_timeColumn) - selectedTime);
-    std::size_t rowSize = selectedPosition.size();
-    std::vector<double> interpolatedPosition(rowSize);
-    for (std::size_t i = 0; i < rowSize; ++i)
+        (currentTime - selectedTime) / (times[closestPosition] - selectedTime);
+    std::vector<double> interpolatedPosition(m_valuesInRow);
+    for (uint32_t i = 0; i < m_valuesInRow; ++i)
     {
+        const std::vector<double>& column = m_columns[i];
         interpolatedPosition[i] =
-            selectedPosition[i] + linearCoefficient * (closestPosition[i] - selectedPosition[i]);
+            column[selectedPosition] +
+            linearCoefficient * (column[closestPosition] - column[selectedPosition]);
     }
 
     return interpolatedPosition;
 }
 
+void
+SatInputFileStreamTimeDoubleContainer::RewindOnTimeDecrease(double comparisonTimeValue)
+{
+    NS_LOG_FUNCTION(this << comparisonTimeValue);
+
+    if (comparisonTimeValue < m_lastComparisonTimeValue)
+    {
+        NS_LOG_INFO("Time moved backwards from " << m_lastComparisonTimeValue
+                                                 << ", look up from the first sample");
+
+        m_lastValidPosition = 0;
+        m_numOfPasses = 0;
+        m_timeShiftValue = 0;
+    }
+    m_lastComparisonTimeValue = comparisonTimeValue;
+}
+
+uint32_t
+SatInputFileStreamTimeDoubleContainer::FindFirstNotBefore(uint32_t firstPosition,
+                                                          double timeShiftValue,
+                                                          double comparisonTimeValue) const
+{
+    const std::vector<double>& times = m_columns[m_timeColumn];
+    uint32_t count = times.size();
+
+    if (firstPosition >= count || times[firstPosition] + timeShiftValue >= comparisonTimeValue)
+    {
+        return firstPosition;
+    }
+
+    // gallop forward with doubling steps, the sample at lower being before
+    // the compared time, then binary search the last step
+    uint32_t lower = firstPosition;
+    uint32_t step = 1;
+    uint32_t upper = lower + 1;
+
+    while (upper < count && times[upper] + timeShiftValue < comparisonTimeValue)
+    {
+        lower = upper;
+        step *= 2;
+        upper = (count - lower > step) ? lower + step : count;
+    }
+
+    std::vector<double>::const_iterator it =
+        std::partition_point(times.begin() + lower + 1,
+                             times.begin() + upper,
+                             [timeShiftValue, comparisonTimeValue](double time) {
+                                 return time + timeShiftValue < comparisonTimeValue;
+                             });
+
+    return it - times.begin();
+}
+
 bool
 SatInputFileStreamTimeDoubleContainer::FindNextClosest(uint32_t lastValidPosition,
                                                        double timeShiftValue,
@@ -263,57 +387,51 @@ SatInputFileStreamTimeDoubleContainer::FindNextClosest(uint32_t lastValidPositio
     NS_LOG_FUNCTION(this);
 
     NS_ASSERT(m_timeColumn < m_valuesInRow);
-    NS_ASSERT(m_container.size() > 0);
-    NS_ASSERT(lastValidPosition >= 0 && lastValidPosition < m_container.size());
+    NS_ASSERT(m_columns[m_timeColumn].size() > 0);
+    NS_ASSERT(lastValidPosition >= 0 && lastValidPosition < m_columns[m_timeColumn].size());
 
     NS_LOG_INFO("LastValidPosition " << lastValidPosition << " column " << m_timeColumn
                                      << " timeShiftValue " << timeShiftValue
                                      << " comparisonTimeValue " << comparisonTimeValue);
 
-    bool valueFound = false;
+    const std::vector<double>& times = m_columns[m_timeColumn];
+    uint32_t i = FindFirstNotBefore(lastValidPosition, timeShiftValue, comparisonTimeValue);
+    bool valueFound = (i < times.size());
 
-    for (uint32_t i = lastValidPosition; i < m_container.size(); i++)
+    if (valueFound)
     {
-        if (m_container[i].at(m_timeColumn) + timeShiftValue >= comparisonTimeValue)
-        {
-            double difference1 = std::abs(m_container[lastValidPosition].at(m_timeColumn) +
-                                          timeShiftValue - comparisonTimeValue);
-            double difference2 =
-                std::abs(m_container[i].at(m_timeColumn) + timeShiftValue - comparisonTimeValue);
+        // the samples before the last valid position are not considered
+        uint32_t previousPosition = (i > lastValidPosition) ? i - 1 : i;
+        double difference1 =
+            std::abs(times[previousPosition] + timeShiftValue - comparisonTimeValue);
+        double difference2 = std::abs(times[i] + timeShiftValue - comparisonTimeValue);
 
-            if (difference1 < difference2)
-            {
-                m_lastValidPosition = lastValidPosition;
-            }
-            else
-            {
-                m_lastValidPosition = i;
-            }
-            valueFound = true;
-            break;
+        if (difference1 < difference2)
+        {
+            m_lastValidPosition = previousPosition;
+        }
+        else
+        {
+            m_lastValidPosition = i;
         }
-        lastValidPosition = i;
     }
 
     if (valueFound && m_numOfPasses > 0 && m_lastValidPosition == 0)
     {
-        double difference1 = std::abs(m_container[m_lastValidPosition].at(m_timeColumn) +
-                                      timeShiftValue - comparisonTimeValue);
+        double difference1 =
+            std::abs(times[m_lastValidPosition] + timeShiftValue - comparisonTimeValue);
         double difference2 =
-            std::abs(m_container[m_container.size() - 1].at(m_timeColumn) +
-                     ((m_numOfPasses - 1) * m_container[m_container.size() - 1].at(m_timeColumn)) -
-                     comparisonTimeValue);
+            std::abs(times.back() + ((m_numOfPasses - 1) * times.back()) - comparisonTimeValue);
 
         if (difference1 > difference2)
         {
-            m_lastValidPosition = m_container.size() - 1;
+            m_lastValidPosition = times.size() - 1;
             m_numOfPasses--;
-            m_timeShiftValue = m_numOfPasses * m_container[m_container.size() - 1].at(m_timeColumn);
+            m_timeShiftValue = m_numOfPasses * times.back();
         }
     }
 
-    NS_LOG_INFO("Done: " << valueFound
-                         << " value: " << m_container[m_lastValidPosition].at(m_timeColumn)
+    NS_LOG_INFO("Done: " << valueFound << " value: " << times[m_lastValidPosition]
                          << " @ line: " << m_lastValidPosition + 1 << " comparison time value: "
                          << comparisonTimeValue << " passes: " << m_numOfPasses);
 
@@ -347,22 +465,13 @@ SatInputFileStreamTimeDoubleContainer::ClearContainer()
 {
     NS_LOG_FUNCTION(this);
 
-    if (!m_container.empty())
-    {
-        for (uint32_t i = 0; i < m_container.size(); i++)
-        {
-            if (!m_container[i].empty())
-            {
-                m_container[i].clear();
-            }
-        }
-        m_container.clear();
-    }
+    m_columns.clear();
 
     m_valuesInRow = 0;
     m_lastValidPosition = 0;
     m_numOfPasses = 0;
     m_timeShiftValue = 0;
+    m_lastComparisonTimeValue = 0;
 }
 
 } // namespace ns3
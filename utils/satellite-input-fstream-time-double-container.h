@@ -26,6 +26,8 @@
 #include "ns3/object.h"
 
 #include <fstream>
+#include <string>
+#include <vector>
 
 namespace ns3
 {
@@ -38,6 +40,13 @@ namespace ns3
  * and iterating the stored values.
  *
  * Row format is [time, value1, ..., value n].
+ *
+ * The file is read at once and parsed with strtod. The values are stored
+ * column by column, each column in a contiguous array. The samples are looked
+ * up from the position of the last look up, galloping forward over the time
+ * column, so that a look up at the next simulation time costs a few
+ * comparisons. When the simulation time moves backwards, e.g. after a
+ * restart, the look up starts again from the first sample.
  */
 class SatInputFileStreamTimeDoubleContainer : public Object
 {
@@ -82,6 +91,14 @@ class SatInputFileStreamTimeDoubleContainer : public Object
      */
     std::vector<double> ProceedToNextClosestTimeSample();
 
+    /**
+     * \brief Function for locating the next closest time sample and returning one of the values
+     * related to it, without copying the row
+     * \param column index of the value in the row
+     * \return matching value
+     */
+    double ProceedToNextClosestTimeSampleValue(uint32_t column);
+
     /**
      * \brief Function for locating time samples enclosing the current time and a linear
      * interpolation between these samples \return linear interpolation of the current time value
@@ -111,10 +128,42 @@ class SatInputFileStreamTimeDoubleContainer : public Object
     void ClearContainer();
 
     /**
-     * \brief Function for reading a row from file
+     * \brief Function for parsing the values read from file into the columns
+     * \param buffer content of the file
+     */
+    void ReadColumns(const std::string& buffer);
+
+    /**
+     * \brief Function for building a row from the columns
+     * \param index index of the row
      * \return the row
      */
-    std::vector<double> ReadRow();
+    std::vector<double> GetRow(uint32_t index) const;
+
+    /**
+     * \brief Function for locating the next closest time sample, looping the samples if needed
+     * \return index of the matching row
+     */
+    uint32_t ProceedToNextClosestTimeSampleIndex();
+
+    /**
+     * \brief Function for restarting the look ups from the first sample when the comparison time
+     * moves backwards
+     * \param comparisonTimeValue time of the look up
+     */
+    void RewindOnTimeDecrease(double comparisonTimeValue);
+
+    /**
+     * \brief Function for locating the first time sample not before a time, galloping forward
+     * from a position
+     * \param firstPosition position to start from
+     * \param timeShiftValue value to shift the time
+     * \param comparisonTimeValue time to compare the samples with
+     * \return index of the first matching sample, or the number of samples if none
+     */
+    uint32_t FindFirstNotBefore(uint32_t firstPosition,
+                                double timeShiftValue,
+                                double comparisonTimeValue) const;
 
     /**
      * \brief Function for locating the next closest value index. This locator loops the samples if
@@ -143,9 +192,9 @@ class SatInputFileStreamTimeDoubleContainer : public Object
     std::ifstream* m_inputFileStream;
 
     /**
-     * \brief Container for value rows
+     * \brief Columns of the values, each column holding one value of all the rows
      */
-    std::vector<std::vector<double>> m_container;
+    std::vector<std::vector<double>> m_columns;
 
     /**
      * \brief File name
@@ -181,6 +230,11 @@ class SatInputFileStreamTimeDoubleContainer : public Object
      * \brief Index for column which contains time information
      */
     uint32_t m_timeColumn;
+
+    /**
+     * \brief Time of the last look up
+     */
+    double m_lastComparisonTimeValue;
 };
 
 } // namespace ns3